@@ -193,6 +193,12 @@ QVariant TopicTreeItem::data(Columns column, Qt::ItemDataRole role) const
           case eCAL::Monitoring::eTransportLayerType::shm:
             this_layer_string = "shm";
             break;
+          case eCAL::Monitoring::eTransportLayerType::inproc:
+            this_layer_string = "inproc";
+            break;
+          case eCAL::Monitoring::eTransportLayerType::uds:
+            this_layer_string = "uds";
+            break;
           default:
             this_layer_string = ("Unknown (" + QString::number(static_cast<int>(layer.type)) + ")");
           }
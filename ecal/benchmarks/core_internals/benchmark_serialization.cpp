@@ -19,10 +19,39 @@
 
 #include <benchmark/benchmark.h>
 #include "serialization/ecal_serialize_service.h"
+#include "serialization/ecal_serialize_sample_payload.h"
 #include "serialization/ecal_serialize_sample_registration.h"
 #include "service_generate.h"
+#include "payload_generate.h"
 #include "registration_generate.h"
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// count heap allocations to verify that the payload view deserialization does not allocate
+namespace
+{
+  std::atomic<size_t> g_allocation_count{ 0 };
+}
+
+void* operator new(std::size_t size_)
+{
+  g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size_ == 0 ? 1 : size_)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr_) noexcept
+{
+  std::free(ptr_);
+}
+
+void operator delete(void* ptr_, std::size_t /*size_*/) noexcept
+{
+  std::free(ptr_);
+}
 
 using namespace eCAL;
 
@@ -87,6 +116,30 @@ namespace
     }
   }
 
+  // Target is either Payload::Sample (owning) or Payload::SampleView (referencing the buffer)
+  template<typename Target>
+  void BM_DeserializePayloadSample(benchmark::State& state)
+  {
+    const std::vector<char> payload(static_cast<size_t>(state.range(0)), 'x');
+    std::vector<char> buffer;
+    eCAL::protozero::SerializeToBuffer(eCAL::Payload::GeneratePayloadSample(payload), buffer);
+
+    Target deserialized_sample{};
+    // one initial run to ensure everything is set up
+    eCAL::protozero::DeserializeFromBuffer(buffer.data(), buffer.size(), deserialized_sample);
+
+    const size_t allocations_before = g_allocation_count.load();
+    for (auto _ : state)
+    {
+      eCAL::protozero::DeserializeFromBuffer(buffer.data(), buffer.size(), deserialized_sample);
+      benchmark::DoNotOptimize(deserialized_sample);
+    }
+    const size_t allocations = g_allocation_count.load() - allocations_before;
+
+    state.counters["allocs_per_iter"] = benchmark::Counter(static_cast<double>(allocations) / static_cast<double>(state.iterations()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(buffer.size()));
+  }
+
   template<class SerializationProtocol>
   void RegisterFamily(const char* tag)
   {
@@ -113,6 +166,14 @@ namespace
     benchmark::RegisterBenchmark(
       std::string("Deserialize/RegistrationSampleList/") + tag,
       &BM_Deserialize<SerializationProtocol, eCAL::Registration::SampleList, GenerateSampleList>);
+
+    benchmark::RegisterBenchmark(
+      std::string("Deserialize/PayloadSample/") + tag,
+      &BM_DeserializePayloadSample<eCAL::Payload::Sample>)->Arg(64)->Arg(64 * 1024);
+
+    benchmark::RegisterBenchmark(
+      std::string("Deserialize/PayloadSampleView/") + tag,
+      &BM_DeserializePayloadSample<eCAL::Payload::SampleView>)->Arg(64)->Arg(64 * 1024);
   }
 }
 
@@ -20,8 +20,14 @@
 #include <ecal/ecal.h>
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <random>
 #include <thread>
+#include <vector>
 
 
 constexpr int registration_delay_ms = 2000;
@@ -35,6 +41,13 @@ constexpr int per_topic_range_start = 1;
 constexpr int per_topic_range_limit = 1 << 24;
 constexpr int per_topic_range_multiplier = 1 << 12;
 
+constexpr int fanout_reader_count_min = 1;
+constexpr int fanout_reader_count_max = 8;
+constexpr int fanout_reader_count_multiplier = 2;
+constexpr size_t fanout_payload_size = 4096;
+constexpr int fanout_callback_work_us = 50;
+constexpr unsigned int fanout_receive_queue_depth = 16;
+
 
 // Random byte generator
 char gen() {
@@ -143,5 +156,104 @@ namespace Multi_Send {
     ->MinWarmUpTime(warmup_time_s);
 }
 
+
+/*
+ *
+ * Benchmarking the fan-out latency of one topic to multiple subscribers over a network layer
+ * (udp or tcp only, the process local shm and inproc layers are disabled)
+ * 
+*/
+namespace Multi_Fanout {
+  // Simulated callback work (busy, the callback keeps its thread occupied)
+  void callback_work() {
+    const auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(fanout_callback_work_us);
+    while (std::chrono::steady_clock::now() < end) {}
+  }
+
+  // Benchmark function
+  void BM_eCAL_Multi_Fanout(benchmark::State& state) {
+    // Define reader count, callback execution and network layer (0 = udp, 1 = tcp) from arguments
+    const int64_t reader_count  = state.range(0);
+    const bool    receive_queue = state.range(1) != 0;
+    const bool    tcp_layer     = state.range(2) != 0;
+
+    // Label row in benchmark output with the network layer
+    state.SetLabel(tcp_layer ? "tcp" : "udp");
+
+    // Initialize eCAL
+    eCAL::Initialize("Benchmark");
+
+    // Publisher and subscribers only use the network layer, every subscriber receives its own copy from the socket
+    eCAL::Publisher::Configuration pub_config = eCAL::GetPublisherConfiguration();
+    pub_config.layer.shm.enable    = false;
+    pub_config.layer.inproc.enable = false;
+    pub_config.layer.uds.enable    = false;
+    pub_config.layer.udp.enable    = !tcp_layer;
+    pub_config.layer.tcp.enable    = tcp_layer;
+
+    eCAL::Subscriber::Configuration sub_config = eCAL::GetSubscriberConfiguration();
+    sub_config.layer.shm.enable    = false;
+    sub_config.layer.inproc.enable = false;
+    sub_config.layer.uds.enable    = false;
+    sub_config.layer.udp.enable    = !tcp_layer;
+    sub_config.layer.tcp.enable    = tcp_layer;
+
+    // Subscribers either execute their callback on the receiving thread or on their own receive queue thread
+    if (receive_queue) {
+      sub_config.receive_queue.depth           = fanout_receive_queue_depth;
+      sub_config.receive_queue.overflow_policy = eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::block;
+      sub_config.receive_queue.executor        = eCAL::Subscriber::ReceiveQueue::eExecutor::dedicated_thread;
+    }
+
+    // Count the deliveries of the current sample
+    std::atomic<int64_t> delivered_count(0);
+    std::mutex delivered_mutex;
+    std::condition_variable delivered_cv;
+
+    // Create the subscribers of the benchmark topic
+    std::vector<eCAL::CSubscriber> subscriber_vector;
+    for (int64_t i=0; i<reader_count; i++) {
+      subscriber_vector.emplace_back("fanout_topic", eCAL::SDataTypeInformation(), sub_config);
+      subscriber_vector.back().SetReceiveCallback([&, reader_count](const eCAL::STopicId&, const eCAL::SDataTypeInformation&, const eCAL::SReceiveCallbackData&) {
+        callback_work();
+        if (++delivered_count == reader_count) {
+          const std::lock_guard<std::mutex> lock(delivered_mutex);
+          delivered_cv.notify_one();
+        }
+      });
+    }
+
+    // Create payload and publisher
+    std::vector<char> content_vector(fanout_payload_size);
+    std::generate(content_vector.begin(), content_vector.end(), gen);
+    const char* content_addr = content_vector.data();
+    eCAL::CPublisher publisher("fanout_topic", eCAL::SDataTypeInformation(), pub_config);
+
+    // Wait for eCAL synchronization
+    std::this_thread::sleep_for(std::chrono::milliseconds(registration_delay_ms));
+
+    // This is the benchmarked section: Sending the payload and waiting until every subscriber processed it
+    for (auto _ : state) {
+      delivered_count = 0;
+      publisher.Send(content_addr, fanout_payload_size);
+      std::unique_lock<std::mutex> lock(delivered_mutex);
+      delivered_cv.wait(lock, [&]() { return delivered_count >= reader_count; });
+    }
+
+    // Destroy the subscribers and finalize eCAL
+    subscriber_vector.clear();
+    eCAL::Finalize();
+  }
+
+  // Register benchmark
+  BENCHMARK(BM_eCAL_Multi_Fanout)
+    ->ArgsProduct({
+      benchmark::CreateRange(fanout_reader_count_min, fanout_reader_count_max, fanout_reader_count_multiplier),
+      {0, 1},
+      {0, 1}})
+    ->UseRealTime()
+    ->MinWarmUpTime(warmup_time_s);
+}
+
 // Benchmark execution
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -84,6 +84,49 @@
  * 
  * The disadvantage of this setting (memfile_buffer_count > 1) is the higher consumption of resources (memory files, events..)
  *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Adaptive transport layer selection (AdaptiveLayerSelection::Configuration)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * By default the transport layer of a connection is picked once from the static priority lists. If adaptive layer
+ * selection is enabled, the publisher starts all layers it shares with a subscriber and selects the layer per payload
+ * size class (powers of two starting at 2 kB) at runtime. The selection is based on the measured send time of the
+ * publisher and the delivery latency and sample loss reported back by the subscribers via registration.
+ *
+ * A layer is only replaced if another layer is cheaper by more than the configured hysteresis. Every probe_interval'th
+ * sample of a size class is sent on all candidate layers to keep their measurements up to date, the subscribers drop
+ * the duplicates. The current selection is reported per layer in the monitoring (STransportLayer::statistics).
+ *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Concurrent send (concurrent_send)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * By default, CPublisher::Send must not be called from several threads at the same time, applications that share a
+ * publisher between threads have to serialize their send calls. If concurrent send is enabled, Send is thread safe.
+ * Every call draws its send clock lock-free and serializes the payload into its own buffer, so that the serialization
+ * of concurrent calls runs in parallel. The calls then pass the transport layers in the order of their send clock,
+ * a call can already write to the next layer while the following call is still writing to the previous one.
+ *
+ * Subscribers therefore receive the samples of one publisher per layer in send clock order, also with
+ * drop_out_of_order_messages enabled. In concurrent mode the shared memory layer always writes the full payload,
+ * partial updates of the memory file content (CPayloadWriter::WriteModified) are not used.
+ *
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Late joiner history (history_depth)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * Topics that are sent rarely (configurations, maps) are not seen by a subscriber that connects after the last
+ * send. With a history depth > 0 the publisher keeps a copy of its last history_depth samples and replays them
+ * to every newly connected subscriber, on the transport layer of that connection and with their original send
+ * clock and time. Subscribers that received the samples already drop the replayed duplicates. Subscribers can
+ * opt out of the replay (Subscriber::Configuration::receive_history).
+ *
+ * The replay runs in the registration thread, send calls of a publisher with history are therefore serialized
+ * with the replay (also with concurrent_send enabled).
+ *
 **/
 
 #pragma once
@@ -119,7 +162,28 @@ namespace eCAL
       {
         struct Configuration
         {
-          bool enable { true };                          //!< enable layer
+          bool         enable           { true };   //!< enable layer
+
+          bool         fec_enable       { false };  //!< Enable forward error correction (xor parity) for the sample fragments (Default: false)
+          unsigned int fec_block_size   { 16U };    //!< Number of data fragments protected as one block (Default: 16)
+          unsigned int fec_parity_count { 2U };     /*!< Number of parity fragments added per block. Every parity fragment can
+                                                         restore one lost data fragment of its interleave group (Default: 2) */
+
+          bool         reliable_enable      { false }; /*!< Enable nack based retransmission of lost sample fragments. Receivers request
+                                                            lost fragments from the sender, the sender repairs them via multicast (Default: false) */
+          unsigned int reliable_window_size { 16U };   //!< Number of last samples kept by the sender for retransmission (Default: 16)
+
+          unsigned int pacing_rate_bytes_per_second { 0U };      /*!< Send rate limit of the publisher in bytes per second, the datagrams of large samples
+                                                                      are spread accordingly instead of being sent as one burst (Default: 0 = unlimited) */
+          unsigned int pacing_burst_bytes           { 65536U };  //!< Number of bytes the publisher may send as one burst when pacing is enabled (Default: 65536)
+
+          unsigned int coalescing_max_delay_us   { 0U };     /*!< Pack consecutive small samples into one datagram, packed samples are sent
+                                                                  at the latest after this delay. Samples are packed only if all subscribers
+                                                                  accept sample batches. Every publisher with coalescing enabled starts its
+                                                                  own flush thread (Default: 0 = disabled) */
+          unsigned int coalescing_max_size_bytes { 8192U };  /*!< Packed samples are sent as soon as they reach this size. Datagrams above the
+                                                                  network MTU are fragmented by IP, losing one fragment loses all packed samples,
+                                                                  so keep it below the MTU on lossy networks (Default: 8192) */
         };
       }
 
@@ -128,14 +192,52 @@ namespace eCAL
         struct Configuration
         {
           bool enable { true };                          //!< enable layer
+
+          unsigned int coalescing_max_delay_us   { 0U };     /*!< Pack consecutive small samples into one tcp message, packed samples are sent
+                                                                  at the latest after this delay. Every publisher with coalescing enabled starts
+                                                                  its own flush thread (Default: 0 = disabled) */
+          unsigned int coalescing_max_size_bytes { 65536U }; //!< Packed samples are sent as soon as they reach this size (Default: 65536)
+        };
+      }
+
+      namespace INPROC
+      {
+        struct Configuration
+        {
+          bool enable { false };                         /*!< enable layer, subscribers of the same process are served directly from the
+                                                              publishers send call, their callbacks run in the sending thread (Default: false) */
+        };
+      }
+
+      namespace UDS
+      {
+        struct Configuration
+        {
+          bool enable { false };                         //!< enable layer (Default: false)
+
+          unsigned int memfd_min_size_bytes { 1048576U };  /*!< Payloads of at least this size are written once into a memfd, only its file descriptor
+                                                               is passed to the subscribers (Linux only, Default: 1048576, 0 = disabled) */
         };
       }
 
       struct Configuration
       {
-        SHM::Configuration shm;
-        UDP::Configuration udp;
-        TCP::Configuration tcp;
+        SHM::Configuration    shm;
+        UDP::Configuration    udp;
+        TCP::Configuration    tcp;
+        INPROC::Configuration inproc;
+        UDS::Configuration    uds;
+      };
+    }
+
+    namespace AdaptiveLayerSelection
+    {
+      struct Configuration
+      {
+        bool         enable             { false };  //!< Select the transport layer per payload size class based on the measured delivery cost (Default: false)
+        unsigned int hysteresis_percent { 20U };    //!< A layer is only replaced by another one that is cheaper by more than this percentage (Default: 20)
+        unsigned int probe_interval     { 100U };   //!< Every n'th sample of a size class is sent on all candidate layers to measure them (Default: 100)
+        unsigned int min_samples        { 10U };    //!< Number of measured samples needed before a layer takes part in the selection (Default: 10)
       };
     }
 
@@ -143,8 +245,14 @@ namespace eCAL
     {
       Layer::Configuration layer;                        //!< Layer configuration
 
+      AdaptiveLayerSelection::Configuration adaptive_layer_selection; //!< Adaptive transport layer selection configuration
+
+      bool                 concurrent_send         { false };  //!< Allow concurrent Send calls from multiple threads on one publisher (Default: false)
+
+      unsigned int         history_depth           { 0U };     //!< Number of last samples replayed to newly connected subscribers (Default: 0 = no history)
+
       using LayerPriorityVector = std::vector<TransportLayer::eType>;
-      LayerPriorityVector  layer_priority_local    { TransportLayer::eType::shm,    TransportLayer::eType::udp_mc, TransportLayer::eType::tcp };
+      LayerPriorityVector  layer_priority_local    { TransportLayer::eType::shm,    TransportLayer::eType::uds, TransportLayer::eType::udp_mc, TransportLayer::eType::tcp };
       LayerPriorityVector  layer_priority_remote   { TransportLayer::eType::udp_mc, TransportLayer::eType::tcp };
     };
   }
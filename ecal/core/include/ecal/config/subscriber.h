@@ -20,6 +20,62 @@
 /**
  * @file   config/subscriber.h
  * @brief  eCAL subscriber configuration
+ *
+ * This subscriber configuration struct can be used to define the behavior of an eCAL subscriber. Additional information on
+ * selected configuration parameters:
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Receive queue (ReceiveQueue::Configuration)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * By default, the receive callback runs in the transport thread that delivered the sample (shared memory observer,
+ * udp receive thread, tcp executor thread). A slow callback therefore delays the transport and, for udp, all other
+ * topics of the process.
+ *
+ * With a receive queue depth > 0, received samples are copied into a bounded queue and the callback is executed by
+ * the configured executor:
+ *   - dedicated_thread : one thread per subscriber
+ *   - shared_pool      : a process wide thread pool (one thread per hardware thread) shared by all subscribers
+ *                        using this executor, the samples of one subscriber are still processed in order
+ *   - caller           : the application processes the queue by calling CSubscriber::ProcessReceiveQueue
+ *
+ * If the queue is full, the overflow policy decides which sample is lost (drop_oldest, drop_newest) or lets the
+ * transport thread wait for free space (block). The queue size, its high water mark and the number of dropped
+ * samples are reported in the monitoring (STopic::receive_queue_*).
+ *
+ * Message objects of intra process publishers are not accepted by subscribers with a receive queue, the queue
+ * always holds a copy of the serialized payload.
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Rate limiting (max_frequency_hz)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * A subscriber that needs a topic at a lower rate than it is published (e.g. a HMI or a health monitor) can set
+ * max_frequency_hz. The limit is registered with the publishers, which skip the samples above this rate for the
+ * connection: the shared memory layer does not signal the subscriber process, the network layers do not send
+ * if no other subscriber of the layer is due. Samples above the rate that are still delivered are dropped by the
+ * subscriber. Message drop detection is disabled for rate limited subscribers. The limit is reported in the
+ * monitoring (STopic::max_frequency), the effective rate is the data frequency of the subscriber.
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Late joiner history (receive_history)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * Publishers with a history depth > 0 replay their last samples to a newly connected subscriber. Subscribers that
+ * only want samples sent after they connected disable receive_history. The publishers then do not replay for
+ * them and replayed samples of other connections that were sent before the subscriber discovered the publisher
+ * are dropped. With receive_history enabled, replayed samples are delivered even if samples with a newer clock
+ * have been received already (drop_out_of_order_messages does not apply to them).
+ *
+ * --------------------------------------------------------------------------------------------------------------
+ * Polling read buffer (read_buffer_depth)
+ * --------------------------------------------------------------------------------------------------------------
+ *
+ * Subscribers without receive callback buffer the received samples for the polling API (v5::CSubscriber::
+ * ReceiveBuffer / ReceiveBuffers). With the default depth of 1 only the newest sample is kept. With a larger depth
+ * the samples are buffered in a lock free ring of read_buffer_depth slots, a consumer that is late gets every
+ * sample as long as the ring does not overflow. Samples received with a full ring are dropped. The slot buffers
+ * are exchanged with the buffers of the consumer, so they are reused without reallocation.
 **/
 
 #pragma once
@@ -58,11 +114,54 @@ namespace eCAL
         };
       }
 
+      namespace INPROC
+      {
+        struct Configuration
+        {
+          bool enable { false }; //!< enable layer for publishers of the same process (Default: false)
+        };
+      }
+
+      namespace UDS
+      {
+        struct Configuration
+        {
+          bool enable { false }; //!< enable layer for publishers of the same host (Default: false)
+        };
+      }
+
+      struct Configuration
+      {
+        SHM::Configuration    shm;
+        UDP::Configuration    udp;
+        TCP::Configuration    tcp;
+        INPROC::Configuration inproc;
+        UDS::Configuration    uds;
+      };
+    }
+
+    namespace ReceiveQueue
+    {
+      enum class eOverflowPolicy
+      {
+        drop_oldest,
+        drop_newest,
+        block
+      };
+
+      enum class eExecutor
+      {
+        dedicated_thread,
+        shared_pool,
+        caller
+      };
+
       struct Configuration
       {
-        SHM::Configuration shm;
-        UDP::Configuration udp;
-        TCP::Configuration tcp;
+        unsigned int    depth           { 0U };                             /*!< Maximum number of queued samples, 0 = no queue, the callback runs
+                                                                                 in the receiving transport thread (Default: 0) */
+        eOverflowPolicy overflow_policy { eOverflowPolicy::drop_oldest };   //!< Handling of samples received with a full queue (Default: drop_oldest)
+        eExecutor       executor        { eExecutor::dedicated_thread };    //!< Execution of the receive callback for queued samples (Default: dedicated_thread)
       };
     }
 
@@ -70,7 +169,15 @@ namespace eCAL
     {
       Layer::Configuration layer;
 
+      ReceiveQueue::Configuration receive_queue; //!< Receive queue configuration
+
       bool drop_out_of_order_messages { true }; //!< Enable dropping of payload messages that arrive out of order
+
+      double max_frequency_hz { 0.0 };          //!< Maximum number of samples per second the subscriber wants to receive (Default: 0.0 = unlimited)
+
+      bool receive_history { true };            //!< Receive the history of publishers with history_depth > 0 on connect (Default: true)
+
+      unsigned int read_buffer_depth { 1U };    //!< Number of samples buffered for the polling receive API (Default: 1 = newest sample only)
     };
   }
 }
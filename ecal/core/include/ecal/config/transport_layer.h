@@ -27,6 +27,8 @@
 #include <ecal/types/custom_data_types.h>
 #include <ecal/os.h>
 
+#include <string>
+
 namespace eCAL
 {
   namespace TransportLayer
@@ -37,6 +39,8 @@ namespace eCAL
       udp_mc,
       shm,
       tcp,
+      inproc,
+      uds,
     };
 
     namespace UDP
@@ -62,10 +66,15 @@ namespace eCAL
         unsigned int            max_datagram_size   { 64 * 1024 - 8 - 20 - 1 }; /*!< Maximum UDP datagram size in bytes.
                                                                                         Default: 65507 = 64 KiB - 20 (IPv4 header) - 8 (UDP header) - 1.
                                                                                         This is the maximum payload for a single UDP datagram imposed by IPv4. */
+        unsigned int            max_sample_size     { 64 * 1024 * 1024 }; /*!< Maximum size of a sample reassembled from UDP fragments in bytes,
+                                                                                  fragments announcing larger samples are dropped (Default: 64 MiB) */
         bool                    join_all_interfaces { false };   /*!< Linux specific setting to enable joining multicast groups on all network interfacs
                                                                          independent of their link state. Enabling this makes sure that eCAL processes
                                                                          receive data if they are started before network devices are up and running. (Default: false)*/
         bool                    npcap_enabled       { false };   //!< Enable to receive UDP traffic with the Npcap based receiver (Default: false)
+
+        unsigned int            pacing_rate_bytes_per_second { 0U };       //!< Send rate limit of all UDP publishers of the process in bytes per second (Default: 0 = unlimited)
+        unsigned int            pacing_burst_bytes           { 262144U };  //!< Number of bytes all UDP publishers of the process may send as one burst when pacing is enabled (Default: 262144)
       
         MulticastConfiguration  network             { "239.0.0.1", 3U };      //!< default: "239.0.0.1", 3U
         MulticastConfiguration  local               { "127.255.255.255", 1U}; //!< default: "127.255.255.255", 1U
@@ -82,10 +91,22 @@ namespace eCAL
       };
     }
 
+    namespace UDS
+    {
+      struct Configuration
+      {
+        std::string socket_directory { "" }; /*!< Directory of the unix domain socket files (e.g. a volume shared between containers).
+                                                   Empty: sockets are created in the abstract namespace on Linux, in the temp directory otherwise (Default: "") */
+        unsigned int max_sample_size { 64 * 1024 * 1024 }; /*!< Maximum size of a sample streamed through a unix domain socket in bytes, readers close
+                                                                connections announcing larger samples (memfd samples are not limited) (Default: 64 MiB) */
+      };
+    }
+
     struct Configuration
     {
       UDP::Configuration udp;
       TCP::Configuration tcp;
+      UDS::Configuration uds;
     };
   }
 }
\ No newline at end of file
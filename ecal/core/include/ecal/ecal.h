@@ -44,6 +44,7 @@
 #include <ecal/config/configuration.h>
 #include <ecal/pubsub/publisher.h>
 #include <ecal/pubsub/subscriber.h>
+#include <ecal/pubsub/waitset.h>
 #include <ecal/service/client.h>
 #include <ecal/service/server.h>
 // IWYU pragma: end_exports
@@ -114,6 +114,24 @@ namespace eCAL
      * @return The size of the required memory.
     **/
     virtual size_t GetSize() = 0;
+
+    /**
+     * @brief Get the message object for typed intra process delivery (optional).
+     *
+     * Typed payload writers may expose the message object they serialize. Subscribers of the
+     * same process accepting the object type (see CSubscriber::SetReceiveCallback) receive the
+     * object directly. The serialization is skipped completely if no other subscriber needs it.
+     *
+     * @return Pointer to the message object, nullptr if not supported (default).
+    **/
+    virtual const void* GetObject() { return nullptr; };
+
+    /**
+     * @brief Get the type identity of the message object returned by GetObject.
+     *
+     * @return Type identity string, nullptr if not supported (default).
+    **/
+    virtual const char* GetObjectType() { return nullptr; };
   };
 
 } // namespace eCAL
@@ -36,6 +36,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -106,6 +107,9 @@ namespace eCAL
      * @param len_    Length of buffer.
      * @param time_   Send time (-1 = use eCAL system time in us, default = -1).
      *
+     * @note Send calls on one publisher may only be made from multiple threads at the same time
+     *       if Publisher::Configuration::concurrent_send is enabled.
+     *
      * @return  True if succeeded, false if not.
     **/
     ECAL_API_EXPORTED_MEMBER
@@ -133,6 +137,74 @@ namespace eCAL
     ECAL_API_EXPORTED_MEMBER
       bool Send(const std::string& payload_, long long time_ = DEFAULT_TIME_ARGUMENT);
 
+    /**
+     * @brief Send a message with a content id to all subscribers accepting it.
+     *
+     * Transport layers without a subscriber accepting the content id are skipped (see CSubscriber::SetContentFilter).
+     *
+     * @param buf_         Pointer to content buffer.
+     * @param len_         Length of buffer.
+     * @param time_        Send time (-1 = use eCAL system time in us).
+     * @param content_id_  Content id of the message.
+     *
+     * @return  True if succeeded, false if not (e.g. no subscriber accepts the content id).
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool Send(const void* buf_, size_t len_, long long time_, long long content_id_);
+
+    /**
+     * @brief Send a message with a content id to all subscribers accepting it.
+     *
+     * @param payload_     Payload writer.
+     * @param time_        Send time (-1 = use eCAL system time in us).
+     * @param content_id_  Content id of the message.
+     *
+     * @return  True if succeeded, false if not (e.g. no subscriber accepts the content id).
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool Send(CPayloadWriter& payload_, long long time_, long long content_id_);
+
+    /**
+     * @brief Send a message with a content id to all subscribers accepting it.
+     *
+     * @param payload_     Payload string.
+     * @param time_        Send time (-1 = use eCAL system time in us).
+     * @param content_id_  Content id of the message.
+     *
+     * @return  True if succeeded, false if not (e.g. no subscriber accepts the content id).
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool Send(const std::string& payload_, long long time_, long long content_id_);
+
+    /**
+     * @brief Send a batch of messages to all subscribers.
+     *
+     * The messages are sent in order with one send clock each, subscribers receive them one by one.
+     * The transport layers pass the whole batch at once where possible: shared memory writes all
+     * messages into one memory file with a single lock and signal, udp and tcp pack them into as
+     * few datagrams / frames as possible.
+     *
+     * @param messages_  Pointer to the first message.
+     * @param count_     Number of messages.
+     *
+     * @note udp packs messages only if all subscribers announce sample batch support, otherwise
+     *       every message is sent in its own datagram.
+     *
+     * @return  True if succeeded, false if not.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool SendBatch(const SBatchMessage* messages_, size_t count_);
+
+    /**
+     * @brief Send a batch of messages to all subscribers.
+     *
+     * @param messages_  The messages.
+     *
+     * @return  True if succeeded, false if not.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool SendBatch(const std::vector<SBatchMessage>& messages_);
+
     /**
      * @brief Query the number of subscribers.
      *
@@ -34,6 +34,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -102,12 +103,53 @@ namespace eCAL
     ECAL_API_EXPORTED_MEMBER
       void SetReceiveCallback(ReceiveCallbackT callback_);
 
+    /**
+     * @brief Set/overwrite callback function for incoming receives, accepting message objects.
+     *
+     * Publishers of the same process sending message objects of the given type (see CPayloadWriter::GetObject)
+     * hand them over via SReceiveCallbackData::object, the payload buffer may be empty in that case.
+     * Requires the intra process layer to be enabled on both sides.
+     *
+     * @param callback_     The callback function to set.
+     * @param object_type_  Type identity of the accepted message objects.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      void SetReceiveCallback(ReceiveCallbackT callback_, const std::string& object_type_);
+
     /**
      * @brief Remove callback function for incoming receives.
     **/
     ECAL_API_EXPORTED_MEMBER
       void RemoveReceiveCallback();
 
+    /**
+     * @brief Execute the receive callback for queued samples.
+     *
+     * Only applies to subscribers configured with a receive queue and the
+     * caller executor (see Subscriber::ReceiveQueue::Configuration).
+     *
+     * @param timeout_ms_  Maximum time to wait for the first queued sample (in milliseconds).
+     *
+     * @return  Number of processed samples.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      size_t ProcessReceiveQueue(int timeout_ms_ = 0);
+
+    /**
+     * @brief Set the content ids this subscriber wants to receive.
+     *
+     * The filter is registered with the publishers of the topic. They skip a transport layer for
+     * samples (see CPublisher::Send with content id) that no subscriber on this layer wants to receive.
+     * Samples outside of the filter that are still delivered (e.g. requested by another subscriber
+     * on the same udp multicast group) are dropped by the subscriber.
+     *
+     * @param id_ranges_  Accepted content id ranges, an empty list accepts every content id.
+     *
+     * @return  True if succeeded, false if not.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool SetContentFilter(const std::vector<SContentIdRange>& id_ranges_);
+
     /**
      * @brief Query the number of connected publishers.
      *
@@ -141,6 +183,8 @@ namespace eCAL
       const SDataTypeInformation& GetDataTypeInformation() const;
 
   private:
+    friend class CWaitSet;
+
     std::weak_ptr<CSubscriberImpl> m_subscriber_impl;
   };
 }
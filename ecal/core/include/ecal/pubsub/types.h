@@ -59,6 +59,26 @@ namespace eCAL
     return os;
   }
 
+  /**
+   * @brief Range of content ids a subscriber wants to receive (see CSubscriber::SetContentFilter).
+  **/
+  struct SContentIdRange
+  {
+    int64_t min_id = 0;   //!< first content id of the range
+    int64_t max_id = 0;   //!< last content id of the range (inclusive)
+  };
+
+  /**
+   * @brief Message of a batch send call (see CPublisher::SendBatch).
+  **/
+  struct SBatchMessage
+  {
+    const void* buffer      = nullptr;  //!< payload buffer
+    size_t      buffer_size = 0;        //!< payload buffer size
+    long long   time        = -1;       //!< send time (-1 = use eCAL system time in us)
+    long long   content_id  = 0;        //!< content id (see CSubscriber::SetContentFilter)
+  };
+
   /**
    * @brief eCAL subscriber receive callback struct.
   **/
@@ -68,6 +88,7 @@ namespace eCAL
     size_t      buffer_size = 0;        //!< payload buffer size
     int64_t     send_timestamp = 0;     //!< publisher send timestamp in µs
     int64_t     send_clock = 0;         //!< publisher send clock. Each publisher increases the counter by one, every time a message is sent. It can be used to detect message drops.
+    const void* object = nullptr;       //!< message object of a publisher in the same process (typed intra process delivery), the buffer may be empty then
   };
 
   /**
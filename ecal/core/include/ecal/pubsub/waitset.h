@@ -0,0 +1,130 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @file   pubsub/waitset.h
+ * @brief  eCAL wait set, waits for the samples of several subscribers in one application thread
+**/
+
+#pragma once
+
+#include <ecal/namespace.h>
+#include <ecal/os.h>
+
+#include <ecal/pubsub/subscriber.h>
+
+#include <cstddef>
+#include <memory>
+
+namespace eCAL
+{
+  class CWaitSetImpl;
+
+  /**
+   * @brief eCAL wait set class.
+   *
+   * Aggregates subscribers configured with a receive queue and the caller executor
+   * (see Subscriber::ReceiveQueue::Configuration). The wait set is signaled as soon as one of them
+   * has queued samples, TakeAll then executes their receive callbacks on the calling thread.
+   *
+   * On Linux the signal is exposed as an eventfd (see GetFileDescriptor) that can be waited for
+   * with epoll / poll / select together with other file descriptors of the application.
+  **/
+  class ECAL_API_CLASS CWaitSet
+  {
+  public:
+    /**
+     * @brief Constructor.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      CWaitSet();
+
+    /**
+     * @brief Destructor, detaches all subscribers.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      virtual ~CWaitSet();
+
+    /**
+     * @brief CWaitSets are non-copyable.
+    **/
+    CWaitSet(const CWaitSet&) = delete;
+
+    /**
+     * @brief CWaitSets are non-copyable.
+    **/
+    CWaitSet& operator=(const CWaitSet&) = delete;
+
+    /**
+     * @brief Attach a subscriber.
+     *
+     * A subscriber can be attached to one wait set at a time.
+     *
+     * @param subscriber_  Subscriber with a receive queue and the caller executor.
+     *
+     * @return  True if succeeded, false if the subscriber has no caller executor receive queue or is attached to another wait set.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool Attach(CSubscriber& subscriber_);
+
+    /**
+     * @brief Detach a subscriber.
+     *
+     * @param subscriber_  Attached subscriber.
+     *
+     * @return  True if succeeded, false if the subscriber was not attached.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool Detach(CSubscriber& subscriber_);
+
+    /**
+     * @brief File descriptor that is readable while the wait set is signaled.
+     *
+     * The descriptor is owned by the wait set and must not be read or closed by the application,
+     * the signal is reset by TakeAll.
+     *
+     * @return  The eventfd of the wait set, -1 if not supported on this platform.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      int GetFileDescriptor() const;
+
+    /**
+     * @brief Wait until an attached subscriber has queued samples.
+     *
+     * @param timeout_ms_  Maximum time to wait (in milliseconds, -1 = infinite).
+     *
+     * @return  True if signaled, false on timeout.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      bool Wait(int timeout_ms_ = -1);
+
+    /**
+     * @brief Execute the receive callbacks for the queued samples of all attached subscribers.
+     *
+     * Does not block, the subscribers are processed in the order they were attached.
+     *
+     * @return  Number of processed samples.
+    **/
+    ECAL_API_EXPORTED_MEMBER
+      size_t TakeAll();
+
+  private:
+    std::shared_ptr<CWaitSetImpl> m_waitset_impl;
+  };
+}
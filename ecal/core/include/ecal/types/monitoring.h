@@ -61,6 +61,16 @@ namespace eCAL
       udp_mc = 1,
       shm    = 4,
       tcp    = 5,
+      uds    = 6,
+      inproc = 42,
+    };
+
+    struct SLayerStatistics
+    {
+      int32_t      size_class = 0;                                 //<! payload size class (0 = below 2 kB, n = below 2^(n+1) kB)
+      int64_t      samples    = 0;                                 //<! number of samples sent in this size class
+      double       cost_us    = 0.0;                               //<! estimated delivery cost per sample in microseconds
+      bool         selected   = false;                             //<! layer is currently selected for this size class
     };
 
     struct STransportLayer
@@ -68,6 +78,14 @@ namespace eCAL
       eTransportLayerType  type    = eTransportLayerType::none;    //<! transport layer type
       int32_t      version = 0;                                    //<! transport layer version
       bool         active  = false;                                //<! transport layer used?
+
+      int64_t      pacing_rate{0};                                 //<! udp_mc only: send rate limit in bytes per second (0 = unlimited)
+      int64_t      pacing_delayed_datagrams{0};                    //<! udp_mc only: number of datagrams delayed by the send rate pacing
+      int64_t      pacing_delay_us{0};                             //<! udp_mc only: accumulated send rate pacing delay in microseconds
+
+      int32_t      connection_count{0};                            //<! tcp only: number of connected subscriber sessions of the publisher
+
+      std::vector<SLayerStatistics> statistics;                    //<! adaptive layer selection only: measured cost and selection per payload size class
     };
 
     struct SStatistics                                            //<! eCAL Statistics struct
@@ -104,6 +122,13 @@ namespace eCAL
       int64_t                             data_clock{0};           //!< data clock (send / receive action)
       int32_t                             data_frequency{0};       //!< data frequency (send / receive samples per second) [mHz]
       SStatistics                         data_latency_us;              //!< latency statistics in microseconds
+
+      int32_t                             receive_queue_depth{0};           //!< subscriber receive queue depth (0 = no receive queue)
+      int32_t                             receive_queue_size{0};            //!< samples currently waiting in the receive queue
+      int32_t                             receive_queue_high_water_mark{0}; //!< maximum number of samples waiting in the receive queue
+      int32_t                             receive_queue_drops{0};           //!< samples dropped because of a full receive queue
+
+      int32_t                             max_frequency{0};                 //!< subscriber rate limit, maximum number of samples per second the subscriber wants to receive [mHz] (0 = unlimited)
     };
 
     struct SProcess                                                //<! eCAL Process struct
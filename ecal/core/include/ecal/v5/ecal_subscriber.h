@@ -36,6 +36,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -179,6 +180,21 @@ namespace eCAL
       ECAL_API_EXPORTED_MEMBER
         bool ReceiveBuffer(std::string& buf_, long long* time_ = nullptr, int rcv_timeout_ = 0) const;
 
+      /**
+       * @brief Receive all buffered messages at once (see Subscriber::Configuration::read_buffer_depth).
+       *
+       *        The strings passed in are reused as receive buffers, so a polling loop
+       *        passing the same vector again does not allocate.
+       *
+       * @param [out] bufs_   Message contents, oldest first.
+       * @param [out] times_  Times from publisher in us (default = nullptr).
+       * @param rcv_timeout_  Maximum time to wait for the first message (in milliseconds, -1 means infinite).
+       *
+       * @return  Number of received messages.
+      **/
+      ECAL_API_EXPORTED_MEMBER
+        size_t ReceiveBuffers(std::vector<std::string>& bufs_, std::vector<long long>* times_ = nullptr, int rcv_timeout_ = 0) const;
+
       /**
        * @brief Add callback function for incoming receives.
        *
@@ -47,6 +47,7 @@ namespace YAML
       if (layer_as_string == "shm") layer_priority_vector.emplace_back(eCAL::TransportLayer::eType::shm);
       if (layer_as_string == "udp") layer_priority_vector.emplace_back(eCAL::TransportLayer::eType::udp_mc);
       if (layer_as_string == "tcp") layer_priority_vector.emplace_back(eCAL::TransportLayer::eType::tcp);
+      if (layer_as_string == "uds") layer_priority_vector.emplace_back(eCAL::TransportLayer::eType::uds);
     }
 
     return layer_priority_vector;
@@ -68,6 +69,9 @@ namespace YAML
         case eCAL::TransportLayer::eType::tcp:
           layer_priority_vector.emplace_back("tcp");
           break;
+        case eCAL::TransportLayer::eType::uds:
+          layer_priority_vector.emplace_back("uds");
+          break;
         default:
           break;
       }
@@ -235,6 +239,21 @@ namespace YAML
     return true;
   }
 
+  Node convert<eCAL::TransportLayer::UDS::Configuration>::encode(const eCAL::TransportLayer::UDS::Configuration& config_)
+  {
+    Node node;
+    node["socket_directory"] = config_.socket_directory;
+    node["max_sample_size"]  = config_.max_sample_size;
+    return node;
+  }
+
+  bool convert<eCAL::TransportLayer::UDS::Configuration>::decode(const Node& node_, eCAL::TransportLayer::UDS::Configuration& config_)
+  {
+    AssignValue<std::string>(config_.socket_directory, node_, "socket_directory");
+    AssignValue<unsigned int>(config_.max_sample_size, node_, "max_sample_size");
+    return true;
+  }
+
   Node convert<eCAL::TransportLayer::UDP::MulticastConfiguration>::encode(const eCAL::TransportLayer::UDP::MulticastConfiguration& config_)
   {
     Node node;
@@ -259,8 +278,11 @@ namespace YAML
     node["send_buffer"]         = config_.send_buffer;
     node["receive_buffer"]      = config_.receive_buffer;
     node["max_datagram_size"]   = config_.max_datagram_size;
+    node["max_sample_size"]     = config_.max_sample_size;
     node["join_all_interfaces"] = config_.join_all_interfaces;
     node["npcap_enabled"]       = config_.npcap_enabled;
+    node["pacing_rate_bytes_per_second"] = config_.pacing_rate_bytes_per_second;
+    node["pacing_burst_bytes"]           = config_.pacing_burst_bytes;
     node["network"]             = config_.network;
     node["local"]               = config_.local;
     return node;
@@ -278,8 +300,11 @@ namespace YAML
     AssignValue<unsigned int>(config_.send_buffer, node_, "send_buffer");
     AssignValue<unsigned int>(config_.receive_buffer, node_, "receive_buffer");
     AssignValue<unsigned int>(config_.max_datagram_size, node_, "max_datagram_size");
+    AssignValue<unsigned int>(config_.max_sample_size, node_, "max_sample_size");
     AssignValue<bool>(config_.join_all_interfaces, node_, "join_all_interfaces");
     AssignValue<bool>(config_.npcap_enabled, node_, "npcap_enabled");
+    AssignValue<unsigned int>(config_.pacing_rate_bytes_per_second, node_, "pacing_rate_bytes_per_second");
+    AssignValue<unsigned int>(config_.pacing_burst_bytes, node_, "pacing_burst_bytes");
 
     AssignValue<eCAL::TransportLayer::UDP::MulticastConfiguration>(config_.network, node_, "network");
     AssignValue<eCAL::TransportLayer::UDP::MulticastConfiguration>(config_.local, node_, "local");
@@ -291,6 +316,7 @@ namespace YAML
     Node node;
     node["udp"] = config_.udp;
     node["tcp"] = config_.tcp;
+    node["uds"] = config_.uds;
 
     return node;
   }
@@ -299,6 +325,7 @@ namespace YAML
   {
     AssignValue<eCAL::TransportLayer::UDP::Configuration>(config_.udp, node_, "udp");
     AssignValue<eCAL::TransportLayer::TCP::Configuration>(config_.tcp, node_, "tcp");
+    AssignValue<eCAL::TransportLayer::UDS::Configuration>(config_.uds, node_, "uds");
     return true;
   }
 
@@ -336,7 +363,16 @@ namespace YAML
   Node convert<eCAL::Publisher::Layer::UDP::Configuration>::encode(const eCAL::Publisher::Layer::UDP::Configuration& config_)
   {
     Node node;
-    node["enable"] = config_.enable;
+    node["enable"]           = config_.enable;
+    node["fec_enable"]       = config_.fec_enable;
+    node["fec_block_size"]   = config_.fec_block_size;
+    node["fec_parity_count"] = config_.fec_parity_count;
+    node["reliable_enable"]      = config_.reliable_enable;
+    node["reliable_window_size"] = config_.reliable_window_size;
+    node["pacing_rate_bytes_per_second"] = config_.pacing_rate_bytes_per_second;
+    node["pacing_burst_bytes"]           = config_.pacing_burst_bytes;
+    node["coalescing_max_delay_us"]      = config_.coalescing_max_delay_us;
+    node["coalescing_max_size_bytes"]    = config_.coalescing_max_size_bytes;
 
     return node;
   }
@@ -344,6 +380,15 @@ namespace YAML
   bool convert<eCAL::Publisher::Layer::UDP::Configuration>::decode(const Node& node_, eCAL::Publisher::Layer::UDP::Configuration& config_)
   {
     AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<bool>(config_.fec_enable, node_, "fec_enable");
+    AssignValue<unsigned int>(config_.fec_block_size, node_, "fec_block_size");
+    AssignValue<unsigned int>(config_.fec_parity_count, node_, "fec_parity_count");
+    AssignValue<bool>(config_.reliable_enable, node_, "reliable_enable");
+    AssignValue<unsigned int>(config_.reliable_window_size, node_, "reliable_window_size");
+    AssignValue<unsigned int>(config_.pacing_rate_bytes_per_second, node_, "pacing_rate_bytes_per_second");
+    AssignValue<unsigned int>(config_.pacing_burst_bytes, node_, "pacing_burst_bytes");
+    AssignValue<unsigned int>(config_.coalescing_max_delay_us, node_, "coalescing_max_delay_us");
+    AssignValue<unsigned int>(config_.coalescing_max_size_bytes, node_, "coalescing_max_size_bytes");
     return true;
   }
   
@@ -351,6 +396,8 @@ namespace YAML
   {
     Node node;
     node["enable"] = config_.enable;
+    node["coalescing_max_delay_us"]   = config_.coalescing_max_delay_us;
+    node["coalescing_max_size_bytes"] = config_.coalescing_max_size_bytes;
 
     return node;
   }
@@ -358,15 +405,47 @@ namespace YAML
   bool convert<eCAL::Publisher::Layer::TCP::Configuration>::decode(const Node& node_, eCAL::Publisher::Layer::TCP::Configuration& config_)
   {
     AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<unsigned int>(config_.coalescing_max_delay_us, node_, "coalescing_max_delay_us");
+    AssignValue<unsigned int>(config_.coalescing_max_size_bytes, node_, "coalescing_max_size_bytes");
     return true;
   }
   
+  Node convert<eCAL::Publisher::Layer::INPROC::Configuration>::encode(const eCAL::Publisher::Layer::INPROC::Configuration& config_)
+  {
+    Node node;
+    node["enable"] = config_.enable;
+    return node;
+  }
+
+  bool convert<eCAL::Publisher::Layer::INPROC::Configuration>::decode(const Node& node_, eCAL::Publisher::Layer::INPROC::Configuration& config_)
+  {
+    AssignValue<bool>(config_.enable, node_, "enable");
+    return true;
+  }
+
+  Node convert<eCAL::Publisher::Layer::UDS::Configuration>::encode(const eCAL::Publisher::Layer::UDS::Configuration& config_)
+  {
+    Node node;
+    node["enable"]               = config_.enable;
+    node["memfd_min_size_bytes"] = config_.memfd_min_size_bytes;
+    return node;
+  }
+
+  bool convert<eCAL::Publisher::Layer::UDS::Configuration>::decode(const Node& node_, eCAL::Publisher::Layer::UDS::Configuration& config_)
+  {
+    AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<unsigned int>(config_.memfd_min_size_bytes, node_, "memfd_min_size_bytes");
+    return true;
+  }
+
   Node convert<eCAL::Publisher::Layer::Configuration>::encode(const eCAL::Publisher::Layer::Configuration& config_)
   {
     Node node;
-    node["shm"] = config_.shm;
-    node["udp"] = config_.udp;
-    node["tcp"] = config_.tcp;
+    node["shm"]    = config_.shm;
+    node["udp"]    = config_.udp;
+    node["tcp"]    = config_.tcp;
+    node["inproc"] = config_.inproc;
+    node["uds"]    = config_.uds;
     return node;
   }
 
@@ -375,13 +454,37 @@ namespace YAML
     AssignValue<eCAL::Publisher::Layer::SHM::Configuration>(config_.shm, node_, "shm");
     AssignValue<eCAL::Publisher::Layer::UDP::Configuration>(config_.udp, node_, "udp");
     AssignValue<eCAL::Publisher::Layer::TCP::Configuration>(config_.tcp, node_, "tcp");
+    AssignValue<eCAL::Publisher::Layer::INPROC::Configuration>(config_.inproc, node_, "inproc");
+    AssignValue<eCAL::Publisher::Layer::UDS::Configuration>(config_.uds, node_, "uds");
     return true;
   }
   
+  Node convert<eCAL::Publisher::AdaptiveLayerSelection::Configuration>::encode(const eCAL::Publisher::AdaptiveLayerSelection::Configuration& config_)
+  {
+    Node node;
+    node["enable"]             = config_.enable;
+    node["hysteresis_percent"] = config_.hysteresis_percent;
+    node["probe_interval"]     = config_.probe_interval;
+    node["min_samples"]        = config_.min_samples;
+    return node;
+  }
+
+  bool convert<eCAL::Publisher::AdaptiveLayerSelection::Configuration>::decode(const Node& node_, eCAL::Publisher::AdaptiveLayerSelection::Configuration& config_)
+  {
+    AssignValue<bool>(config_.enable, node_, "enable");
+    AssignValue<unsigned int>(config_.hysteresis_percent, node_, "hysteresis_percent");
+    AssignValue<unsigned int>(config_.probe_interval, node_, "probe_interval");
+    AssignValue<unsigned int>(config_.min_samples, node_, "min_samples");
+    return true;
+  }
+
   Node convert<eCAL::Publisher::Configuration>::encode(const eCAL::Publisher::Configuration& config_)
   {
     Node node;
     node["layer"]                   = config_.layer;
+    node["adaptive_layer_selection"] = config_.adaptive_layer_selection;
+    node["concurrent_send"]         = config_.concurrent_send;
+    node["history_depth"]           = config_.history_depth;
     node["priority_local"]          = transformLayerEnumToStr(config_.layer_priority_local);
     node["priority_network"]        = transformLayerEnumToStr(config_.layer_priority_remote);
     return node;
@@ -397,6 +500,9 @@ namespace YAML
     config_.layer_priority_remote = transformLayerStrToEnum(tmp);
 
     AssignValue<eCAL::Publisher::Layer::Configuration>(config_.layer, node_, "layer");    
+    AssignValue<eCAL::Publisher::AdaptiveLayerSelection::Configuration>(config_.adaptive_layer_selection, node_, "adaptive_layer_selection");
+    AssignValue<bool>(config_.concurrent_send, node_, "concurrent_send");
+    AssignValue<unsigned int>(config_.history_depth, node_, "history_depth");
     return true;
   }
 
@@ -447,12 +553,40 @@ namespace YAML
     return true;
   }
 
+  Node convert<eCAL::Subscriber::Layer::INPROC::Configuration>::encode(const eCAL::Subscriber::Layer::INPROC::Configuration& config_)
+  {
+    Node node;
+    node["enable"] = config_.enable;
+    return node;
+  }
+
+  bool convert<eCAL::Subscriber::Layer::INPROC::Configuration>::decode(const Node& node_, eCAL::Subscriber::Layer::INPROC::Configuration& config_)
+  {
+    AssignValue<bool>(config_.enable, node_, "enable");
+    return true;
+  }
+
+  Node convert<eCAL::Subscriber::Layer::UDS::Configuration>::encode(const eCAL::Subscriber::Layer::UDS::Configuration& config_)
+  {
+    Node node;
+    node["enable"] = config_.enable;
+    return node;
+  }
+
+  bool convert<eCAL::Subscriber::Layer::UDS::Configuration>::decode(const Node& node_, eCAL::Subscriber::Layer::UDS::Configuration& config_)
+  {
+    AssignValue<bool>(config_.enable, node_, "enable");
+    return true;
+  }
+
   Node convert<eCAL::Subscriber::Layer::Configuration>::encode(const eCAL::Subscriber::Layer::Configuration& config_)
   {
     Node node;
-    node["shm"] = config_.shm;
-    node["udp"] = config_.udp;
-    node["tcp"] = config_.tcp;
+    node["shm"]    = config_.shm;
+    node["udp"]    = config_.udp;
+    node["tcp"]    = config_.tcp;
+    node["inproc"] = config_.inproc;
+    node["uds"]    = config_.uds;
     return node;
   }
 
@@ -461,6 +595,77 @@ namespace YAML
     AssignValue<eCAL::Subscriber::Layer::SHM::Configuration>(config_.shm, node_, "shm");
     AssignValue<eCAL::Subscriber::Layer::UDP::Configuration>(config_.udp, node_, "udp");
     AssignValue<eCAL::Subscriber::Layer::TCP::Configuration>(config_.tcp, node_, "tcp");
+    AssignValue<eCAL::Subscriber::Layer::INPROC::Configuration>(config_.inproc, node_, "inproc");
+    AssignValue<eCAL::Subscriber::Layer::UDS::Configuration>(config_.uds, node_, "uds");
+    return true;
+  }
+
+  Node convert<eCAL::Subscriber::ReceiveQueue::Configuration>::encode(const eCAL::Subscriber::ReceiveQueue::Configuration& config_)
+  {
+    Node node;
+    node["depth"] = config_.depth;
+    switch (config_.overflow_policy)
+    {
+    case eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::drop_newest:
+      node["overflow_policy"] = "drop_newest";
+      break;
+    case eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::block:
+      node["overflow_policy"] = "block";
+      break;
+    case eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::drop_oldest:
+    default:
+      node["overflow_policy"] = "drop_oldest";
+      break;
+    }
+    switch (config_.executor)
+    {
+    case eCAL::Subscriber::ReceiveQueue::eExecutor::shared_pool:
+      node["executor"] = "shared_pool";
+      break;
+    case eCAL::Subscriber::ReceiveQueue::eExecutor::caller:
+      node["executor"] = "caller";
+      break;
+    case eCAL::Subscriber::ReceiveQueue::eExecutor::dedicated_thread:
+    default:
+      node["executor"] = "dedicated_thread";
+      break;
+    }
+    return node;
+  }
+
+  bool convert<eCAL::Subscriber::ReceiveQueue::Configuration>::decode(const Node& node_, eCAL::Subscriber::ReceiveQueue::Configuration& config_)
+  {
+    AssignValue<unsigned int>(config_.depth, node_, "depth");
+
+    std::string overflow_policy;
+    AssignValue<std::string>(overflow_policy, node_, "overflow_policy");
+    if (overflow_policy == "drop_oldest")
+    {
+      config_.overflow_policy = eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::drop_oldest;
+    }
+    else if (overflow_policy == "drop_newest")
+    {
+      config_.overflow_policy = eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::drop_newest;
+    }
+    else if (overflow_policy == "block")
+    {
+      config_.overflow_policy = eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::block;
+    }
+
+    std::string executor;
+    AssignValue<std::string>(executor, node_, "executor");
+    if (executor == "dedicated_thread")
+    {
+      config_.executor = eCAL::Subscriber::ReceiveQueue::eExecutor::dedicated_thread;
+    }
+    else if (executor == "shared_pool")
+    {
+      config_.executor = eCAL::Subscriber::ReceiveQueue::eExecutor::shared_pool;
+    }
+    else if (executor == "caller")
+    {
+      config_.executor = eCAL::Subscriber::ReceiveQueue::eExecutor::caller;
+    }
     return true;
   }
 
@@ -468,14 +673,22 @@ namespace YAML
   {
     Node node;
     node["layer"] = config_.layer;
+    node["receive_queue"] = config_.receive_queue;
     node["drop_out_of_order_messages"] = config_.drop_out_of_order_messages;
+    node["max_frequency_hz"] = config_.max_frequency_hz;
+    node["receive_history"] = config_.receive_history;
+    node["read_buffer_depth"] = config_.read_buffer_depth;
     return node;
   }
 
   bool convert<eCAL::Subscriber::Configuration>::decode(const Node& node_, eCAL::Subscriber::Configuration& config_)
   {
     AssignValue<eCAL::Subscriber::Layer::Configuration>(config_.layer, node_, "layer");
+    AssignValue<eCAL::Subscriber::ReceiveQueue::Configuration>(config_.receive_queue, node_, "receive_queue");
     AssignValue<bool>(config_.drop_out_of_order_messages, node_, "drop_out_of_order_messages");
+    AssignValue<double>(config_.max_frequency_hz, node_, "max_frequency_hz");
+    AssignValue<bool>(config_.receive_history, node_, "receive_history");
+    AssignValue<unsigned int>(config_.read_buffer_depth, node_, "read_buffer_depth");
     return true;
   }
 
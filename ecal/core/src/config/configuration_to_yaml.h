@@ -113,6 +113,14 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::TransportLayer::TCP::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::TransportLayer::UDS::Configuration>
+  {
+    static Node encode(const eCAL::TransportLayer::UDS::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::TransportLayer::UDS::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::TransportLayer::UDP::MulticastConfiguration>
   {
@@ -168,6 +176,22 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::Publisher::Layer::TCP::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::Publisher::Layer::INPROC::Configuration>
+  {
+    static Node encode(const eCAL::Publisher::Layer::INPROC::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Publisher::Layer::INPROC::Configuration& config_);
+  };
+
+  template<>
+  struct convert<eCAL::Publisher::Layer::UDS::Configuration>
+  {
+    static Node encode(const eCAL::Publisher::Layer::UDS::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Publisher::Layer::UDS::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::Publisher::Layer::Configuration>
   {
@@ -176,6 +200,14 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::Publisher::Layer::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::Publisher::AdaptiveLayerSelection::Configuration>
+  {
+    static Node encode(const eCAL::Publisher::AdaptiveLayerSelection::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Publisher::AdaptiveLayerSelection::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::Publisher::Configuration>
   {
@@ -215,6 +247,22 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::Subscriber::Layer::TCP::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::Subscriber::Layer::INPROC::Configuration>
+  {
+    static Node encode(const eCAL::Subscriber::Layer::INPROC::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Subscriber::Layer::INPROC::Configuration& config_);
+  };
+
+  template<>
+  struct convert<eCAL::Subscriber::Layer::UDS::Configuration>
+  {
+    static Node encode(const eCAL::Subscriber::Layer::UDS::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Subscriber::Layer::UDS::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::Subscriber::Layer::Configuration>
   {
@@ -223,6 +271,14 @@ namespace YAML
     static bool decode(const Node& node_, eCAL::Subscriber::Layer::Configuration& config_);
   };
 
+  template<>
+  struct convert<eCAL::Subscriber::ReceiveQueue::Configuration>
+  {
+    static Node encode(const eCAL::Subscriber::ReceiveQueue::Configuration& config_);
+
+    static bool decode(const Node& node_, eCAL::Subscriber::ReceiveQueue::Configuration& config_);
+  };
+
   template<>
   struct convert<eCAL::Subscriber::Configuration>
   {
@@ -54,6 +54,9 @@ namespace
         case eCAL::TransportLayer::eType::tcp:
           result += "\"tcp\", ";
           break;
+        case eCAL::TransportLayer::eType::uds:
+          result += "\"uds\", ";
+          break;
         default:
           break;
       }
@@ -70,6 +73,34 @@ namespace
     return result;
   }
 
+  std::string quoteString(const eCAL::Subscriber::ReceiveQueue::eOverflowPolicy policy_)
+  {
+    switch (policy_)
+    {
+      case eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::drop_newest:
+        return "\"drop_newest\"";
+      case eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::block:
+        return "\"block\"";
+      case eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::drop_oldest:
+      default:
+        return "\"drop_oldest\"";
+    }
+  }
+
+  std::string quoteString(const eCAL::Subscriber::ReceiveQueue::eExecutor executor_)
+  {
+    switch (executor_)
+    {
+      case eCAL::Subscriber::ReceiveQueue::eExecutor::shared_pool:
+        return "\"shared_pool\"";
+      case eCAL::Subscriber::ReceiveQueue::eExecutor::caller:
+        return "\"caller\"";
+      case eCAL::Subscriber::ReceiveQueue::eExecutor::dedicated_thread:
+      default:
+        return "\"dedicated_thread\"";
+    }
+  }
+
   std::string quoteString(const eCAL::Types::UdpConfigVersion config_version_) {
     switch (config_version_)
     {
@@ -224,12 +255,18 @@ namespace eCAL
       ss << R"(    # Default: 65507 = 64 KiB - 20 (IPv4 header) - 8 (UDP header) - 1)"                                            << "\n";
       ss << R"(    # This is the maximum payload size for a single UDP datagram imposed by IPv4.)"                                 << "\n";
       ss << R"(    max_datagram_size: )"                             << config_.transport_layer.udp.max_datagram_size               << "\n";
+      ss << R"(    # Maximum size of a sample reassembled from UDP fragments in bytes, larger samples are dropped)"                << "\n";
+      ss << R"(    max_sample_size: )"                               << config_.transport_layer.udp.max_sample_size                 << "\n";
       ss << R"(    # Linux specific setting to join all network interfaces independend of their link state.)"                       << "\n";
       ss << R"(    # Enabling ensures that eCAL processes receive data when they are started before the)"                           << "\n";
       ss << R"(    # network devices are up and running.)"                                                                          << "\n";
       ss << R"(    join_all_interfaces: )"                           << config_.transport_layer.udp.join_all_interfaces             << "\n";
       ss << R"(    # Windows specific setting to enable receiving UDP traffic with the Npcap based receiver)"                       << "\n";
       ss << R"(    npcap_enabled: )"                                 << config_.transport_layer.udp.npcap_enabled                   << "\n";
+      ss << R"(    # Send rate limit of all UDP publishers of the process in bytes per second (0 = unlimited))"                     << "\n";
+      ss << R"(    pacing_rate_bytes_per_second: )"                  << config_.transport_layer.udp.pacing_rate_bytes_per_second    << "\n";
+      ss << R"(    # Number of bytes all UDP publishers of the process may send as one burst)"                                      << "\n";
+      ss << R"(    pacing_burst_bytes: )"                            << config_.transport_layer.udp.pacing_burst_bytes              << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Local mode multicast group and ttl)"                                                                           << "\n";
       ss << R"(    local:)"                                                                                                         << "\n";
@@ -252,6 +289,13 @@ namespace eCAL
       ss << R"(    # Reconnection attemps the session will try to reconnect in case of an issue)"                                   << "\n";
       ss << R"(    max_reconnections: )"                             << config_.transport_layer.tcp.max_reconnections               << "\n";
       ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  uds: )"                                                                                                            << "\n";
+      ss << R"(    # Directory of the unix domain socket files, e.g. a volume shared between containers)"                           << "\n";
+      ss << R"(    # ("" = abstract socket namespace on Linux, temp directory otherwise))"                                          << "\n";
+      ss << R"(    socket_directory: )"                              << quoteString(config_.transport_layer.uds.socket_directory)   << "\n";
+      ss << R"(    # Maximum size of a sample streamed through a socket in bytes, larger samples close the connection)"            << "\n";
+      ss << R"(    max_sample_size: )"                               << config_.transport_layer.uds.max_sample_size                 << "\n";
+      ss << R"()"                                                                                                                   << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(# Publisher specific base settings)"                                                                                 << "\n";
       ss << R"(publisher:)"                                                                                                         << "\n";
@@ -276,17 +320,67 @@ namespace eCAL
       ss << R"(    udp:)"                                                                                                           << "\n";
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                      << config_.publisher.layer.udp.enable                          << "\n";
+      ss << R"(      # Enable forward error correction (xor parity) for the sample fragments)"                                      << "\n";
+      ss << R"(      fec_enable: )"                                  << config_.publisher.layer.udp.fec_enable                      << "\n";
+      ss << R"(      # Number of data fragments protected as one block)"                                                            << "\n";
+      ss << R"(      fec_block_size: )"                              << config_.publisher.layer.udp.fec_block_size                  << "\n";
+      ss << R"(      # Number of parity fragments per block, each one can restore one lost fragment of its interleave group)"      << "\n";
+      ss << R"(      fec_parity_count: )"                            << config_.publisher.layer.udp.fec_parity_count                << "\n";
+      ss << R"(      # Enable nack based retransmission of lost sample fragments)"                                                  << "\n";
+      ss << R"(      reliable_enable: )"                             << config_.publisher.layer.udp.reliable_enable                 << "\n";
+      ss << R"(      # Number of last samples kept by the sender for retransmission)"                                               << "\n";
+      ss << R"(      reliable_window_size: )"                        << config_.publisher.layer.udp.reliable_window_size            << "\n";
+      ss << R"(      # Send rate limit of the publisher in bytes per second, large samples are paced fragment by fragment (0 = unlimited))" << "\n";
+      ss << R"(      pacing_rate_bytes_per_second: )"                << config_.publisher.layer.udp.pacing_rate_bytes_per_second    << "\n";
+      ss << R"(      # Number of bytes the publisher may send as one burst)"                                                        << "\n";
+      ss << R"(      pacing_burst_bytes: )"                          << config_.publisher.layer.udp.pacing_burst_bytes              << "\n";
+      ss << R"(      # Pack consecutive small samples into one datagram, sent at the latest after this delay (0 = disabled))"      << "\n";
+      ss << R"(      coalescing_max_delay_us: )"                     << config_.publisher.layer.udp.coalescing_max_delay_us         << "\n";
+      ss << R"(      # Packed samples are sent as soon as they reach this size, keep it below the network MTU on lossy networks)"  << "\n";
+      ss << R"(      coalescing_max_size_bytes: )"                   << config_.publisher.layer.udp.coalescing_max_size_bytes       << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(    # Base configuration for TCP publisher)"                                                                         << "\n";
       ss << R"(    tcp:)"                                                                                                           << "\n";
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                      << config_.publisher.layer.shm.enable                          << "\n";
+      ss << R"(      # Pack consecutive small samples into one tcp message, sent at the latest after this delay (0 = disabled))"   << "\n";
+      ss << R"(      coalescing_max_delay_us: )"                     << config_.publisher.layer.tcp.coalescing_max_delay_us         << "\n";
+      ss << R"(      # Packed samples are sent as soon as they reach this size)"                                                   << "\n";
+      ss << R"(      coalescing_max_size_bytes: )"                   << config_.publisher.layer.tcp.coalescing_max_size_bytes       << "\n";
+      ss << R"()"                                                                                                                   << "\n";
+      ss << R"(    # Base configuration for intra process publisher)"                                                              << "\n";
+      ss << R"(    inproc:)"                                                                                                        << "\n";
+      ss << R"(      # Enable layer, subscribers of the same process are served directly from the send call)"                      << "\n";
+      ss << R"(      enable: )"                                      << config_.publisher.layer.inproc.enable                       << "\n";
       ss << R"()"                                                                                                                   << "\n";
-      ss << R"(  # Priority list for layer usage in local mode (Default: SHM > UDP > TCP))"                                         << "\n";
+      ss << R"(    # Base configuration for unix domain socket publisher)"                                                         << "\n";
+      ss << R"(    uds:)"                                                                                                           << "\n";
+      ss << R"(      # Enable layer)"                                                                                               << "\n";
+      ss << R"(      enable: )"                                      << config_.publisher.layer.uds.enable                          << "\n";
+      ss << R"(      # Payloads of at least this size are passed as memfd file descriptor (Linux only, 0 = disabled))"             << "\n";
+      ss << R"(      memfd_min_size_bytes: )"                        << config_.publisher.layer.uds.memfd_min_size_bytes            << "\n";
+      ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  # Priority list for layer usage in local mode (Default: SHM > UDS > UDP > TCP))"                                   << "\n";
       ss << R"(  priority_local: )"                                  << quoteString(config_.publisher.layer_priority_local)         << "\n";
       ss << R"(  # Priority list for layer usage in cloud mode (Default: UDP > TCP))"                                               << "\n";
       ss << R"(  priority_network: )"                                << quoteString(config_.publisher.layer_priority_remote)        << "\n";
       ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  # Select the transport layer per payload size class based on the measured delivery cost)"                          << "\n";
+      ss << R"(  adaptive_layer_selection:)"                                                                                        << "\n";
+      ss << R"(    # Enable adaptive layer selection, all layers shared with a subscriber are started (Default: false))"            << "\n";
+      ss << R"(    enable: )"                                        << config_.publisher.adaptive_layer_selection.enable           << "\n";
+      ss << R"(    # A layer is only replaced by another one that is cheaper by more than this percentage)"                        << "\n";
+      ss << R"(    hysteresis_percent: )"                            << config_.publisher.adaptive_layer_selection.hysteresis_percent << "\n";
+      ss << R"(    # Every n'th sample of a size class is sent on all candidate layers to measure them)"                           << "\n";
+      ss << R"(    probe_interval: )"                                << config_.publisher.adaptive_layer_selection.probe_interval   << "\n";
+      ss << R"(    # Number of measured samples needed before a layer takes part in the selection)"                                << "\n";
+      ss << R"(    min_samples: )"                                   << config_.publisher.adaptive_layer_selection.min_samples      << "\n";
+      ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  # Allow concurrent Send calls from multiple threads on one publisher (Default: false))"                            << "\n";
+      ss << R"(  concurrent_send: )"                                 << config_.publisher.concurrent_send                           << "\n";
+      ss << R"(  # Number of last samples replayed to newly connected subscribers (0 = no history))"                                << "\n";
+      ss << R"(  history_depth: )"                                   << config_.publisher.history_depth                             << "\n";
+      ss << R"()"                                                                                                                   << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(# Subscriber specific base configuration)"                                                                           << "\n";
       ss << R"(subscriber:)"                                                                                                        << "\n";
@@ -306,8 +400,33 @@ namespace eCAL
       ss << R"(      # Enable layer)"                                                                                               << "\n";
       ss << R"(      enable: )"                                        << config_.subscriber.layer.tcp.enable                       << "\n";
       ss << R"()"                                                                                                                   << "\n";
+      ss << R"(    # Base configuration for intra process subscriber)"                                                             << "\n";
+      ss << R"(    inproc:)"                                                                                                        << "\n";
+      ss << R"(      # Enable layer)"                                                                                               << "\n";
+      ss << R"(      enable: )"                                        << config_.subscriber.layer.inproc.enable                    << "\n";
+      ss << R"()"                                                                                                                   << "\n";
+      ss << R"(    # Base configuration for unix domain socket subscriber)"                                                        << "\n";
+      ss << R"(    uds:)"                                                                                                           << "\n";
+      ss << R"(      # Enable layer)"                                                                                               << "\n";
+      ss << R"(      enable: )"                                        << config_.subscriber.layer.uds.enable                       << "\n";
+      ss << R"()"                                                                                                                   << "\n";
+      ss << R"(  # Decouple the reception of samples from the execution of the receive callback)"                                   << "\n";
+      ss << R"(  receive_queue:)"                                                                                                   << "\n";
+      ss << R"(    # Maximum number of queued samples, 0 = callback runs in the receiving transport thread (Default: 0))"           << "\n";
+      ss << R"(    depth: )"                                         << config_.subscriber.receive_queue.depth                      << "\n";
+      ss << R"(    # Handling of samples received with a full queue: "drop_oldest", "drop_newest", "block")"                        << "\n";
+      ss << R"(    overflow_policy: )"                               << quoteString(config_.subscriber.receive_queue.overflow_policy) << "\n";
+      ss << R"(    # Execution of the receive callback: "dedicated_thread", "shared_pool", "caller")"                              << "\n";
+      ss << R"(    executor: )"                                      << quoteString(config_.subscriber.receive_queue.executor)      << "\n";
+      ss << R"()"                                                                                                                   << "\n";
       ss << R"(  # Enable dropping of payload messages that arrive out of order)"                                                   << "\n";
       ss << R"(  drop_out_of_order_messages: )"                        << config_.subscriber.drop_out_of_order_messages             << "\n";
+      ss << R"(  # Maximum number of samples per second the subscriber wants to receive, enforced by the publishers (0 = unlimited))" << "\n";
+      ss << R"(  max_frequency_hz: )"                                  << config_.subscriber.max_frequency_hz                       << "\n";
+      ss << R"(  # Receive the history of publishers with history_depth > 0 on connect)"                                            << "\n";
+      ss << R"(  receive_history: )"                                   << config_.subscriber.receive_history                        << "\n";
+      ss << R"(  # Number of samples buffered for the polling receive API, subscribers without receive callback (1 = newest sample only))" << "\n";
+      ss << R"(  read_buffer_depth: )"                                 << config_.subscriber.read_buffer_depth                      << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"()"                                                                                                                   << "\n";
       ss << R"(# Time configuration)"                                                                                               << "\n";
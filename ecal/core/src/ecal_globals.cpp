@@ -188,6 +188,9 @@ namespace eCAL
     m_shm_reader_layer_instance = std::make_shared<eCAL::CSHMReaderLayer>(subgate_instance, memfile_pool_instance);
     m_udp_reader_layer_instance = std::make_shared<eCAL::CUDPReaderLayer>(subgate_instance);
     m_tcp_reader_layer_instance = std::make_shared<eCAL::CTCPReaderLayer>(subgate_instance);
+#if ECAL_CORE_TRANSPORT_UDS
+    m_uds_reader_layer_instance = std::make_shared<eCAL::CUDSReaderLayer>(subgate_instance);
+#endif
 
     /////////////////////
     // START ALL
@@ -354,6 +357,9 @@ namespace eCAL
     m_udp_reader_layer_instance.reset();
     m_tcp_reader_layer_instance.reset();
     m_shm_reader_layer_instance.reset();
+#if ECAL_CORE_TRANSPORT_UDS
+    m_uds_reader_layer_instance.reset();
+#endif
     
     return true;
   }
@@ -58,6 +58,9 @@
 #include "readwrite/udp/ecal_reader_udp.h"
 #include "readwrite/tcp/ecal_reader_tcp.h"
 #include "readwrite/shm/ecal_reader_shm.h"
+#if ECAL_CORE_TRANSPORT_UDS
+#include "readwrite/uds/ecal_reader_uds.h"
+#endif
 
 #include "util/single_instance_helper.h"
 
@@ -111,6 +114,9 @@ namespace eCAL
     const std::shared_ptr<eCAL::CUDPReaderLayer>&                         udp_reader_layer()       { return m_udp_reader_layer_instance; };
     const std::shared_ptr<eCAL::CTCPReaderLayer>&                         tcp_reader_layer()       { return m_tcp_reader_layer_instance; };
     const std::shared_ptr<eCAL::CSHMReaderLayer>&                         shm_reader_layer()       { return m_shm_reader_layer_instance; };
+#if ECAL_CORE_TRANSPORT_UDS
+    const std::shared_ptr<eCAL::CUDSReaderLayer>&                         uds_reader_layer()       { return m_uds_reader_layer_instance; };
+#endif
 
   private:
     CGlobals() = default;
@@ -148,5 +154,8 @@ namespace eCAL
     std::shared_ptr<eCAL::CUDPReaderLayer>                                m_udp_reader_layer_instance;
     std::shared_ptr<eCAL::CTCPReaderLayer>                                m_tcp_reader_layer_instance;
     std::shared_ptr<eCAL::CSHMReaderLayer>                                m_shm_reader_layer_instance;
+#if ECAL_CORE_TRANSPORT_UDS
+    std::shared_ptr<eCAL::CUDSReaderLayer>                                m_uds_reader_layer_instance;
+#endif
   };
 }
@@ -39,9 +39,11 @@ namespace eCAL
     struct optflags
     {
       unsigned char zero_copy : 1;    // allow reader to access memory without copying
-      unsigned char unused    : 7;
+      unsigned char batch     : 1;    // payload is a sample batch, every entry is a header followed by its payload
+      unsigned char replay    : 1;    // payload is replayed history, its clock is older than the clock of the previous content
+      unsigned char unused    : 5;
     };
-    optflags   options = { 0, 0 };
+    optflags   options = { 0, 0, 0, 0 };
     // ----- > 5.11 ----
     int64_t    ack_timout_ms = 0;
   };
@@ -28,7 +28,11 @@
 #include "ecal/log.h"
 #include "ecal/log_level.h"
 
+#include "readwrite/ecal_sample_batch.h"
+
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -195,8 +199,9 @@ namespace eCAL
           SMemFileHeader mfile_hdr;
           ReadFileHeader(mfile_hdr);
 
-          // check for new content
-          if (mfile_hdr.clock <= last_sample_clock)
+          // check for new content (replayed history is older than the content we have seen before)
+          const bool replay = mfile_hdr.options.replay != 0;
+          if (!replay && (mfile_hdr.clock <= last_sample_clock))
           {
             // release access and leave
             m_memfile.ReleaseReadAccess();
@@ -227,13 +232,13 @@ namespace eCAL
                     // calculate user payload address
                     data_buf = static_cast<const char*>(buf) + mfile_hdr.hdr_size;
                     // call user callback function
-                    m_data_callback(data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
+                    ApplyData(data_buf, mfile_hdr.data_size, mfile_hdr);
                   }
                 }
                 else
                 {
                   // call user callback function
-                  m_data_callback(data_buf, mfile_hdr.data_size, (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
+                  ApplyData(data_buf, mfile_hdr.data_size, mfile_hdr);
                 }
               }
             }
@@ -259,7 +264,7 @@ namespace eCAL
             }
 
             // store clock
-            last_sample_clock = mfile_hdr.clock;
+            if (!replay) last_sample_clock = mfile_hdr.clock;
 
             // release access
             m_memfile.ReleaseReadAccess();
@@ -268,7 +273,7 @@ namespace eCAL
             if (post_process_buffer)
             {
               // add sample to data reader (and call user callback function)
-              if (m_data_callback) m_data_callback(receive_buffer.data(), receive_buffer.size(), (long long)mfile_hdr.id, (long long)mfile_hdr.clock, (long long)mfile_hdr.time, (size_t)mfile_hdr.hash);
+              if (m_data_callback) ApplyData(receive_buffer.data(), receive_buffer.size(), mfile_hdr);
             }
 
             // send acknowledge event
@@ -297,6 +302,30 @@ namespace eCAL
     m_is_observing = false; //-V1020
   }
 
+  void CMemFileObserver::ApplyData(const char* data_, size_t size_, const SMemFileHeader& mfile_hdr_)
+  {
+    if (mfile_hdr_.options.batch == 0)
+    {
+      m_data_callback(data_, size_, (long long)mfile_hdr_.id, (long long)mfile_hdr_.clock, (long long)mfile_hdr_.time, (size_t)mfile_hdr_.hash);
+      return;
+    }
+
+    // sample batch, every entry carries its own header (id, clock, time, hash) in front of its payload
+    ForEachSampleInBatch(data_, size_, [this](const char* sample_, size_t sample_size_)
+      {
+        if (sample_size_ < sizeof(uint16_t)) return;
+
+        SMemFileHeader sample_hdr;
+        std::memcpy(&sample_hdr.hdr_size, sample_, sizeof(uint16_t));
+        const size_t hdr_bytes2copy = std::min(static_cast<size_t>(sample_hdr.hdr_size), sizeof(SMemFileHeader));
+        if ((sample_hdr.hdr_size > sample_size_) || (hdr_bytes2copy < sizeof(uint16_t))) return;
+        std::memcpy(&sample_hdr, sample_, hdr_bytes2copy);
+        if (sample_hdr.data_size > sample_size_ - sample_hdr.hdr_size) return;
+
+        m_data_callback(sample_ + sample_hdr.hdr_size, (size_t)sample_hdr.data_size, (long long)sample_hdr.id, (long long)sample_hdr.clock, (long long)sample_hdr.time, (size_t)sample_hdr.hash);
+      });
+  }
+
   bool CMemFileObserver::ReadFileHeader(SMemFileHeader& mfile_hdr_)
   {
     // retrieve size of received buffer
@@ -71,6 +71,7 @@ namespace eCAL
   protected:
     void Observe(int timeout_);
     bool ReadFileHeader(SMemFileHeader& memfile_hdr);
+    void ApplyData(const char* data_, size_t size_, const SMemFileHeader& mfile_hdr_);
 
     std::atomic<bool>       m_created;
     std::atomic<bool>       m_do_stop;
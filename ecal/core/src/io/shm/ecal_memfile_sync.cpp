@@ -180,6 +180,10 @@ namespace eCAL
     memfile_hdr.hash              = static_cast<uint64_t>(data_.hash);
     // set zero copy
     memfile_hdr.options.zero_copy = static_cast<unsigned char>(data_.zero_copy);
+    // set sample batch
+    memfile_hdr.options.batch     = static_cast<unsigned char>(data_.batch);
+    // set history replay
+    memfile_hdr.options.replay    = static_cast<unsigned char>(data_.replay);
     // set acknowledge timeout
     memfile_hdr.ack_timout_ms     = static_cast<int64_t>(data_.acknowledge_timeout_ms);
 
@@ -210,6 +214,7 @@ namespace eCAL
     // now write content
     bool written(true);
     size_t wbytes(0);
+    m_payload_address = nullptr;
 
     // write the user file header
     written &= m_memfile.WriteBuffer(&memfile_hdr, memfile_hdr.hdr_size, wbytes) > 0;
@@ -219,11 +224,17 @@ namespace eCAL
     {
       written &= m_memfile.WritePayload(payload_, data_.len, wbytes, force_full_write_) > 0;
     }
+    // remember where the payload lives
+    void* wbuf(nullptr);
+    if (written && (m_memfile.GetWriteAddress(wbuf, wbytes + data_.len) != 0u))
+    {
+      m_payload_address = static_cast<const char*>(wbuf) + wbytes;
+    }
     // release write access
     m_memfile.ReleaseWriteAccess();
 
     // and fire the publish event for local subscriber
-    if (written) SyncContent();
+    if (written) SyncContent(data_.signal_process_ids);
 
     if (written)
     {
@@ -296,6 +307,7 @@ namespace eCAL
 
     // reset memory file name
     m_memfile_name.clear();
+    m_payload_address = nullptr;
 
     // disconnect all processes
     DisconnectAll();
@@ -342,7 +354,7 @@ namespace eCAL
     return true;
   }
 
-  void CSyncMemoryFile::SyncContent()
+  void CSyncMemoryFile::SyncContent(const std::vector<int32_t>* process_ids_)
   {
     if (!m_created) return;
 
@@ -355,7 +367,19 @@ namespace eCAL
     EventHandleMapT event_handle_map_snapshot;
     {
       const std::lock_guard<std::mutex> lock(m_event_handle_map_sync);
-      event_handle_map_snapshot = m_event_handle_map;
+      if (process_ids_ == nullptr)
+      {
+        event_handle_map_snapshot = m_event_handle_map;
+      }
+      else
+      {
+        // signal the given processes only (e.g. the ones with a rate limited subscriber due for this sample)
+        for (const auto& process_id : *process_ids_)
+        {
+          auto iter = m_event_handle_map.find(process_id);
+          if (iter != m_event_handle_map.end()) event_handle_map_snapshot.insert(*iter);
+        }
+      }
     }
 
     // "eat" old acknowledge events :)
@@ -35,6 +35,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace eCAL
 {
@@ -62,12 +63,16 @@ namespace eCAL
     size_t GetSize() const;
     bool IsCreated() const { return m_created; };
 
+    // payload written by the last successful Write call, it stays valid and unchanged until
+    // the next Write (readers never modify the payload, so other layers can send it from here)
+    const char* GetPayloadAddress() const { return m_payload_address; };
+
   protected:
     bool Create(const std::string& base_name_, size_t size_);
     bool Destroy();
     bool Recreate(size_t size_);
 
-    void SyncContent();
+    void SyncContent(const std::vector<int32_t>* process_ids_ = nullptr);
     void DisconnectAll();
 
     std::string         m_base_name;
@@ -75,6 +80,7 @@ namespace eCAL
     SSyncMemoryFileAttr m_attr;
     CMemoryFile         m_memfile;
     bool                m_created;
+    const char*         m_payload_address = nullptr;
 
     struct SEventHandlePair
     {
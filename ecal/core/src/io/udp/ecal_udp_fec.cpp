@@ -0,0 +1,523 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP forward error correction (xor parity) for sample fragments
+**/
+
+#include "ecal_udp_fec.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <utility>
+
+namespace
+{
+  constexpr std::array<char, 4> fec_magic{ { '\0', 'F', 'E', 'C' } };
+  constexpr uint8_t             fec_version      = 1;
+  constexpr uint8_t             fec_type_data    = 0;
+  constexpr uint8_t             fec_type_parity  = 1;
+
+  // incomplete samples are dropped after this time or if too many are pending
+  constexpr std::chrono::milliseconds fec_message_timeout{ 1000 };
+  constexpr size_t                    fec_max_pending_messages = 64;
+  constexpr size_t                    fec_max_completed_ids    = 256;
+
+  // reliable mode: a sample with missing fragments is nacked after a randomized delay (so a repair triggered
+  // by another receiver suppresses our own nack), further nacks follow with a growing interval
+  constexpr std::chrono::milliseconds nack_delay{ 5 };
+  constexpr size_t                    nack_max_attempts        = 8;
+  constexpr size_t                    nack_max_fragments       = 256;
+  constexpr uint32_t                  nack_max_lost_messages   = 16;
+  constexpr std::chrono::seconds      reliable_sender_timeout{ 10 };
+
+  void XorInto(char* target_, const char* source_, size_t size_)
+  {
+    for (size_t i = 0; i < size_; ++i)
+    {
+      target_[i] = static_cast<char>(target_[i] ^ source_[i]);
+    }
+  }
+
+  size_t GetFragmentCount(uint64_t message_size_, size_t fragment_size_)
+  {
+    if (message_size_ == 0) return 1;
+    return static_cast<size_t>((message_size_ + fragment_size_ - 1) / fragment_size_);
+  }
+
+  uint32_t GetSenderInstance(uint64_t message_id_)
+  {
+    return static_cast<uint32_t>(message_id_ >> 32U);
+  }
+
+  uint32_t GetSenderCounter(uint64_t message_id_)
+  {
+    return static_cast<uint32_t>(message_id_ & 0xFFFFFFFFU);
+  }
+}
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    const std::string& GetFecSampleNamePrefix()
+    {
+      static const std::string prefix("#fec#");
+      return prefix;
+    }
+
+    size_t GetFecDataFragmentSize(const SFecHeader& header_, size_t index_)
+    {
+      const uint64_t offset = static_cast<uint64_t>(index_) * header_.fragment_size;
+      if (offset >= header_.message_size) return 0;
+      return static_cast<size_t>(std::min<uint64_t>(header_.fragment_size, header_.message_size - offset));
+    }
+
+    bool HasFecSampleNamePrefix(const std::string& sample_name_)
+    {
+      const std::string& prefix = GetFecSampleNamePrefix();
+      return sample_name_.compare(0, prefix.size(), prefix) == 0;
+    }
+
+    std::string StripFecSampleNamePrefix(const std::string& sample_name_)
+    {
+      if (HasFecSampleNamePrefix(sample_name_))
+      {
+        return sample_name_.substr(GetFecSampleNamePrefix().size());
+      }
+      return sample_name_;
+    }
+
+    ////////////////
+    // ENCODER
+    ////////////////
+    CFecEncoder::CFecEncoder(unsigned int block_size_, unsigned int parity_count_, uint16_t nack_port_) :
+      m_block_size(std::min(std::max(block_size_, 1U), 0xFFFFU)),
+      m_parity_count(std::min(parity_count_, m_block_size)),
+      m_nack_port(nack_port_)
+    {
+      // the upper 32 bits identify this encoder instance, the lower 32 bits count the samples
+      std::random_device random_device;
+      m_message_counter = static_cast<uint64_t>(random_device()) << 32U;
+      m_parity_buffers.resize(m_parity_count);
+    }
+
+    std::array<SFecBuffer, 2> CFecEncoder::GetDataFragment(const SFecBuffer& header_, const SFecBuffer& payload_, size_t offset_, size_t size_) const
+    {
+      // the sample is the virtual concatenation of header and payload,
+      // a fragment may start in the header and end in the payload
+      std::array<SFecBuffer, 2> parts;
+      size_t part_idx(0);
+      if (offset_ < header_.size)
+      {
+        const size_t len = std::min(size_, header_.size - offset_);
+        parts[part_idx++] = SFecBuffer{ header_.data + offset_, len };
+        offset_ += len;
+        size_   -= len;
+      }
+      if (size_ > 0)
+      {
+        parts[part_idx] = SFecBuffer{ payload_.data + (offset_ - header_.size), size_ };
+      }
+      return parts;
+    }
+
+    size_t CFecEncoder::Encode(size_t fragment_size_, const SFecBuffer& header_, const SFecBuffer& payload_, const SendFragmentCallbackT& send_fragment_)
+    {
+      const size_t   fragment_size  = std::min<size_t>(std::max<size_t>(fragment_size_, 1), 0xFFFFFFFFU);
+      const uint64_t message_size   = static_cast<uint64_t>(header_.size) + payload_.size;
+      const size_t   fragment_count = GetFragmentCount(message_size, fragment_size);
+
+      SFecHeader header;
+      header.magic          = fec_magic;
+      header.version        = fec_version;
+      header.block_size     = static_cast<uint16_t>(m_block_size);
+      header.parity_count   = static_cast<uint16_t>(m_parity_count);
+      header.nack_port      = m_nack_port;
+      header.fragment_count = static_cast<uint32_t>(fragment_count);
+      header.fragment_size  = static_cast<uint32_t>(fragment_size);
+      header.message_id     = m_message_counter++;
+      header.message_size   = message_size;
+
+      size_t sent_sum(0);
+      for (size_t block_first = 0; block_first < fragment_count; block_first += m_block_size)
+      {
+        const size_t block_last  = std::min<size_t>(block_first + m_block_size, fragment_count);
+        const size_t group_count = std::min<size_t>(m_parity_count, block_last - block_first);
+        for (size_t group = 0; group < group_count; ++group)
+        {
+          m_parity_buffers[group].assign(fragment_size, 0);
+        }
+
+        // send data fragments and accumulate their parity
+        for (size_t idx = block_first; idx < block_last; ++idx)
+        {
+          const size_t offset = idx * fragment_size;
+          const size_t size   = GetFecDataFragmentSize(header, idx);
+          const auto   parts  = GetDataFragment(header_, payload_, offset, size);
+
+          if (m_parity_count > 0)
+          {
+            char* parity = m_parity_buffers[(idx - block_first) % m_parity_count].data();
+            for (const auto& part : parts)
+            {
+              if (part.size == 0) continue;
+              XorInto(parity, part.data, part.size);
+              parity += part.size;
+            }
+          }
+
+          header.type           = fec_type_data;
+          header.fragment_index = static_cast<uint32_t>(idx);
+          const size_t sent = send_fragment_(header, parts);
+          if (sent == 0) return 0;
+          sent_sum += sent;
+        }
+
+        // send parity fragments of this block
+        const size_t block_idx = block_first / m_block_size;
+        for (size_t group = 0; group < group_count; ++group)
+        {
+          header.type           = fec_type_parity;
+          header.fragment_index = static_cast<uint32_t>(block_idx * m_parity_count + group);
+          const std::array<SFecBuffer, 2> parts{ { SFecBuffer{ m_parity_buffers[group].data(), m_parity_buffers[group].size() }, SFecBuffer{} } };
+          const size_t sent = send_fragment_(header, parts);
+          if (sent == 0) return 0;
+          sent_sum += sent;
+        }
+      }
+
+      return sent_sum;
+    }
+
+    ////////////////
+    // DECODER
+    ////////////////
+    CFecDecoder::CFecDecoder(const ApplySampleCallbackT& apply_sample_callback_, const SendNackCallbackT& send_nack_callback_, size_t max_message_size_) :
+      m_apply_sample_callback(apply_sample_callback_),
+      m_send_nack_callback(send_nack_callback_),
+      m_max_message_size(max_message_size_),
+      m_random_engine(std::random_device{}()),
+      m_recovered_count(0),
+      m_nack_count(0)
+    {
+    }
+
+    bool CFecDecoder::IsFecFragment(const char* data_, size_t size_)
+    {
+      if ((data_ == nullptr) || (size_ < sizeof(SFecHeader))) return false;
+      return std::memcmp(data_, fec_magic.data(), fec_magic.size()) == 0;
+    }
+
+    bool CFecDecoder::ApplyFragment(const char* data_, size_t size_, const std::string& sender_address_)
+    {
+      if (!IsFecFragment(data_, size_)) return false;
+
+      SFecHeader header;
+      std::memcpy(&header, data_, sizeof(SFecHeader));
+      const char*  fragment      = data_ + sizeof(SFecHeader);
+      const size_t fragment_size = size_ - sizeof(SFecHeader);
+
+      // check for damaged or unsupported data
+      if (header.version != fec_version) return false;
+      if ((header.fragment_size == 0) || (header.block_size == 0)) return false;
+      if (header.fragment_count != GetFragmentCount(header.message_size, header.fragment_size)) return false;
+      // the header is not authenticated, so never trust it for the size of the sample buffers
+      if ((header.message_size > m_max_message_size) || (header.fragment_count > m_max_message_size)) return false;
+      if (header.type == fec_type_data)
+      {
+        if (header.fragment_index >= header.fragment_count) return false;
+        if (fragment_size != GetFecDataFragmentSize(header, header.fragment_index)) return false;
+      }
+      else if ((header.type == fec_type_parity) && (header.parity_count > 0))
+      {
+        const size_t block_count = (static_cast<size_t>(header.fragment_count) + header.block_size - 1) / header.block_size;
+        if (header.fragment_index >= block_count * header.parity_count) return false;
+        if (fragment_size != header.fragment_size) return false;
+      }
+      else
+      {
+        return false;
+      }
+
+      const auto now = std::chrono::steady_clock::now();
+      RemoveExpiredMessages(now);
+
+      if (header.nack_port != 0) TrackReliableSender(header, sender_address_, now);
+
+      // late fragment (or repair) of an already completed sample
+      if (IsCompleted(header.message_id)) return true;
+
+      auto iter = m_messages.find(header.message_id);
+      if (iter == m_messages.end())
+      {
+        // drop the oldest pending sample if there are too many
+        if (m_messages.size() >= fec_max_pending_messages)
+        {
+          auto oldest = std::min_element(m_messages.begin(), m_messages.end(),
+            [](const std::pair<const uint64_t, SMessage>& lhs_, const std::pair<const uint64_t, SMessage>& rhs_) { return lhs_.second.last_update < rhs_.second.last_update; });
+          m_messages.erase(oldest);
+        }
+
+        SMessage message;
+        message.header  = header;
+        message.data.resize(static_cast<size_t>(header.message_size));
+        message.received.assign(header.fragment_count, false);
+        message.missing = header.fragment_count;
+        if (header.nack_port != 0)
+        {
+          message.nack.sender_address = sender_address_;
+          message.nack.nack_port      = header.nack_port;
+          message.nack.next_nack      = GetNextNackTime(now, 0);
+        }
+        iter = m_messages.emplace(header.message_id, std::move(message)).first;
+      }
+
+      SMessage& message = iter->second;
+      message.last_update = now;
+
+      // all fragments of one sample have to agree on the layout
+      if ((message.header.message_size  != header.message_size)
+        || (message.header.fragment_size != header.fragment_size)
+        || (message.header.block_size    != header.block_size)
+        || (message.header.parity_count  != header.parity_count))
+      {
+        return false;
+      }
+
+      uint32_t parity_index(0);
+      if (header.type == fec_type_data)
+      {
+        const uint32_t idx = header.fragment_index;
+        if (message.received[idx]) return true;
+
+        if (fragment_size > 0) std::memcpy(message.data.data() + static_cast<size_t>(idx) * header.fragment_size, fragment, fragment_size);
+        message.received[idx] = true;
+        message.missing--;
+        message.highest_index = std::max(message.highest_index, idx);
+
+        // without parity fragments there is nothing to recover
+        if (header.parity_count == 0)
+        {
+          if (message.missing == 0) Complete(header.message_id);
+          return true;
+        }
+
+        const uint32_t block_idx = idx / header.block_size;
+        const uint32_t group     = (idx % header.block_size) % header.parity_count;
+        parity_index = block_idx * header.parity_count + group;
+      }
+      else
+      {
+        parity_index = header.fragment_index;
+        if (message.parity.find(parity_index) != message.parity.end()) return true;
+        message.parity.emplace(parity_index, std::vector<char>(fragment, fragment + fragment_size));
+      }
+
+      if (message.missing > 0)  TryRecover(message, parity_index);
+      if (message.missing == 0) Complete(header.message_id);
+
+      return true;
+    }
+
+    void CFecDecoder::TryRecover(SMessage& message_, uint32_t parity_index_)
+    {
+      auto parity_iter = message_.parity.find(parity_index_);
+      if (parity_iter == message_.parity.end()) return;
+
+      const SFecHeader& header = message_.header;
+      const size_t block_first = static_cast<size_t>(parity_index_ / header.parity_count) * header.block_size;
+      const size_t block_last  = std::min<size_t>(block_first + header.block_size, header.fragment_count);
+      const size_t group       = parity_index_ % header.parity_count;
+
+      // a parity fragment can restore exactly one missing data fragment of its group
+      size_t missing_idx(0);
+      size_t missing_cnt(0);
+      for (size_t idx = block_first + group; idx < block_last; idx += header.parity_count)
+      {
+        if (!message_.received[idx])
+        {
+          missing_idx = idx;
+          missing_cnt++;
+        }
+      }
+      if (missing_cnt != 1) return;
+
+      std::vector<char>& restored = parity_iter->second;
+      for (size_t idx = block_first + group; idx < block_last; idx += header.parity_count)
+      {
+        if (idx == missing_idx) continue;
+        XorInto(restored.data(), message_.data.data() + idx * header.fragment_size, GetFecDataFragmentSize(header, idx));
+      }
+
+      const size_t restored_size = GetFecDataFragmentSize(header, missing_idx);
+      if (restored_size > 0) std::memcpy(message_.data.data() + missing_idx * header.fragment_size, restored.data(), restored_size);
+      message_.received[missing_idx] = true;
+      message_.missing--;
+      message_.recovered = true;
+
+      // the parity fragment is consumed now
+      message_.parity.erase(parity_iter);
+    }
+
+    void CFecDecoder::Complete(uint64_t message_id_)
+    {
+      auto iter = m_messages.find(message_id_);
+      if (iter == m_messages.end()) return;
+
+      // take the sample out of the pending list before calling back
+      std::vector<char> data = std::move(iter->second.data);
+      if (iter->second.recovered) m_recovered_count++;
+      m_messages.erase(iter);
+
+      m_completed_ids.push_back(message_id_);
+      if (m_completed_ids.size() > fec_max_completed_ids) m_completed_ids.pop_front();
+
+      if (m_apply_sample_callback) m_apply_sample_callback(data.data(), data.size());
+      else                         m_completed_samples.emplace_back(std::move(data));
+    }
+
+    void CFecDecoder::TakeCompletedSamples(std::vector<std::vector<char>>& samples_)
+    {
+      samples_.clear();
+      samples_.swap(m_completed_samples);
+    }
+
+    bool CFecDecoder::IsCompleted(uint64_t message_id_) const
+    {
+      return std::find(m_completed_ids.begin(), m_completed_ids.end(), message_id_) != m_completed_ids.end();
+    }
+
+    void CFecDecoder::TrackReliableSender(const SFecHeader& header_, const std::string& sender_address_, const std::chrono::steady_clock::time_point& now_)
+    {
+      // we received a fragment of this sample, so it is not lost completely
+      m_lost_messages.erase(header_.message_id);
+
+      const uint32_t instance = GetSenderInstance(header_.message_id);
+      const uint32_t counter  = GetSenderCounter(header_.message_id);
+
+      auto iter = m_reliable_senders.find(instance);
+      if (iter == m_reliable_senders.end())
+      {
+        SReliableSender sender;
+        sender.highest_counter = counter;
+        sender.last_update     = now_;
+        m_reliable_senders.emplace(instance, sender);
+        return;
+      }
+
+      SReliableSender& sender = iter->second;
+      sender.last_update = now_;
+      if (counter <= sender.highest_counter) return;
+
+      // samples between the last known and this one were lost completely, their first fragment is requested
+      // (it tells the fragment count, the missing rest is requested like for any incomplete sample)
+      const uint32_t first_lost = std::max(sender.highest_counter + 1, (counter > nack_max_lost_messages) ? counter - nack_max_lost_messages : 0U);
+      for (uint32_t lost_counter = first_lost; lost_counter < counter; ++lost_counter)
+      {
+        const uint64_t lost_id = (static_cast<uint64_t>(instance) << 32U) | lost_counter;
+        if ((m_messages.find(lost_id) != m_messages.end()) || IsCompleted(lost_id)) continue;
+
+        SNackState nack;
+        nack.sender_address = sender_address_;
+        nack.nack_port      = header_.nack_port;
+        nack.next_nack      = GetNextNackTime(now_, 0);
+        m_lost_messages[lost_id] = nack;
+      }
+      sender.highest_counter = counter;
+    }
+
+    std::chrono::steady_clock::time_point CFecDecoder::GetNextNackTime(const std::chrono::steady_clock::time_point& now_, size_t nack_attempts_)
+    {
+      // randomized delay [nack_delay, 2 * nack_delay] growing with every attempt
+      std::uniform_int_distribution<long long> jitter(0, std::chrono::duration_cast<std::chrono::microseconds>(nack_delay).count());
+      const auto delay = nack_delay * static_cast<int>(nack_attempts_ + 1) + std::chrono::microseconds(jitter(m_random_engine));
+      return now_ + std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay);
+    }
+
+    void CFecDecoder::ProcessNacks(const std::chrono::steady_clock::time_point& now_)
+    {
+      RemoveExpiredMessages(now_);
+      if (!m_send_nack_callback) return;
+
+      std::vector<uint32_t> fragments;
+      for (auto& message_iter : m_messages)
+      {
+        SMessage& message = message_iter.second;
+        if ((message.nack.nack_port == 0) || (message.missing == 0))   continue;
+        if ((now_ < message.nack.next_nack) || (message.nack.nack_attempts >= nack_max_attempts)) continue;
+
+        // while fragments are still arriving only gaps are requested (in front of the current parity block),
+        // if the sample stalls all missing fragments are requested
+        const SFecHeader& header = message.header;
+        uint32_t limit = header.fragment_count;
+        if ((now_ - message.last_update) < nack_delay)
+        {
+          limit = (header.parity_count > 0) ? (message.highest_index / header.block_size) * header.block_size : message.highest_index;
+        }
+
+        fragments.clear();
+        for (uint32_t idx = 0; (idx < limit) && (fragments.size() < nack_max_fragments); ++idx)
+        {
+          if (!message.received[idx]) fragments.push_back(idx);
+        }
+        if (fragments.empty()) continue;
+
+        m_send_nack_callback(message.nack.sender_address, message.nack.nack_port, message_iter.first, fragments);
+        m_nack_count++;
+        message.nack.nack_attempts++;
+        message.nack.next_nack = GetNextNackTime(now_, message.nack.nack_attempts);
+      }
+
+      const std::vector<uint32_t> first_fragment{ 0 };
+      for (auto iter = m_lost_messages.begin(); iter != m_lost_messages.end();)
+      {
+        SNackState& nack = iter->second;
+        if (nack.nack_attempts >= nack_max_attempts)
+        {
+          iter = m_lost_messages.erase(iter);
+          continue;
+        }
+        if (now_ >= nack.next_nack)
+        {
+          m_send_nack_callback(nack.sender_address, nack.nack_port, iter->first, first_fragment);
+          m_nack_count++;
+          nack.nack_attempts++;
+          nack.next_nack = GetNextNackTime(now_, nack.nack_attempts);
+        }
+        ++iter;
+      }
+    }
+
+    void CFecDecoder::RemoveExpiredMessages(const std::chrono::steady_clock::time_point& now_)
+    {
+      for (auto iter = m_messages.begin(); iter != m_messages.end();)
+      {
+        if ((now_ - iter->second.last_update) > fec_message_timeout) iter = m_messages.erase(iter);
+        else                                                          ++iter;
+      }
+      for (auto iter = m_reliable_senders.begin(); iter != m_reliable_senders.end();)
+      {
+        if ((now_ - iter->second.last_update) > reliable_sender_timeout) iter = m_reliable_senders.erase(iter);
+        else                                                              ++iter;
+      }
+    }
+  }
+}
@@ -0,0 +1,191 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP forward error correction (xor parity) for sample fragments
+ *
+ * A sample is split into fragments that each fit into a single datagram. The data
+ * fragments are grouped into blocks of 'block_size' fragments and for every block
+ * 'parity_count' xor parity fragments are added. Parity fragment j of a block covers
+ * all data fragments i of that block with (i % parity_count) == j, so every parity
+ * fragment can restore one lost data fragment of its interleave group.
+ *
+ * If the sender announces a nack port in the fragment header (reliable mode), the
+ * decoder requests lost data fragments from the sender (see ecal_udp_reliable.h).
+**/
+
+#pragma once
+
+#include "io/udp/ecal_udp_receiver_attr.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    // fec datagrams are sent with this prefix in front of the sample name,
+    // so receivers without fec support are not interested in them at all
+    const std::string& GetFecSampleNamePrefix();
+
+    bool HasFecSampleNamePrefix(const std::string& sample_name_);
+
+    // strip the fec prefix from a sample name (returns the name unchanged if there is none)
+    std::string StripFecSampleNamePrefix(const std::string& sample_name_);
+
+    struct SFecHeader
+    {
+      std::array<char, 4> magic{};        // '\0' 'F' 'E' 'C' (a leading zero byte is never a valid serialized sample)
+      uint8_t             version        = 0;
+      uint8_t             type           = 0;  // 0 = data fragment, 1 = parity fragment
+      uint16_t            block_size     = 0;  // data fragments per block
+      uint16_t            parity_count   = 0;  // parity fragments per block
+      uint16_t            nack_port      = 0;  // udp port of the sender to request lost fragments (0 = no retransmission)
+      uint32_t            fragment_index = 0;  // data: index of the data fragment, parity: block * parity_count + interleave group
+      uint32_t            fragment_count = 0;  // total number of data fragments of the sample
+      uint32_t            fragment_size  = 0;  // (maximum) size of a data fragment
+      uint64_t            message_id     = 0;  // unique id of the sample (sender instance id + counter)
+      uint64_t            message_size   = 0;  // size of the whole sample
+    };
+    static_assert(sizeof(SFecHeader) == 40, "SFecHeader must not contain padding bytes");
+
+    struct SFecBuffer
+    {
+      const char* data = nullptr;
+      size_t      size = 0;
+    };
+
+    // size of the data fragment with the given index
+    size_t GetFecDataFragmentSize(const SFecHeader& header_, size_t index_);
+
+    class CFecEncoder
+    {
+    public:
+      // a fragment is sent as fec header followed by up to two buffer parts
+      using SendFragmentCallbackT = std::function<size_t(const SFecHeader& header_, const std::array<SFecBuffer, 2>& parts_)>;
+
+      // a parity count of zero disables the parity fragments (plain fragmentation for the reliable mode)
+      CFecEncoder(unsigned int block_size_, unsigned int parity_count_, uint16_t nack_port_ = 0);
+
+      // encodes the sample [header_][payload_] into fragments of (maximum) fragment_size_ bytes
+      // and sends all data and parity fragments, returns the sum of bytes sent or 0 if sending failed
+      size_t Encode(size_t fragment_size_, const SFecBuffer& header_, const SFecBuffer& payload_, const SendFragmentCallbackT& send_fragment_);
+
+    private:
+      std::array<SFecBuffer, 2> GetDataFragment(const SFecBuffer& header_, const SFecBuffer& payload_, size_t offset_, size_t size_) const;
+
+      unsigned int                   m_block_size;
+      unsigned int                   m_parity_count;
+      uint16_t                       m_nack_port;
+
+      uint64_t                       m_message_counter;
+      std::vector<std::vector<char>> m_parity_buffers;
+    };
+
+    class CFecDecoder
+    {
+    public:
+      // request lost data fragments of a sample (the first fragment only if the sample was lost completely)
+      using SendNackCallbackT = std::function<void(const std::string& address_, uint16_t port_, uint64_t message_id_, const std::vector<uint32_t>& fragments_)>;
+
+      // fragments of samples larger than max_message_size_ are dropped before any buffer is allocated for them
+      explicit CFecDecoder(const ApplySampleCallbackT& apply_sample_callback_, const SendNackCallbackT& send_nack_callback_ = nullptr, size_t max_message_size_ = 64 * 1024 * 1024);
+
+      // returns true if the datagram payload is a fec fragment
+      static bool IsFecFragment(const char* data_, size_t size_);
+
+      // applies a fec fragment, the completed (or restored) sample is forwarded to the apply sample callback
+      // (without an apply sample callback completed samples are collected, see TakeCompletedSamples)
+      // the sender address is only needed for fragments of reliable senders (nack port set)
+      // this function is not thread safe, calls to ApplyFragment and ProcessNacks need to be synchronized by the caller
+      bool ApplyFragment(const char* data_, size_t size_, const std::string& sender_address_ = std::string());
+
+      // moves the collected completed samples into samples_ (in completion order)
+      void TakeCompletedSamples(std::vector<std::vector<char>>& samples_);
+
+      // sends nacks for all incomplete samples of reliable senders that are due
+      void ProcessNacks(const std::chrono::steady_clock::time_point& now_);
+
+      // true if fragments of at least one reliable sender have been received
+      bool HasReliableSenders() const { return !m_reliable_senders.empty(); }
+
+      // number of samples that could only be completed by using parity fragments
+      size_t GetRecoveredCount() const { return m_recovered_count; }
+
+      // number of nack datagrams sent
+      size_t GetNackCount() const { return m_nack_count; }
+
+    private:
+      struct SNackState
+      {
+        std::string                                sender_address;
+        uint16_t                                   nack_port     = 0;
+        size_t                                     nack_attempts = 0;
+        std::chrono::steady_clock::time_point      next_nack;
+      };
+
+      struct SMessage
+      {
+        SFecHeader                                 header;
+        std::vector<char>                          data;
+        std::vector<bool>                          received;
+        size_t                                     missing        = 0;
+        uint32_t                                   highest_index  = 0;
+        bool                                       recovered      = false;
+        std::map<uint32_t, std::vector<char>>      parity;
+        std::chrono::steady_clock::time_point      last_update;
+        SNackState                                 nack;
+      };
+
+      struct SReliableSender
+      {
+        uint32_t                                   highest_counter = 0;
+        std::chrono::steady_clock::time_point      last_update;
+      };
+
+      void TryRecover(SMessage& message_, uint32_t parity_index_);
+      void Complete(uint64_t message_id_);
+      bool IsCompleted(uint64_t message_id_) const;
+      void TrackReliableSender(const SFecHeader& header_, const std::string& sender_address_, const std::chrono::steady_clock::time_point& now_);
+      std::chrono::steady_clock::time_point GetNextNackTime(const std::chrono::steady_clock::time_point& now_, size_t nack_attempts_);
+      void RemoveExpiredMessages(const std::chrono::steady_clock::time_point& now_);
+
+      ApplySampleCallbackT                         m_apply_sample_callback;
+      SendNackCallbackT                            m_send_nack_callback;
+      size_t                                       m_max_message_size;
+      std::map<uint64_t, SMessage>                 m_messages;
+      std::map<uint64_t, SNackState>               m_lost_messages;
+      std::map<uint32_t, SReliableSender>          m_reliable_senders;
+      std::deque<uint64_t>                         m_completed_ids;
+      std::vector<std::vector<char>>               m_completed_samples;
+      std::minstd_rand                             m_random_engine;
+      size_t                                       m_recovered_count;
+      size_t                                       m_nack_count;
+    };
+  }
+}
@@ -0,0 +1,77 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP send rate pacing (token bucket)
+**/
+
+#include "ecal_udp_pacing.h"
+
+#include <algorithm>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    CTokenBucket::CTokenBucket(int64_t rate_, int64_t burst_) :
+      m_rate(std::max<int64_t>(rate_, 0)),
+      m_burst(static_cast<double>(std::max<int64_t>(burst_, 0))),
+      m_tokens(m_burst),
+      m_last_update(std::chrono::steady_clock::now())
+    {
+    }
+
+    std::chrono::steady_clock::duration CTokenBucket::Reserve(size_t size_, const std::chrono::steady_clock::time_point& now_)
+    {
+      if (!IsEnabled()) return std::chrono::steady_clock::duration::zero();
+
+      const std::lock_guard<std::mutex> lock(m_mutex);
+
+      // refill the bucket (up to the burst size)
+      if (now_ > m_last_update)
+      {
+        const double elapsed_s = std::chrono::duration<double>(now_ - m_last_update).count();
+        m_tokens      = std::min(m_burst, m_tokens + elapsed_s * static_cast<double>(m_rate));
+        m_last_update = now_;
+      }
+
+      // the tokens may become negative, following senders have to wait for the debt as well
+      m_tokens -= static_cast<double>(size_);
+      if (m_tokens >= 0.0) return std::chrono::steady_clock::duration::zero();
+
+      const std::chrono::duration<double> wait_s(-m_tokens / static_cast<double>(m_rate));
+      return std::chrono::duration_cast<std::chrono::steady_clock::duration>(wait_s);
+    }
+
+    std::shared_ptr<CTokenBucket> GetProcessTokenBucket(int64_t rate_, int64_t burst_)
+    {
+      static std::mutex                  process_bucket_mutex;
+      static std::weak_ptr<CTokenBucket> process_bucket;
+
+      const std::lock_guard<std::mutex> lock(process_bucket_mutex);
+      auto bucket = process_bucket.lock();
+      if (!bucket)
+      {
+        bucket = std::make_shared<CTokenBucket>(rate_, burst_);
+        process_bucket = bucket;
+      }
+      return bucket;
+    }
+  }
+}
@@ -0,0 +1,72 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP send rate pacing (token bucket)
+ *
+ * Large samples are sent as a burst of datagrams that can overrun switch and receiver
+ * socket buffers. The token bucket limits the send rate to 'rate' bytes per second while
+ * allowing bursts of up to 'burst' bytes. Senders reserve the bytes of every datagram and
+ * wait until the bucket would have been refilled accordingly.
+**/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    class CTokenBucket
+    {
+    public:
+      // a rate of zero disables the pacing
+      CTokenBucket(int64_t rate_, int64_t burst_);
+
+      bool IsEnabled() const { return m_rate > 0; }
+      int64_t GetRate() const { return m_rate; }
+
+      // consumes size_ bytes and returns the time the caller has to wait before sending them
+      std::chrono::steady_clock::duration Reserve(size_t size_, const std::chrono::steady_clock::time_point& now_);
+
+    private:
+      std::mutex                            m_mutex;
+      const int64_t                         m_rate;
+      const double                          m_burst;
+      double                                m_tokens;
+      std::chrono::steady_clock::time_point m_last_update;
+    };
+
+    struct SPacingStatistics
+    {
+      int64_t rate              = 0;  // effective pacing rate in bytes per second (0 = pacing disabled)
+      int64_t delayed_datagrams = 0;  // number of datagrams delayed by the pacing
+      int64_t delay_us          = 0;  // accumulated pacing delay in microseconds
+    };
+
+    // the token bucket shared by all udp publishers of this process
+    // (created with the parameters of the first caller, released with the last sender)
+    std::shared_ptr<CTokenBucket> GetProcessTokenBucket(int64_t rate_, int64_t burst_);
+  }
+}
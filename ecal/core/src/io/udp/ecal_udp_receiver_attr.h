@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -37,6 +39,8 @@ namespace eCAL
       bool        broadcast = false;
       bool        loopback  = true;
       int         rcvbuf    = 1024 * 1024;
+      size_t      max_sample_size = 64 * 1024 * 1024;  // maximum size of a sample reassembled from fragments
+      uint64_t    nack_id         = 0;                 // sent with the nacks to reliable senders (announced in the registration)
     };
 
     using HasSampleCallbackT   = std::function<bool(const std::string& sample_name_)>;
@@ -0,0 +1,156 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP reliable multicast (nack based retransmission of sample fragments)
+**/
+
+#include "ecal_udp_reliable.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+  constexpr std::array<char, 4> nack_magic{ { '\0', 'N', 'A', 'K' } };
+
+  // a fragment is repaired at most once within this interval, no matter how many receivers request it
+  constexpr std::chrono::milliseconds repair_suppression_interval{ 5 };
+
+  // upper bounds of the repair traffic, a nack requests at most as many fragments as a fec decoder sends
+  constexpr uint32_t                  repair_max_fragments_per_nack   = 256;
+  constexpr size_t                    repair_max_fragments_per_second = 16384;
+}
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    void SerializeNack(uint64_t nack_id_, uint64_t message_id_, const std::vector<uint32_t>& fragments_, std::vector<char>& target_buffer_)
+    {
+      SNackHeader header;
+      header.magic          = nack_magic;
+      header.fragment_count = static_cast<uint32_t>(fragments_.size());
+      header.message_id     = message_id_;
+      header.nack_id        = nack_id_;
+
+      target_buffer_.resize(sizeof(SNackHeader) + fragments_.size() * sizeof(uint32_t));
+      std::memcpy(target_buffer_.data(), &header, sizeof(SNackHeader));
+      if (!fragments_.empty())
+      {
+        std::memcpy(target_buffer_.data() + sizeof(SNackHeader), fragments_.data(), fragments_.size() * sizeof(uint32_t));
+      }
+    }
+
+    bool DeserializeNack(const char* data_, size_t size_, uint64_t& nack_id_, uint64_t& message_id_, std::vector<uint32_t>& fragments_)
+    {
+      if ((data_ == nullptr) || (size_ < sizeof(SNackHeader))) return false;
+
+      SNackHeader header;
+      std::memcpy(&header, data_, sizeof(SNackHeader));
+      if (header.magic != nack_magic) return false;
+      // the requested fragments are always listed explicitly
+      if ((header.fragment_count == 0) || (header.fragment_count > repair_max_fragments_per_nack)) return false;
+      if (size_ != sizeof(SNackHeader) + static_cast<size_t>(header.fragment_count) * sizeof(uint32_t)) return false;
+
+      nack_id_    = header.nack_id;
+      message_id_ = header.message_id;
+      fragments_.resize(header.fragment_count);
+      std::memcpy(fragments_.data(), data_ + sizeof(SNackHeader), fragments_.size() * sizeof(uint32_t));
+      return true;
+    }
+
+    CRetransmitWindow::CRetransmitWindow(size_t window_size_) :
+      m_window_size(std::max<size_t>(window_size_, 1)),
+      m_repair_count(0),
+      m_repair_budget_used(0)
+    {
+    }
+
+    void CRetransmitWindow::Add(const std::string& sample_name_, const SFecHeader& message_header_, const SFecBuffer& header_, const SFecBuffer& payload_)
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+
+      // reuse the oldest entry (and its memory) if the window is full
+      SEntry entry;
+      if (m_entries.size() >= m_window_size)
+      {
+        entry = std::move(m_entries.front());
+        m_entries.pop_front();
+      }
+
+      entry.sample_name = sample_name_;
+      entry.header      = message_header_;
+      entry.data.resize(header_.size + payload_.size);
+      if (header_.size  > 0) std::memcpy(entry.data.data(), header_.data, header_.size);
+      if (payload_.size > 0) std::memcpy(entry.data.data() + header_.size, payload_.data, payload_.size);
+      entry.last_repair.assign(message_header_.fragment_count, std::chrono::steady_clock::time_point());
+
+      m_entries.emplace_back(std::move(entry));
+    }
+
+    std::vector<CRetransmitWindow::SRepairFragment> CRetransmitWindow::GetRepairFragments(uint64_t message_id_, const std::vector<uint32_t>& fragments_)
+    {
+      std::vector<SRepairFragment> repair_fragments;
+
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      auto iter = std::find_if(m_entries.begin(), m_entries.end(), [message_id_](const SEntry& entry_) { return entry_.header.message_id == message_id_; });
+      if (iter == m_entries.end()) return repair_fragments;
+
+      SEntry& entry = *iter;
+      const auto now = std::chrono::steady_clock::now();
+      if ((now - m_repair_budget_start) >= std::chrono::seconds(1))
+      {
+        m_repair_budget_start = now;
+        m_repair_budget_used  = 0;
+      }
+
+      for (const auto index : fragments_)
+      {
+        if (repair_fragments.size() >= repair_max_fragments_per_nack)         break;
+        if (m_repair_budget_used >= repair_max_fragments_per_second)          break;
+        if (index >= entry.header.fragment_count)                             continue;
+        if ((now - entry.last_repair[index]) < repair_suppression_interval)   continue;
+        entry.last_repair[index] = now;
+
+        SRepairFragment fragment;
+        fragment.sample_name           = entry.sample_name;
+        fragment.header                = entry.header;
+        fragment.header.type           = 0;
+        fragment.header.fragment_index = index;
+
+        const size_t offset = static_cast<size_t>(index) * entry.header.fragment_size;
+        const size_t size   = GetFecDataFragmentSize(entry.header, index);
+        fragment.data.assign(entry.data.data() + offset, entry.data.data() + offset + size);
+        repair_fragments.emplace_back(std::move(fragment));
+        m_repair_budget_used++;
+      }
+
+      m_repair_count += repair_fragments.size();
+      return repair_fragments;
+    }
+
+    size_t CRetransmitWindow::GetRepairCount() const
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      return m_repair_count;
+    }
+  }
+}
@@ -0,0 +1,102 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  UDP reliable multicast (nack based retransmission of sample fragments)
+ *
+ * In reliable mode the sender keeps its last samples in a bounded retransmit window and
+ * announces a unicast nack port in every fragment header. Receivers send a nack datagram
+ * with the missing fragment indices of a sample to that port and the sender repairs the
+ * fragments via multicast, so all receivers profit from a single repair. Repeated
+ * requests for the same fragment within a short interval are suppressed on sender side.
+ *
+ * A nack carries the nack id of the receiving process (announced by its subscribers in the
+ * registration), nacks of unknown ids are ignored. The number of repaired fragments is
+ * limited per nack and per second, so a nack can not trigger more traffic than it requests.
+**/
+
+#pragma once
+
+#include "io/udp/ecal_udp_fec.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace UDP
+  {
+    struct SNackHeader
+    {
+      std::array<char, 4> magic{};            // '\0' 'N' 'A' 'K'
+      uint32_t            fragment_count = 0; // number of requested fragment indices following the header (at least one)
+      uint64_t            message_id     = 0;
+      uint64_t            nack_id        = 0; // id of the requesting process
+    };
+    static_assert(sizeof(SNackHeader) == 24, "SNackHeader must not contain padding bytes");
+
+    void SerializeNack(uint64_t nack_id_, uint64_t message_id_, const std::vector<uint32_t>& fragments_, std::vector<char>& target_buffer_);
+    bool DeserializeNack(const char* data_, size_t size_, uint64_t& nack_id_, uint64_t& message_id_, std::vector<uint32_t>& fragments_);
+
+    class CRetransmitWindow
+    {
+    public:
+      struct SRepairFragment
+      {
+        std::string       sample_name;
+        SFecHeader        header;
+        std::vector<char> data;
+      };
+
+      explicit CRetransmitWindow(size_t window_size_);
+
+      // stores a copy of the sample [header_][payload_] that was sent with the given fragment layout
+      void Add(const std::string& sample_name_, const SFecHeader& message_header_, const SFecBuffer& header_, const SFecBuffer& payload_);
+
+      // returns copies of the requested data fragments, fragments repaired within the suppression
+      // interval or beyond the repair budget (per nack and per second) are skipped
+      std::vector<SRepairFragment> GetRepairFragments(uint64_t message_id_, const std::vector<uint32_t>& fragments_);
+
+      size_t GetRepairCount() const;
+
+    private:
+      struct SEntry
+      {
+        std::string                                        sample_name;
+        SFecHeader                                         header;
+        std::vector<char>                                  data;
+        std::vector<std::chrono::steady_clock::time_point> last_repair;
+      };
+
+      mutable std::mutex  m_mutex;
+      std::deque<SEntry>  m_entries;
+      size_t              m_window_size;
+      size_t              m_repair_count;
+
+      std::chrono::steady_clock::time_point m_repair_budget_start;
+      size_t                                m_repair_budget_used;
+    };
+  }
+}
@@ -29,22 +29,53 @@
 #include "ecal_udp_sample_receiver_npcap.h"
 #endif
 
+#include "io/udp/ecal_udp_reliable.h"
+
+#include <chrono>
+#include <iostream>
+
 namespace eCAL
 {
   namespace UDP
   {
-    CSampleReceiver::CSampleReceiver(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_)
+    CSampleReceiver::CSampleReceiver(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_) :
+      m_has_sample_callback(has_sample_callback_),
+      m_apply_sample_callback(apply_sample_callback_),
+      m_fec_decoder(nullptr,
+        [this](const std::string& address_, uint16_t port_, uint64_t message_id_, const std::vector<uint32_t>& fragments_) { SendNack(address_, port_, message_id_, fragments_); },
+        attr_.max_sample_size),
+      m_nack_id(attr_.nack_id),
+      m_nack_thread_stop(false),
+      m_nack_thread_started(false)
     {
+      // fec fragments are reassembled here, so the receiver implementations only see complete samples
+      const HasSampleCallbackT   has_sample_callback   = [this](const std::string& sample_name_) { return HasSample(sample_name_); };
+      const ApplySampleCallbackT apply_sample_callback = [this](const char* data_, size_t size_) { ApplySample(data_, size_); };
+
 #ifdef ECAL_CORE_NPCAP_SUPPORT
       if (eCAL::UDP::IsNpcapEnabled())
       {
-        m_sample_receiver = std::make_unique<CSampleReceiverNpcap>(attr_, has_sample_callback_, apply_sample_callback_);
+        m_sample_receiver = std::make_unique<CSampleReceiverNpcap>(attr_, has_sample_callback, apply_sample_callback);
       }
       else
 #endif
       {
-        m_sample_receiver = std::make_unique<CSampleReceiverAsio>(attr_, has_sample_callback_, apply_sample_callback_);
+        m_sample_receiver = std::make_unique<CSampleReceiverAsio>(attr_, has_sample_callback, apply_sample_callback);
+      }
+    }
+
+    CSampleReceiver::~CSampleReceiver()
+    {
+      // stop receiving first, so the nack thread is not restarted
+      m_sample_receiver.reset();
+
+      {
+        const std::lock_guard<std::mutex> lock(m_nack_thread_mutex);
+        m_nack_thread_stop = true;
       }
+      m_nack_thread_cv.notify_all();
+      if (m_nack_thread.joinable())
+        m_nack_thread.join();
     }
 
     bool CSampleReceiver::AddMultiCastGroup(const char* ipaddr_)
@@ -56,5 +87,83 @@ namespace eCAL
     {
       return m_sample_receiver->RemMultiCastGroup(ipaddr_);
     }
+
+    bool CSampleReceiver::HasSample(const std::string& sample_name_)
+    {
+      if (HasFecSampleNamePrefix(sample_name_))
+      {
+        return m_has_sample_callback(StripFecSampleNamePrefix(sample_name_));
+      }
+      return m_has_sample_callback(sample_name_);
+    }
+
+    void CSampleReceiver::ApplySample(const char* serialized_sample_data_, size_t serialized_sample_size_)
+    {
+      // a serialized sample never starts with a zero byte, so fec fragments can be detected safely
+      if (CFecDecoder::IsFecFragment(serialized_sample_data_, serialized_sample_size_))
+      {
+        bool has_reliable_senders(false);
+        {
+          const std::lock_guard<std::mutex> lock(m_fec_mutex);
+          m_fec_decoder.ApplyFragment(serialized_sample_data_, serialized_sample_size_, m_sample_receiver->GetSenderAddress());
+          m_fec_decoder.TakeCompletedSamples(m_fec_completed_samples);
+          has_reliable_senders = m_fec_decoder.HasReliableSenders();
+        }
+        if (has_reliable_senders && !m_nack_thread_started) StartNackThread();
+
+        // completed samples are applied without holding the decoder lock, so a slow
+        // subscriber callback does not delay the nack processing
+        for (const auto& sample : m_fec_completed_samples)
+        {
+          m_apply_sample_callback(sample.data(), sample.size());
+        }
+        m_fec_completed_samples.clear();
+        return;
+      }
+      m_apply_sample_callback(serialized_sample_data_, serialized_sample_size_);
+    }
+
+    void CSampleReceiver::StartNackThread()
+    {
+      // only called from the receive thread, so there is no race on starting the thread
+      m_nack_thread_started = true;
+
+      auto nack_socket = std::make_unique<asio::ip::udp::socket>(m_nack_io_context);
+      asio::error_code ec;
+      nack_socket->open(asio::ip::udp::v4(), ec); // NOLINT(*-unused-return-value)
+      if (ec)
+      {
+        std::cerr << "CSampleReceiver: Unable to open nack socket: " << ec.message() << '\n';
+        return;
+      }
+      m_nack_socket = std::move(nack_socket);
+
+      m_nack_thread = std::thread(&CSampleReceiver::NackThread, this);
+    }
+
+    void CSampleReceiver::NackThread()
+    {
+      const std::chrono::milliseconds nack_check_interval(5);
+
+      std::unique_lock<std::mutex> thread_lock(m_nack_thread_mutex);
+      while (!m_nack_thread_cv.wait_for(thread_lock, nack_check_interval, [this] { return m_nack_thread_stop; }))
+      {
+        const std::lock_guard<std::mutex> lock(m_fec_mutex);
+        m_fec_decoder.ProcessNacks(std::chrono::steady_clock::now());
+      }
+    }
+
+    void CSampleReceiver::SendNack(const std::string& address_, uint16_t port_, uint64_t message_id_, const std::vector<uint32_t>& fragments_)
+    {
+      // called by the fec decoder (locked by m_fec_mutex)
+      if (!m_nack_socket) return;
+
+      asio::error_code ec;
+      const asio::ip::address address = asio::ip::make_address(address_, ec);
+      if (ec) return;
+
+      SerializeNack(m_nack_id, message_id_, fragments_, m_nack_buffer);
+      m_nack_socket->send_to(asio::buffer(m_nack_buffer), asio::ip::udp::endpoint(address, port_), 0, ec); // NOLINT(*-unused-return-value)
+    }
   }
 }
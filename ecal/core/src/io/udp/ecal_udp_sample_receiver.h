@@ -23,9 +23,20 @@
 
 #pragma once
 
+#include "io/udp/ecal_udp_fec.h"
 #include "io/udp/ecal_udp_sample_receiver_base.h"
 
+#include <asio.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace eCAL
 {
@@ -37,11 +48,43 @@ namespace eCAL
     {
     public:
       CSampleReceiver(const SReceiverAttr& attr_, const HasSampleCallbackT& has_sample_callback_, const ApplySampleCallbackT& apply_sample_callback_);
+      ~CSampleReceiver();
+
+      // prevent copying and moving
+      CSampleReceiver(const CSampleReceiver&) = delete;
+      CSampleReceiver& operator=(const CSampleReceiver&) = delete;
+      CSampleReceiver(CSampleReceiver&&) = delete;
+      CSampleReceiver& operator=(CSampleReceiver&&) = delete;
 
       bool AddMultiCastGroup(const char* ipaddr_);
       bool RemMultiCastGroup(const char* ipaddr_);
 
     private:
+      bool HasSample(const std::string& sample_name_);
+      void ApplySample(const char* serialized_sample_data_, size_t serialized_sample_size_);
+
+      void StartNackThread();
+      void NackThread();
+      void SendNack(const std::string& address_, uint16_t port_, uint64_t message_id_, const std::vector<uint32_t>& fragments_);
+
+      HasSampleCallbackT                   m_has_sample_callback;
+      ApplySampleCallbackT                 m_apply_sample_callback;
+
+      std::mutex                           m_fec_mutex;
+      CFecDecoder                          m_fec_decoder;
+      std::vector<std::vector<char>>       m_fec_completed_samples;  // only used by the receive thread
+
+      // reliable mode, the nack thread is only started if fragments of a reliable sender are received
+      asio::io_context                     m_nack_io_context;
+      std::unique_ptr<asio::ip::udp::socket> m_nack_socket;
+      std::vector<char>                    m_nack_buffer;
+      uint64_t                             m_nack_id;
+      std::mutex                           m_nack_thread_mutex;
+      std::condition_variable              m_nack_thread_cv;
+      bool                                 m_nack_thread_stop;
+      std::atomic<bool>                    m_nack_thread_started;
+      std::thread                          m_nack_thread;
+
       std::unique_ptr<CSampleReceiverBase> m_sample_receiver;
     };
   }
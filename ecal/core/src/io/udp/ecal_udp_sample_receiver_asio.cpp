@@ -76,6 +76,11 @@ namespace eCAL
       return JoinMultiCastGroup(ipaddr_);
     }
 
+    std::string CSampleReceiverAsio::GetSenderAddress() const
+    {
+      return m_sender_endpoint.address().to_string();
+    }
+
     bool CSampleReceiverAsio::RemMultiCastGroup(const char* ipaddr_)
     {
       if (!m_broadcast)
@@ -25,6 +25,8 @@
 
 #include "io/udp/ecal_udp_receiver_attr.h"
 
+#include <string>
+
 namespace eCAL
 {
   namespace UDP
@@ -37,6 +39,9 @@ namespace eCAL
       virtual bool AddMultiCastGroup(const char* ipaddr_) = 0;
       virtual bool RemMultiCastGroup(const char* ipaddr_) = 0;
 
+      // address of the sender of the datagram that is currently applied (only valid within the apply sample callback)
+      virtual std::string GetSenderAddress() const = 0;
+
       // prevent copying and moving
       CSampleReceiverBase(const CSampleReceiverBase&) = delete;
       CSampleReceiverBase& operator=(const CSampleReceiverBase&) = delete;
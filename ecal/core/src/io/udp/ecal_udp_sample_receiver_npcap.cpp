@@ -64,6 +64,11 @@ namespace eCAL
       return JoinMultiCastGroup(ipaddr_);
     }
 
+    std::string CSampleReceiverNpcap::GetSenderAddress() const
+    {
+      return m_sender_endpoint.address().to_string();
+    }
+
     bool CSampleReceiverNpcap::RemMultiCastGroup(const char* ipaddr_)
     {
       if (!m_broadcast)
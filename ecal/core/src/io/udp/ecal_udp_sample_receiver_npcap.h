@@ -27,6 +27,7 @@
 
 #include <ecaludp/socket_npcap.h>
 #include <memory>
+#include <string>
 #include <thread>
 
 namespace eCAL
@@ -42,6 +43,8 @@ namespace eCAL
       bool AddMultiCastGroup(const char* ipaddr_) override;
       bool RemMultiCastGroup(const char* ipaddr_) override;
 
+      std::string GetSenderAddress() const override;
+
       // prevent copying and moving
       CSampleReceiverNpcap(const CSampleReceiverNpcap&) = delete;
       CSampleReceiverNpcap& operator=(const CSampleReceiverNpcap&) = delete;
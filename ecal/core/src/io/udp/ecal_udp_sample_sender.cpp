@@ -24,25 +24,72 @@
 #include "ecal_udp_sample_sender.h"
 #include "io/udp/ecal_udp_configurations.h"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <iostream>
 #include <memory>
+#include <thread>
 
 namespace eCAL
 {
   namespace UDP
   {
     CSampleSender::CSampleSender(const SSenderAttr& attr_) :
-      m_destination_endpoint(asio::ip::make_address(attr_.address), static_cast<unsigned short>(attr_.port))
+      m_destination_endpoint(asio::ip::make_address(attr_.address), static_cast<unsigned short>(attr_.port)),
+      m_max_datagram_size(attr_.max_datagram_size),
+      m_fragment_all_samples(attr_.fec_enable || attr_.reliable_enable),
+      m_paced_datagrams(0),
+      m_pacing_delay_us(0)
     {
       m_io_context = std::make_unique<asio::io_context>();
 
       // create the socket and set all socket options
       InitializeSocket(attr_);
+
+      // create the retransmit window and the nack socket (reliable mode, optional)
+      uint16_t nack_port(0);
+      if (attr_.reliable_enable)
+      {
+        m_retransmit_window = std::make_unique<CRetransmitWindow>(static_cast<size_t>(attr_.reliable_window_size));
+        InitializeNackSocket();
+        if (m_nack_socket) nack_port = m_nack_socket->local_endpoint().port();
+      }
+
+      // create the publisher and process send rate pacing (optional)
+      if (attr_.pacing_rate > 0)
+      {
+        m_pacer = std::make_unique<CTokenBucket>(attr_.pacing_rate, attr_.pacing_burst);
+      }
+      if (attr_.process_pacing_rate > 0)
+      {
+        m_process_pacer = GetProcessTokenBucket(attr_.process_pacing_rate, attr_.process_pacing_burst);
+      }
+
+      // create the forward error correction encoder (optional, the reliable mode and the pacing are using its fragmentation too,
+      // the pacing only after all readers announced to reassemble fec fragments)
+      if (m_fragment_all_samples || IsPacingEnabled())
+      {
+        const int parity_count = attr_.fec_enable ? attr_.fec_parity_count : 0;
+        m_fec_encoder = std::make_unique<CFecEncoder>(static_cast<unsigned int>(attr_.fec_block_size), static_cast<unsigned int>(parity_count), nack_port);
+      }
     }
 
     CSampleSender::~CSampleSender()
     {
+      // stop nack receiver, the socket is closed by the nack thread (asio sockets are not thread safe)
+      if (m_nack_socket)
+      {
+        asio::post(*m_nack_io_context, [this]
+          {
+            asio::error_code ec;
+            m_nack_socket->close(ec);
+          });
+        m_nack_work.reset();
+        if (m_nack_thread.joinable())
+          m_nack_thread.join();
+      }
+
       // close socket
       asio::error_code ec;
       m_socket->close(ec);
@@ -107,27 +154,84 @@ namespace eCAL
       m_socket->set_max_udp_datagram_size(attr_.max_datagram_size);
     }
 
+    void CSampleSender::InitializeNackSocket()
+    {
+      m_nack_io_context = std::make_unique<asio::io_context>();
+      m_nack_work       = std::make_unique<work_guard_t>(m_nack_io_context->get_executor());
+
+      // bind to an ephemeral port, the port is announced in every fragment header
+      auto nack_socket = std::make_unique<asio::ip::udp::socket>(*m_nack_io_context);
+      asio::error_code ec;
+      nack_socket->open(asio::ip::udp::v4(), ec); // NOLINT(*-unused-return-value)
+      if (!ec) nack_socket->bind(asio::ip::udp::endpoint(asio::ip::udp::v4(), 0), ec); // NOLINT(*-unused-return-value)
+      if (ec)
+      {
+        std::cerr << "CSampleSender: Unable to open nack socket, reliable mode disabled: " << ec.message() << '\n';
+        return;
+      }
+      m_nack_socket = std::move(nack_socket);
+
+      m_nack_thread = std::thread([this] { m_nack_io_context->run(); });
+      ReceiveNack();
+    }
+
     size_t CSampleSender::Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_)
+    {
+      return Send(sample_name_, serialized_sample_, nullptr, 0);
+    }
+
+    size_t CSampleSender::Send(const std::string& sample_name_, const std::vector<char>& serialized_header_, const char* payload_, size_t payload_size_)
     {
       // ------------------------------------------------
       // emulate old protocol
       // 
       // s1 = size of the sample name
-      // s2 = size of the serialized sample payload
+      // s2 = size of the serialized sample header
+      // s3 = size of the (not serialized) sample payload
       // 
       //  2 Bytes sample name size (unsigned short)
       // s1 Bytes sample name
-      // s2 Bytes serialized sample
+      // s2 Bytes serialized sample header
+      // s3 Bytes sample payload
+      //
+      // header and payload together form the serialized sample,
+      // the payload is handed over to the socket without copying it
       // ------------------------------------------------
       const unsigned short s1 = static_cast<unsigned short>(sample_name_.size()) + 1 /*'\0'*/;
-      const size_t         s2 = serialized_sample_.size();
+      const size_t         s2 = serialized_header_.size();
+
+      if (m_fec_encoder)
+      {
+        // paced samples that do not fit into a single fragment are fragmented by us,
+        // so the fragments can be paced one by one (older readers drop fec fragments,
+        // they get the sample fragmented by the socket and paced as a whole)
+        const bool fragment_sample = m_fragment_all_samples
+          || (m_pacing_fragmentation && (static_cast<int>(s2 + payload_size_) > GetFragmentSize(GetFecSampleNamePrefix() + sample_name_)));
+        if (fragment_sample)
+        {
+          return SendFec(sample_name_, serialized_header_, payload_, payload_size_);
+        }
+      }
+
+      Pace(sizeof(s1) + s1 + s2 + payload_size_);
+
       const asio::const_buffer sample_name_size_asio_buffer(&s1, 2);
       const asio::const_buffer sample_name_asio_buffer(sample_name_.c_str(), s1); // we need to use c_str() here to guarantee  trailling \'0'
-      const asio::const_buffer serialized_sample_asio_buffer(serialized_sample_.data(), s2);
+      const asio::const_buffer serialized_header_asio_buffer(serialized_header_.data(), s2);
 
       const asio::socket_base::message_flags flags(0);
       asio::error_code ec;
-      const size_t sent = m_socket->send_to({ sample_name_size_asio_buffer, sample_name_asio_buffer, serialized_sample_asio_buffer }, m_destination_endpoint, flags, ec);
+      size_t sent(0);
+      const std::lock_guard<std::mutex> lock(m_socket_mutex);
+      if ((payload_ != nullptr) && (payload_size_ > 0))
+      {
+        const asio::const_buffer payload_asio_buffer(payload_, payload_size_);
+        sent = m_socket->send_to({ sample_name_size_asio_buffer, sample_name_asio_buffer, serialized_header_asio_buffer, payload_asio_buffer }, m_destination_endpoint, flags, ec);
+      }
+      else
+      {
+        sent = m_socket->send_to({ sample_name_size_asio_buffer, sample_name_asio_buffer, serialized_header_asio_buffer }, m_destination_endpoint, flags, ec);
+      }
       if (ec)
       {
         std::cout << "CSampleSender::Send failed with: \'" << ec.message() << "\'" << '\n';
@@ -135,5 +239,158 @@ namespace eCAL
       }
       return sent;
     }
+
+    size_t CSampleSender::SendFec(const std::string& sample_name_, const std::vector<char>& serialized_header_, const char* payload_, size_t payload_size_)
+    {
+      // ------------------------------------------------
+      // forward error correction / reliable protocol
+      //
+      // every fragment is sent as its own datagram
+      //
+      //  2 Bytes sample name size (unsigned short)
+      // s1 Bytes fec prefix + sample name
+      // 40 Bytes fec header
+      // s2 Bytes data or parity fragment
+      //
+      // the fragment size is chosen small enough that ecaludp does not need to split the datagram again
+      // ------------------------------------------------
+      const std::string fec_sample_name = GetFecSampleNamePrefix() + sample_name_;
+
+      const int fragment_size = GetFragmentSize(fec_sample_name);
+      if (fragment_size <= 0)
+      {
+        std::cerr << "CSampleSender::SendFec failed: max datagram size too small for fec fragments" << '\n';
+        return 0;
+      }
+
+      const SFecBuffer header { serialized_header_.data(), serialized_header_.size() };
+      const SFecBuffer payload{ payload_, payload_size_ };
+      SFecHeader message_header;
+      const size_t sent = m_fec_encoder->Encode(static_cast<size_t>(fragment_size), header, payload,
+        [&](const SFecHeader& fec_header_, const std::array<SFecBuffer, 2>& parts_) -> size_t
+        {
+          message_header = fec_header_;
+          return SendFragment(fec_sample_name, fec_header_, parts_);
+        });
+
+      // keep the sample for repairs
+      if (m_retransmit_window && (sent > 0))
+      {
+        m_retransmit_window->Add(fec_sample_name, message_header, header, payload);
+      }
+
+      return sent;
+    }
+
+    size_t CSampleSender::SendFragment(const std::string& fec_sample_name_, const SFecHeader& fec_header_, const std::array<SFecBuffer, 2>& parts_)
+    {
+      const unsigned short s1 = static_cast<unsigned short>(fec_sample_name_.size()) + 1 /*'\0'*/;
+      std::vector<asio::const_buffer> buffers{ asio::const_buffer(&s1, 2), asio::const_buffer(fec_sample_name_.c_str(), s1), asio::const_buffer(&fec_header_, sizeof(SFecHeader)) };
+      for (const auto& part : parts_)
+      {
+        if (part.size > 0) buffers.emplace_back(part.data, part.size);
+      }
+
+      Pace(sizeof(s1) + s1 + sizeof(SFecHeader) + parts_[0].size + parts_[1].size);
+
+      const asio::socket_base::message_flags flags(0);
+      asio::error_code ec;
+      size_t sent(0);
+      {
+        // fragments are sent by the publisher and (repairs) by the nack receiver thread
+        const std::lock_guard<std::mutex> lock(m_socket_mutex);
+        sent = m_socket->send_to(buffers, m_destination_endpoint, flags, ec);
+      }
+      if (ec)
+      {
+        std::cout << "CSampleSender::SendFragment failed with: \'" << ec.message() << "\'" << '\n';
+        return 0;
+      }
+      return sent;
+    }
+
+    int CSampleSender::GetFragmentSize(const std::string& fec_sample_name_) const
+    {
+      // keep some space for the ecaludp header
+      const int ecaludp_header_reserve = 64;
+      return m_max_datagram_size - ecaludp_header_reserve - static_cast<int>(sizeof(unsigned short) + fec_sample_name_.size() + 1 + sizeof(SFecHeader));
+    }
+
+    bool CSampleSender::IsPacingEnabled() const
+    {
+      return m_pacer || m_process_pacer;
+    }
+
+    void CSampleSender::Pace(size_t size_)
+    {
+      if (!IsPacingEnabled()) return;
+
+      // both buckets are charged, the longer wait wins
+      const auto now = std::chrono::steady_clock::now();
+      auto wait = std::chrono::steady_clock::duration::zero();
+      if (m_pacer)         wait = std::max(wait, m_pacer->Reserve(size_, now));
+      if (m_process_pacer) wait = std::max(wait, m_process_pacer->Reserve(size_, now));
+      if (wait <= std::chrono::steady_clock::duration::zero()) return;
+
+      std::this_thread::sleep_for(wait);
+
+      m_paced_datagrams++;
+      m_pacing_delay_us += std::chrono::duration_cast<std::chrono::microseconds>(wait).count();
+    }
+
+    SPacingStatistics CSampleSender::GetPacingStatistics() const
+    {
+      SPacingStatistics statistics;
+      if (m_pacer)         statistics.rate = m_pacer->GetRate();
+      if (m_process_pacer) statistics.rate = (statistics.rate > 0) ? std::min(statistics.rate, m_process_pacer->GetRate()) : m_process_pacer->GetRate();
+      statistics.delayed_datagrams = m_paced_datagrams;
+      statistics.delay_us          = m_pacing_delay_us;
+      return statistics;
+    }
+
+    void CSampleSender::SetPacingFragmentation(bool enable_)
+    {
+      m_pacing_fragmentation = enable_ && IsPacingEnabled();
+    }
+
+    void CSampleSender::SetNackIds(const std::set<uint64_t>& nack_ids_)
+    {
+      const std::lock_guard<std::mutex> lock(m_nack_ids_mutex);
+      m_nack_ids = nack_ids_;
+    }
+
+    void CSampleSender::ReceiveNack()
+    {
+      m_nack_socket->async_receive_from(asio::buffer(m_nack_buffer), m_nack_sender_endpoint,
+        [this](asio::error_code ec, std::size_t length)
+        {
+          // triggered by m_nack_socket->close in destructor
+          if ((ec == asio::error::operation_aborted) || !m_nack_socket->is_open()) return;
+
+          if (!ec) OnNack(m_nack_buffer.data(), length);
+          ReceiveNack();
+        });
+    }
+
+    void CSampleSender::OnNack(const char* data_, size_t size_)
+    {
+      uint64_t              nack_id(0);
+      uint64_t              message_id(0);
+      std::vector<uint32_t> fragments;
+      if (!DeserializeNack(data_, size_, nack_id, message_id, fragments)) return;
+
+      // ignore nacks of processes that do not subscribe this topic
+      {
+        const std::lock_guard<std::mutex> lock(m_nack_ids_mutex);
+        if (m_nack_ids.find(nack_id) == m_nack_ids.end()) return;
+      }
+
+      // repairs are sent via multicast, so every receiver that lost the same fragments gets them
+      for (const auto& fragment : m_retransmit_window->GetRepairFragments(message_id, fragments))
+      {
+        const std::array<SFecBuffer, 2> parts{ { SFecBuffer{ fragment.data.data(), fragment.data.size() }, SFecBuffer{} } };
+        SendFragment(fragment.sample_name, fragment.header, parts);
+      }
+    }
   }
 }
@@ -23,11 +23,21 @@
 
 #pragma once
 
+#include "io/udp/ecal_udp_fec.h"
+#include "io/udp/ecal_udp_pacing.h"
+#include "io/udp/ecal_udp_reliable.h"
 #include "io/udp/ecal_udp_sender_attr.h"
 
 #include <ecaludp/socket.h>
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace eCAL
@@ -41,13 +51,57 @@ namespace eCAL
       virtual ~CSampleSender();
 
       size_t Send(const std::string& sample_name_, const std::vector<char>& serialized_sample_);
+      size_t Send(const std::string& sample_name_, const std::vector<char>& serialized_header_, const char* payload_, size_t payload_size_);
+
+      SPacingStatistics GetPacingStatistics() const;
+
+      // paced senders fragment large samples themselves (fec framing), only if all readers reassemble fec fragments
+      void SetPacingFragmentation(bool enable_);
+
+      // reliable mode, only nacks of these ids (announced by the subscribers) are answered
+      void SetNackIds(const std::set<uint64_t>& nack_ids_);
 
     private:
       void InitializeSocket(const SSenderAttr& attr_);
+      void InitializeNackSocket();
+
+      size_t SendFec(const std::string& sample_name_, const std::vector<char>& serialized_header_, const char* payload_, size_t payload_size_);
+      size_t SendFragment(const std::string& fec_sample_name_, const SFecHeader& fec_header_, const std::array<SFecBuffer, 2>& parts_);
+
+      int  GetFragmentSize(const std::string& fec_sample_name_) const;
+      bool IsPacingEnabled() const;
+      void Pace(size_t size_);
+
+      void ReceiveNack();
+      void OnNack(const char* data_, size_t size_);
 
       std::unique_ptr<asio::io_context>       m_io_context;
       std::unique_ptr<ecaludp::Socket>        m_socket;
       asio::ip::udp::endpoint                 m_destination_endpoint;
+      std::mutex                              m_socket_mutex;
+
+      int                                     m_max_datagram_size;
+      std::unique_ptr<CFecEncoder>            m_fec_encoder;
+      bool                                    m_fragment_all_samples;
+
+      // send rate pacing (publisher and process wide token bucket)
+      std::unique_ptr<CTokenBucket>           m_pacer;
+      std::shared_ptr<CTokenBucket>           m_process_pacer;
+      std::atomic<int64_t>                    m_paced_datagrams;
+      std::atomic<int64_t>                    m_pacing_delay_us;
+      std::atomic<bool>                       m_pacing_fragmentation{ false };
+
+      // reliable mode (nack receiver and retransmit window)
+      std::unique_ptr<CRetransmitWindow>      m_retransmit_window;
+      std::unique_ptr<asio::io_context>       m_nack_io_context;
+      using work_guard_t = asio::executor_work_guard<asio::io_context::executor_type>;
+      std::unique_ptr<work_guard_t>           m_nack_work;
+      std::unique_ptr<asio::ip::udp::socket>  m_nack_socket;
+      asio::ip::udp::endpoint                 m_nack_sender_endpoint;
+      std::array<char, 64 * 1024>             m_nack_buffer{};
+      std::thread                             m_nack_thread;
+      std::mutex                              m_nack_ids_mutex;
+      std::set<uint64_t>                      m_nack_ids;
     };
   }
 }
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace eCAL
@@ -38,6 +39,18 @@ namespace eCAL
       bool        loopback  = true;
       int         sndbuf    = 1024 * 1024;
       int         max_datagram_size = 64 * 1024 - 8 - 20 - 1; // 65507: max IPv4 UDP payload = 64 KiB - 20 (IP header) - 8 (UDP header) - 1
+
+      bool        fec_enable        = false;
+      int         fec_block_size    = 16;
+      int         fec_parity_count  = 2;
+
+      bool        reliable_enable      = false;
+      int         reliable_window_size = 16;
+
+      unsigned int pacing_rate          = 0;          // publisher send rate limit in bytes per second (0 = unlimited)
+      unsigned int pacing_burst         = 64 * 1024;  // publisher burst size in bytes
+      unsigned int process_pacing_rate  = 0;          // process send rate limit in bytes per second (0 = unlimited)
+      unsigned int process_pacing_burst = 256 * 1024; // process burst size in bytes
     };
   }
 }
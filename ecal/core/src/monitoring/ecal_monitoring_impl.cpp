@@ -155,11 +155,24 @@ namespace eCAL
     bool               topic_tlayer_ecal_udp(false);
     bool               topic_tlayer_ecal_shm(false);
     bool               topic_tlayer_ecal_tcp(false);
+    bool               topic_tlayer_ecal_inproc(false);
+    bool               topic_tlayer_ecal_uds(false);
+    Registration::LayerParUdpMC topic_tlayer_ecal_udp_par;
+    Registration::LayerParTcp   topic_tlayer_ecal_tcp_par;
+    std::map<eTLayerType, std::vector<Monitoring::SLayerStatistics>> topic_tlayer_statistics;
     for (const auto& layer : sample_topic.transport_layer)
     {
+      for (const auto& layer_statistics : layer.statistics)
+      {
+        topic_tlayer_statistics[layer.type].push_back({ layer_statistics.size_class, layer_statistics.samples, layer_statistics.cost_us, layer_statistics.selected });
+      }
+      if (layer.type == tl_ecal_udp) topic_tlayer_ecal_udp_par = layer.par_layer.layer_par_udpmc;
+      if (layer.type == tl_ecal_tcp) topic_tlayer_ecal_tcp_par = layer.par_layer.layer_par_tcp;
       topic_tlayer_ecal_udp |= (layer.type == tl_ecal_udp) && layer.active;
       topic_tlayer_ecal_shm |= (layer.type == tl_ecal_shm) && layer.active;
       topic_tlayer_ecal_tcp |= (layer.type == tl_ecal_tcp) && layer.active;
+      topic_tlayer_ecal_inproc |= (layer.type == tl_ecal_inproc) && layer.active;
+      topic_tlayer_ecal_uds |= (layer.type == tl_ecal_uds) && layer.active;
     }
     const int32_t      connections_local = sample_topic.connections_local;
     const int32_t      connections_external = sample_topic.connections_external;
@@ -168,6 +181,11 @@ namespace eCAL
     const int32_t      message_drops = sample_topic.message_drops;
     const int32_t      data_frequency = sample_topic.data_frequency;
     const auto&        data_latency_us = sample_topic.latency_us;
+    const int32_t      receive_queue_depth = sample_topic.receive_queue_depth;
+    const int32_t      receive_queue_size = sample_topic.receive_queue_size;
+    const int32_t      receive_queue_high_water_mark = sample_topic.receive_queue_high_water_mark;
+    const int32_t      receive_queue_drops = sample_topic.receive_queue_drops;
+    const int32_t      max_frequency = sample_topic.max_frequency;
 
     /////////////////////////////////
     // register in topic map
@@ -227,6 +245,10 @@ namespace eCAL
         eCAL::Monitoring::STransportLayer transport_layer;
         transport_layer.type   = eCAL::Monitoring::eTransportLayerType::udp_mc;
         transport_layer.active = topic_tlayer_ecal_udp;
+        transport_layer.statistics = std::move(topic_tlayer_statistics[tl_ecal_udp]);
+        transport_layer.pacing_rate              = topic_tlayer_ecal_udp_par.pacing_rate;
+        transport_layer.pacing_delayed_datagrams = topic_tlayer_ecal_udp_par.pacing_delayed_datagrams;
+        transport_layer.pacing_delay_us          = topic_tlayer_ecal_udp_par.pacing_delay_us;
         TopicInfo.transport_layer.push_back(transport_layer);
       }
       // transport_layer shm
@@ -234,6 +256,7 @@ namespace eCAL
         eCAL::Monitoring::STransportLayer transport_layer;
         transport_layer.type   = eCAL::Monitoring::eTransportLayerType::shm;
         transport_layer.active = topic_tlayer_ecal_shm;
+        transport_layer.statistics = std::move(topic_tlayer_statistics[tl_ecal_shm]);
         TopicInfo.transport_layer.push_back(transport_layer);
       }
       // transport_layer tcp
@@ -241,6 +264,24 @@ namespace eCAL
         eCAL::Monitoring::STransportLayer transport_layer;
         transport_layer.type   = eCAL::Monitoring::eTransportLayerType::tcp;
         transport_layer.active = topic_tlayer_ecal_tcp;
+        transport_layer.statistics = std::move(topic_tlayer_statistics[tl_ecal_tcp]);
+        transport_layer.connection_count = topic_tlayer_ecal_tcp_par.connection_count;
+        TopicInfo.transport_layer.push_back(transport_layer);
+      }
+      // transport_layer inproc
+      {
+        eCAL::Monitoring::STransportLayer transport_layer;
+        transport_layer.type   = eCAL::Monitoring::eTransportLayerType::inproc;
+        transport_layer.active = topic_tlayer_ecal_inproc;
+        transport_layer.statistics = std::move(topic_tlayer_statistics[tl_ecal_inproc]);
+        TopicInfo.transport_layer.push_back(transport_layer);
+      }
+      // transport_layer uds
+      {
+        eCAL::Monitoring::STransportLayer transport_layer;
+        transport_layer.type   = eCAL::Monitoring::eTransportLayerType::uds;
+        transport_layer.active = topic_tlayer_ecal_uds;
+        transport_layer.statistics = std::move(topic_tlayer_statistics[tl_ecal_uds]);
         TopicInfo.transport_layer.push_back(transport_layer);
       }
 
@@ -257,6 +298,11 @@ namespace eCAL
       TopicInfo.data_latency_us.max       = data_latency_us.max;
       TopicInfo.data_latency_us.mean      = data_latency_us.mean;
       TopicInfo.data_latency_us.variance  = data_latency_us.variance;
+      TopicInfo.receive_queue_depth           = receive_queue_depth;
+      TopicInfo.receive_queue_size            = receive_queue_size;
+      TopicInfo.receive_queue_high_water_mark = receive_queue_high_water_mark;
+      TopicInfo.receive_queue_drops           = receive_queue_drops;
+      TopicInfo.max_frequency                 = max_frequency;
     }
 
     return(true);
@@ -34,6 +34,9 @@ namespace eCAL
     attributes.network_enabled            = config_.communication_mode == eCAL::eCommunicationMode::network;
     attributes.loopback                   = registration_config.loopback;
     attributes.drop_out_of_order_messages = subscriber_config.drop_out_of_order_messages;
+    attributes.max_frequency_hz           = subscriber_config.max_frequency_hz;
+    attributes.receive_history            = subscriber_config.receive_history;
+    attributes.read_buffer_depth          = subscriber_config.read_buffer_depth;
     attributes.registration_timeout_ms    = registration_config.registration_timeout;
     attributes.topic_name                 = topic_name_;
     attributes.host_name                  = Process::GetHostName();
@@ -46,6 +49,7 @@ namespace eCAL
     attributes.udp.broadcast     = config_.communication_mode == eCAL::eCommunicationMode::local;
     attributes.udp.port          = transport_layer_config.udp.port;
     attributes.udp.receivebuffer = transport_layer_config.udp.receive_buffer;
+    attributes.udp.max_sample_size = transport_layer_config.udp.max_sample_size;
     
     switch (config_.communication_mode)
     {
@@ -64,6 +68,15 @@ namespace eCAL
     attributes.tcp.max_reconnection_attempts = transport_layer_config.tcp.max_reconnections;
     
     attributes.shm.enable = subscriber_config.layer.shm.enable;
+
+    attributes.inproc.enable = subscriber_config.layer.inproc.enable;
+
+    attributes.uds.enable          = subscriber_config.layer.uds.enable;
+    attributes.uds.max_sample_size = transport_layer_config.uds.max_sample_size;
+
+    attributes.receive_queue.depth           = subscriber_config.receive_queue.depth;
+    attributes.receive_queue.overflow_policy = subscriber_config.receive_queue.overflow_policy;
+    attributes.receive_queue.executor        = subscriber_config.receive_queue.executor;
     
     return attributes;
   }
@@ -37,6 +37,14 @@ namespace eCAL
     attributes.layer_priority_local    = publisher_config.layer_priority_local;
     attributes.layer_priority_remote   = publisher_config.layer_priority_remote;
 
+    attributes.adaptive_layer_selection.enable             = publisher_config.adaptive_layer_selection.enable;
+    attributes.adaptive_layer_selection.hysteresis_percent = publisher_config.adaptive_layer_selection.hysteresis_percent;
+    attributes.adaptive_layer_selection.probe_interval     = publisher_config.adaptive_layer_selection.probe_interval;
+    attributes.adaptive_layer_selection.min_samples        = publisher_config.adaptive_layer_selection.min_samples;
+
+    attributes.concurrent_send         = publisher_config.concurrent_send;
+    attributes.history_depth           = publisher_config.history_depth;
+
     attributes.host_name            = Process::GetHostName();
     attributes.shm_transport_domain = Process::GetShmTransportDomain();
     attributes.process_id           = Process::GetProcessID();
@@ -56,6 +64,21 @@ namespace eCAL
     attributes.udp.port          = transport_tlayer_config.udp.port;
     attributes.udp.send_buffer   = transport_tlayer_config.udp.send_buffer;
     attributes.udp.max_datagram_size = transport_tlayer_config.udp.max_datagram_size;
+
+    attributes.udp.fec_enable       = publisher_config.layer.udp.fec_enable;
+    attributes.udp.fec_block_size   = publisher_config.layer.udp.fec_block_size;
+    attributes.udp.fec_parity_count = publisher_config.layer.udp.fec_parity_count;
+
+    attributes.udp.reliable_enable      = publisher_config.layer.udp.reliable_enable;
+    attributes.udp.reliable_window_size = publisher_config.layer.udp.reliable_window_size;
+
+    attributes.udp.pacing_rate          = publisher_config.layer.udp.pacing_rate_bytes_per_second;
+    attributes.udp.pacing_burst         = publisher_config.layer.udp.pacing_burst_bytes;
+    attributes.udp.process_pacing_rate  = transport_tlayer_config.udp.pacing_rate_bytes_per_second;
+    attributes.udp.process_pacing_burst = transport_tlayer_config.udp.pacing_burst_bytes;
+
+    attributes.udp.coalescing_max_delay_us = publisher_config.layer.udp.coalescing_max_delay_us;
+    attributes.udp.coalescing_max_size     = publisher_config.layer.udp.coalescing_max_size_bytes;
     
     switch (config_.communication_mode)
     {
@@ -74,6 +97,15 @@ namespace eCAL
     
     attributes.tcp.enable           = publisher_config.layer.tcp.enable;
     attributes.tcp.thread_pool_size = transport_tlayer_config.tcp.number_executor_writer;
+
+    attributes.tcp.coalescing_max_delay_us = publisher_config.layer.tcp.coalescing_max_delay_us;
+    attributes.tcp.coalescing_max_size     = publisher_config.layer.tcp.coalescing_max_size_bytes;
+
+    attributes.inproc.enable        = publisher_config.layer.inproc.enable;
+
+    attributes.uds.enable           = publisher_config.layer.uds.enable;
+    attributes.uds.socket_directory = transport_tlayer_config.uds.socket_directory;
+    attributes.uds.memfd_min_size   = publisher_config.layer.uds.memfd_min_size_bytes;
     
     return attributes;
   }
@@ -0,0 +1,395 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL adaptive transport layer selection
+**/
+
+#include "ecal_adaptive_layer_selection.h"
+
+#include <algorithm>
+
+namespace
+{
+  // smoothing factor of the moving averages (weight of the newest measurement window)
+  constexpr double ewma_alpha  = 0.25;
+  // a lost sample costs as much as delivering ten samples
+  constexpr double loss_weight = 10.0;
+
+  double Smooth(double average_, double value_, bool valid_)
+  {
+    return valid_ ? (average_ + ewma_alpha * (value_ - average_)) : value_;
+  }
+
+  eCAL::eTLayerType LayerType(int layer_index_)
+  {
+    switch (layer_index_)
+    {
+    case 0:  return eCAL::tl_ecal_udp;
+    case 1:  return eCAL::tl_ecal_shm;
+    case 2:  return eCAL::tl_ecal_tcp;
+    case 3:  return eCAL::tl_ecal_uds;
+    default: return eCAL::tl_none;
+    }
+  }
+}
+
+namespace eCAL
+{
+  namespace AdaptiveLayerSelection
+  {
+    int SizeClass(size_t size_)
+    {
+      int    size_class(0);
+      size_t upper_bound(2048);
+      while ((size_ >= upper_bound) && (size_class < size_class_count - 1))
+      {
+        upper_bound <<= 1;
+        ++size_class;
+      }
+      return size_class;
+    }
+
+    int LayerIndex(eTLayerType layer_)
+    {
+      switch (layer_)
+      {
+      case tl_ecal_udp: return 0;
+      case tl_ecal_shm: return 1;
+      case tl_ecal_tcp: return 2;
+      case tl_ecal_uds: return 3;
+      default:          return -1;
+      }
+    }
+
+    int LayerIndex(TransportLayer::eType layer_)
+    {
+      switch (layer_)
+      {
+      case TransportLayer::eType::udp_mc: return 0;
+      case TransportLayer::eType::shm:    return 1;
+      case TransportLayer::eType::tcp:    return 2;
+      case TransportLayer::eType::uds:    return 3;
+      default:                            return -1;
+      }
+    }
+
+    LayerMaskT LayerMask(TransportLayer::eType layer_)
+    {
+      const int layer_index = LayerIndex(layer_);
+      return (layer_index < 0) ? 0 : (LayerMaskT(1) << layer_index);
+    }
+  }
+
+  ////////////////////////////////////////
+  // CLayerStatisticsCollector
+  ////////////////////////////////////////
+  void CLayerStatisticsCollector::AddSample(eTLayerType layer_, EntityIdT publisher_id_, size_t size_, long long latency_us_)
+  {
+    const int layer_index = AdaptiveLayerSelection::LayerIndex(layer_);
+    if (layer_index < 0) return;
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    auto iter = m_publication_map.find(publisher_id_);
+    if (iter == m_publication_map.end()) return;
+
+    auto& counter = iter->second.layers[layer_index][AdaptiveLayerSelection::SizeClass(size_)];
+    counter.samples++;
+    counter.latency_us_sum += std::max(latency_us_, 0LL);
+  }
+
+  void CLayerStatisticsCollector::SetReportingEnabled(EntityIdT publisher_id_, bool enabled_)
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (enabled_)
+    {
+      m_publication_map.emplace(publisher_id_, SPublication());
+    }
+    else
+    {
+      m_publication_map.erase(publisher_id_);
+    }
+    m_enabled = !m_publication_map.empty();
+  }
+
+  void CLayerStatisticsCollector::RemovePublisher(EntityIdT publisher_id_)
+  {
+    SetReportingEnabled(publisher_id_, false);
+  }
+
+  void CLayerStatisticsCollector::GetStatistics(eTLayerType layer_, Util::CExpandingVector<Registration::LayerStatistics>& statistics_) const
+  {
+    const int layer_index = AdaptiveLayerSelection::LayerIndex(layer_);
+    if (layer_index < 0) return;
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& publication : m_publication_map)
+    {
+      const auto& size_class_counter = publication.second.layers[layer_index];
+      for (int size_class = 0; size_class < AdaptiveLayerSelection::size_class_count; ++size_class)
+      {
+        const auto& counter = size_class_counter[size_class];
+        if (counter.samples == 0) continue;
+
+        auto& statistics = statistics_.push_back();
+        statistics.publisher_id   = publication.first;
+        statistics.size_class     = size_class;
+        statistics.samples        = counter.samples;
+        statistics.latency_us_sum = counter.latency_us_sum;
+      }
+    }
+  }
+
+  ////////////////////////////////////////
+  // CAdaptiveLayerSelector
+  ////////////////////////////////////////
+  CAdaptiveLayerSelector::CAdaptiveLayerSelector(const eCALWriter::SAdaptiveLayerSelectionAttributes& attr_)
+    : m_attributes(attr_)
+  {
+  }
+
+  CAdaptiveLayerSelector::LayerMaskT CAdaptiveLayerSelector::GetSendLayers(size_t size_)
+  {
+    const int size_class = AdaptiveLayerSelection::SizeClass(size_);
+
+    // every probe_interval'th sample of a size class is sent on all candidate layers
+    // to keep the measurements of the currently unselected layers up to date
+    const uint64_t sample_count = m_size_class_counter[size_class].fetch_add(1, std::memory_order_relaxed);
+    if ((m_attributes.probe_interval > 0) && (sample_count % m_attributes.probe_interval == 0))
+    {
+      return m_candidate_layers.load(std::memory_order_relaxed);
+    }
+    return m_send_layers[size_class].load(std::memory_order_relaxed);
+  }
+
+  void CAdaptiveLayerSelector::AddSendTime(TransportLayer::eType layer_, size_t size_, std::chrono::steady_clock::duration send_time_)
+  {
+    const int layer_index = AdaptiveLayerSelection::LayerIndex(layer_);
+    if (layer_index < 0) return;
+
+    const std::lock_guard<std::mutex> lock(m_send_mutex);
+    auto& statistics = m_send_statistics[layer_index][AdaptiveLayerSelection::SizeClass(size_)];
+    statistics.samples++;
+    statistics.window_samples++;
+    statistics.window_send_time_us += std::chrono::duration<double, std::micro>(send_time_).count();
+  }
+
+  void CAdaptiveLayerSelector::ApplySubscription(const SSubscriptionInfo& subscription_, LayerMaskT candidate_layers_, TransportLayer::eType initial_layer_)
+  {
+    const std::lock_guard<std::mutex> lock(m_subscription_mutex);
+    auto iter = m_subscription_map.find(subscription_);
+    if (iter == m_subscription_map.end())
+    {
+      SSubscription subscription;
+      subscription.selected_layer.fill(AdaptiveLayerSelection::LayerIndex(initial_layer_));
+      iter = m_subscription_map.emplace(subscription_, subscription).first;
+    }
+    iter->second.candidate_layers = candidate_layers_;
+
+    UpdateSendLayers();
+  }
+
+  void CAdaptiveLayerSelector::ApplyStatistics(const SSubscriptionInfo& subscription_, eTLayerType layer_, const Registration::LayerStatistics& statistics_)
+  {
+    const int layer_index = AdaptiveLayerSelection::LayerIndex(layer_);
+    if ((layer_index < 0) || (statistics_.size_class < 0) || (statistics_.size_class >= AdaptiveLayerSelection::size_class_count)) return;
+
+    int64_t sent(0);
+    {
+      const std::lock_guard<std::mutex> lock(m_send_mutex);
+      sent = m_send_statistics[layer_index][statistics_.size_class].samples;
+    }
+
+    const std::lock_guard<std::mutex> lock(m_subscription_mutex);
+    auto iter = m_subscription_map.find(subscription_);
+    if (iter == m_subscription_map.end()) return;
+
+    auto& receive = iter->second.receive[layer_index][statistics_.size_class];
+    if (receive.reported)
+    {
+      const int64_t received_delta = statistics_.samples - receive.received;
+      const int64_t sent_delta     = sent - receive.sent;
+
+      // the reports reach us with some delay, so the received samples are compared
+      // to the samples sent in between the last two reports (good enough for a steady stream)
+      if ((received_delta > 0) && (sent_delta > 0))
+      {
+        const double latency_us = static_cast<double>(statistics_.latency_us_sum - receive.latency_us_sum) / static_cast<double>(received_delta);
+        const double loss       = std::max(0.0, 1.0 - static_cast<double>(received_delta) / static_cast<double>(sent_delta));
+        const bool   valid      = receive.measured > 0;
+        receive.latency_us = Smooth(receive.latency_us, latency_us, valid);
+        receive.loss       = Smooth(receive.loss, loss, valid);
+        receive.measured  += received_delta;
+      }
+      else if ((received_delta <= 0) && (sent_delta > 0) && (receive.measured > 0))
+      {
+        // nothing arrived on this layer although we sent on it
+        receive.loss = Smooth(receive.loss, 1.0, true);
+      }
+    }
+
+    receive.reported       = true;
+    receive.received       = statistics_.samples;
+    receive.latency_us_sum = statistics_.latency_us_sum;
+    receive.sent           = sent;
+  }
+
+  void CAdaptiveLayerSelector::RemoveSubscription(const SSubscriptionInfo& subscription_)
+  {
+    const std::lock_guard<std::mutex> lock(m_subscription_mutex);
+    m_subscription_map.erase(subscription_);
+
+    UpdateSendLayers();
+  }
+
+  void CAdaptiveLayerSelector::Evaluate()
+  {
+    // collect the send times of the last period
+    std::array<std::array<SSendStatistics, AdaptiveLayerSelection::size_class_count>, AdaptiveLayerSelection::layer_count> send_statistics;
+    {
+      const std::lock_guard<std::mutex> lock(m_send_mutex);
+      send_statistics = m_send_statistics;
+      for (auto& size_class_statistics : m_send_statistics)
+      {
+        for (auto& statistics : size_class_statistics)
+        {
+          statistics.window_samples      = 0;
+          statistics.window_send_time_us = 0.0;
+        }
+      }
+    }
+
+    const std::lock_guard<std::mutex> lock(m_subscription_mutex);
+    for (int layer_index = 0; layer_index < AdaptiveLayerSelection::layer_count; ++layer_index)
+    {
+      for (int size_class = 0; size_class < AdaptiveLayerSelection::size_class_count; ++size_class)
+      {
+        const auto& statistics = send_statistics[layer_index][size_class];
+        if (statistics.window_samples == 0) continue;
+
+        auto& cost = m_send_cost[layer_index][size_class];
+        cost.send_us = Smooth(cost.send_us, statistics.window_send_time_us / static_cast<double>(statistics.window_samples), cost.valid);
+        cost.valid   = true;
+      }
+    }
+
+    // switch to a cheaper layer only if it beats the selected one by more than the hysteresis
+    const double switch_factor = 1.0 - std::min(m_attributes.hysteresis_percent, 100U) / 100.0;
+    for (auto& subscription_iter : m_subscription_map)
+    {
+      auto& subscription = subscription_iter.second;
+      for (int size_class = 0; size_class < AdaptiveLayerSelection::size_class_count; ++size_class)
+      {
+        const int selected_layer = subscription.selected_layer[size_class];
+        double selected_cost(0.0);
+        if (!GetCost(subscription, selected_layer, size_class, selected_cost)) continue;
+
+        int    best_layer(selected_layer);
+        double best_cost(selected_cost);
+        for (int layer_index = 0; layer_index < AdaptiveLayerSelection::layer_count; ++layer_index)
+        {
+          double cost(0.0);
+          if ((layer_index != selected_layer) && GetCost(subscription, layer_index, size_class, cost) && (cost < best_cost))
+          {
+            best_layer = layer_index;
+            best_cost  = cost;
+          }
+        }
+
+        if ((best_layer != selected_layer) && (best_cost < selected_cost * switch_factor))
+        {
+          subscription.selected_layer[size_class] = best_layer;
+        }
+      }
+    }
+
+    UpdateSendLayers();
+  }
+
+  void CAdaptiveLayerSelector::GetStatistics(eTLayerType layer_, Util::CExpandingVector<Registration::LayerStatistics>& statistics_) const
+  {
+    const int layer_index = AdaptiveLayerSelection::LayerIndex(layer_);
+    if (layer_index < 0) return;
+
+    std::array<SSendStatistics, AdaptiveLayerSelection::size_class_count> send_statistics;
+    {
+      const std::lock_guard<std::mutex> lock(m_send_mutex);
+      send_statistics = m_send_statistics[layer_index];
+    }
+
+    const std::lock_guard<std::mutex> lock(m_subscription_mutex);
+    for (int size_class = 0; size_class < AdaptiveLayerSelection::size_class_count; ++size_class)
+    {
+      if (send_statistics[size_class].samples == 0) continue;
+
+      // mean cost over all subscriptions that measured this layer
+      double cost_sum(0.0);
+      int    cost_count(0);
+      for (const auto& subscription : m_subscription_map)
+      {
+        double cost(0.0);
+        if (GetCost(subscription.second, layer_index, size_class, cost))
+        {
+          cost_sum += cost;
+          cost_count++;
+        }
+      }
+
+      auto& statistics = statistics_.push_back();
+      statistics.size_class = size_class;
+      statistics.samples    = send_statistics[size_class].samples;
+      statistics.cost_us    = (cost_count > 0) ? (cost_sum / cost_count) : m_send_cost[layer_index][size_class].send_us;
+      statistics.selected   = (m_send_layers[size_class].load(std::memory_order_relaxed) & (LayerMaskT(1) << layer_index)) != 0;
+    }
+  }
+
+  bool CAdaptiveLayerSelector::GetCost(const SSubscription& subscription_, int layer_index_, int size_class_, double& cost_) const
+  {
+    if ((layer_index_ < 0) || ((subscription_.candidate_layers & (LayerMaskT(1) << layer_index_)) == 0)) return false;
+
+    const auto& send_cost = m_send_cost[layer_index_][size_class_];
+    const auto& receive   = subscription_.receive[layer_index_][size_class_];
+    if (!send_cost.valid || (receive.measured < static_cast<int64_t>(m_attributes.min_samples)) || (receive.measured == 0)) return false;
+
+    cost_ = (send_cost.send_us + receive.latency_us) * (1.0 + loss_weight * receive.loss);
+    return true;
+  }
+
+  void CAdaptiveLayerSelector::UpdateSendLayers()
+  {
+    std::array<LayerMaskT, AdaptiveLayerSelection::size_class_count> send_layers{};
+    LayerMaskT candidate_layers(0);
+    for (const auto& subscription_iter : m_subscription_map)
+    {
+      const auto& subscription = subscription_iter.second;
+      candidate_layers |= subscription.candidate_layers;
+      for (int size_class = 0; size_class < AdaptiveLayerSelection::size_class_count; ++size_class)
+      {
+        const int selected_layer = subscription.selected_layer[size_class];
+        if (selected_layer >= 0) send_layers[size_class] |= LayerMaskT(1) << selected_layer;
+      }
+    }
+
+    for (int size_class = 0; size_class < AdaptiveLayerSelection::size_class_count; ++size_class)
+    {
+      m_send_layers[size_class].store(send_layers[size_class], std::memory_order_relaxed);
+    }
+    m_candidate_layers.store(candidate_layers, std::memory_order_relaxed);
+  }
+}
@@ -0,0 +1,167 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL adaptive transport layer selection
+**/
+
+#pragma once
+
+#include <ecal/config/transport_layer.h>
+#include <ecal/types.h>
+
+#include "serialization/ecal_struct_sample_common.h"
+#include "serialization/ecal_struct_sample_registration.h"
+#include "readwrite/config/attributes/writer_attributes.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace eCAL
+{
+  namespace AdaptiveLayerSelection
+  {
+    // payload size classes are powers of two, class 0 covers payloads below 2 kB, class n payloads below 2^(n+1) kB
+    constexpr int size_class_count = 16;
+    int SizeClass(size_t size_);
+
+    // layers taking part in the adaptive selection (intra process delivery is always preferred if possible)
+    constexpr int layer_count = 4;
+    int LayerIndex(eTLayerType layer_);
+    int LayerIndex(TransportLayer::eType layer_);
+
+    using LayerMaskT = uint32_t;
+    LayerMaskT LayerMask(TransportLayer::eType layer_);
+  }
+
+  /*
+  * Subscriber side: counts the samples and accumulates their delivery latency per publication,
+  * layer and payload size class. Only publications with adaptive layer selection are tracked,
+  * the counters are reported back to them via registration.
+  */
+  class CLayerStatisticsCollector
+  {
+  public:
+    bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+    void AddSample(eTLayerType layer_, EntityIdT publisher_id_, size_t size_, long long latency_us_);
+
+    void SetReportingEnabled(EntityIdT publisher_id_, bool enabled_);
+    void RemovePublisher(EntityIdT publisher_id_);
+
+    void GetStatistics(eTLayerType layer_, Util::CExpandingVector<Registration::LayerStatistics>& statistics_) const;
+
+  private:
+    struct SCounter
+    {
+      int64_t samples        = 0;
+      int64_t latency_us_sum = 0;
+    };
+    using SizeClassCounterT = std::array<SCounter, AdaptiveLayerSelection::size_class_count>;
+
+    struct SPublication
+    {
+      std::array<SizeClassCounterT, AdaptiveLayerSelection::layer_count> layers{};
+    };
+
+    mutable std::mutex                      m_mutex;
+    std::map<EntityIdT, SPublication>       m_publication_map;
+    std::atomic<bool>                       m_enabled{ false };
+  };
+
+  /*
+  * Publisher side: selects the layer per subscription and payload size class by the measured send time
+  * of the publisher and the latency / loss reported by the subscriber. A selected layer is only replaced
+  * if another one is cheaper by more than the configured hysteresis.
+  */
+  class CAdaptiveLayerSelector
+  {
+  public:
+    using SSubscriptionInfo = Registration::SampleIdentifier;
+    using LayerMaskT        = AdaptiveLayerSelection::LayerMaskT;
+
+    explicit CAdaptiveLayerSelector(const eCALWriter::SAdaptiveLayerSelectionAttributes& attr_);
+
+    // send path
+    LayerMaskT GetSendLayers(size_t size_);
+    void AddSendTime(TransportLayer::eType layer_, size_t size_, std::chrono::steady_clock::duration send_time_);
+
+    // registration path
+    void ApplySubscription(const SSubscriptionInfo& subscription_, LayerMaskT candidate_layers_, TransportLayer::eType initial_layer_);
+    void ApplyStatistics(const SSubscriptionInfo& subscription_, eTLayerType layer_, const Registration::LayerStatistics& statistics_);
+    void RemoveSubscription(const SSubscriptionInfo& subscription_);
+
+    // (re)select the layers, called once per registration cycle
+    void Evaluate();
+    void GetStatistics(eTLayerType layer_, Util::CExpandingVector<Registration::LayerStatistics>& statistics_) const;
+
+  private:
+    struct SSendStatistics
+    {
+      int64_t samples             = 0;      // sent samples overall
+      int64_t window_samples      = 0;      // sent samples since the last evaluation
+      double  window_send_time_us = 0.0;    // accumulated send time since the last evaluation
+    };
+
+    struct SSendCost
+    {
+      bool    valid   = false;
+      double  send_us = 0.0;                // smoothed send time per sample
+    };
+
+    struct SReceiveStatistics
+    {
+      bool    reported       = false;
+      int64_t received       = 0;           // last reported received samples
+      int64_t latency_us_sum = 0;           // last reported accumulated latency
+      int64_t sent           = 0;           // sent samples when the last report was applied
+      int64_t measured       = 0;           // number of samples the estimates are based on
+      double  latency_us     = 0.0;         // smoothed mean latency
+      double  loss           = 0.0;         // smoothed loss ratio
+    };
+    using SizeClassReceiveStatisticsT = std::array<SReceiveStatistics, AdaptiveLayerSelection::size_class_count>;
+
+    struct SSubscription
+    {
+      LayerMaskT                                                                  candidate_layers = 0;
+      std::array<int, AdaptiveLayerSelection::size_class_count>                   selected_layer{};
+      std::array<SizeClassReceiveStatisticsT, AdaptiveLayerSelection::layer_count> receive{};
+    };
+
+    bool   GetCost(const SSubscription& subscription_, int layer_index_, int size_class_, double& cost_) const;
+    void   UpdateSendLayers();
+
+    eCALWriter::SAdaptiveLayerSelectionAttributes                               m_attributes;
+
+    mutable std::mutex                                                          m_send_mutex;
+    std::array<std::array<SSendStatistics, AdaptiveLayerSelection::size_class_count>, AdaptiveLayerSelection::layer_count> m_send_statistics{};
+
+    mutable std::mutex                                                          m_subscription_mutex;
+    std::map<SSubscriptionInfo, SSubscription>                                  m_subscription_map;
+    std::array<std::array<SSendCost, AdaptiveLayerSelection::size_class_count>, AdaptiveLayerSelection::layer_count> m_send_cost{};
+
+    std::array<std::atomic<LayerMaskT>, AdaptiveLayerSelection::size_class_count> m_send_layers{};
+    std::atomic<LayerMaskT>                                                     m_candidate_layers{ 0 };
+    std::array<std::atomic<uint64_t>, AdaptiveLayerSelection::size_class_count>   m_size_class_counter{};
+  };
+}
@@ -30,6 +30,7 @@
 #include <shared_mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace eCAL
 {
@@ -107,8 +108,26 @@ namespace eCAL
     const SDataTypeInformation& topic_information = ecal_topic.datatype_information;
 
     CPublisherImpl::SLayerStates layer_states;
+    Registration::ConnectionPar  reader_par;
     for (const auto& layer : ecal_topic.transport_layer)
     {
+      // collect the layer specific reader parameter
+      switch (layer.type)
+      {
+      case tl_ecal_udp:
+        reader_par.layer_par_udpmc = layer.par_layer.layer_par_udpmc;
+        break;
+      case tl_ecal_shm:
+        reader_par.layer_par_shm = layer.par_layer.layer_par_shm;
+        break;
+      case tl_ecal_tcp:
+        reader_par.layer_par_tcp = layer.par_layer.layer_par_tcp;
+        break;
+      default:
+        break;
+      }
+
+
       // transport layer versions 0 and 1 did not support dynamic layer enable feature
       // so we set assume layer is enabled if we receive a registration in this case
       if (layer.enabled || (layer.version < 2))
@@ -117,12 +136,22 @@ namespace eCAL
         {
         case tl_ecal_udp:
           layer_states.udp.read_enabled = true;
+          layer_states.udp.statistics.assign(layer.statistics.begin(), layer.statistics.end());
           break;
         case tl_ecal_shm:
           layer_states.shm.read_enabled = true;
+          layer_states.shm.statistics.assign(layer.statistics.begin(), layer.statistics.end());
           break;
         case tl_ecal_tcp:
           layer_states.tcp.read_enabled = true;
+          layer_states.tcp.statistics.assign(layer.statistics.begin(), layer.statistics.end());
+          break;
+        case tl_ecal_inproc:
+          layer_states.inproc.read_enabled = true;
+          break;
+        case tl_ecal_uds:
+          layer_states.uds.read_enabled = true;
+          layer_states.uds.statistics.assign(layer.statistics.begin(), layer.statistics.end());
           break;
         default:
           break;
@@ -130,23 +159,24 @@ namespace eCAL
       }
     }
 
-    std::string reader_par;
-#if 0
-    for (const auto& layer : ecal_sample.transport_layer())
+    // collect the subscriber content filter
+    std::vector<CContentIdFilter::RangeT> content_id_ranges;
+    content_id_ranges.reserve(ecal_topic.content_id_filter.size());
+    for (const auto& content_id_range : ecal_topic.content_id_filter)
     {
-      // layer parameter as protobuf message
-      // this parameter is not used at all currently
-      // for subscriber registrations
-      reader_par = layer.par_layer().SerializeAsString();
+      content_id_ranges.emplace_back(content_id_range.min_id, content_id_range.max_id);
     }
-#endif
+    const CContentIdFilter content_id_filter(std::move(content_id_ranges));
+
+    // the subscriber rate limit
+    const double max_frequency_hz = ecal_topic.max_frequency / 1000.0;
 
     // register subscriber
     const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_publisher_mutex);
     auto res = m_topic_name_publisher_map.equal_range(topic_name);
     for(TopicNamePublisherMapT::const_iterator iter = res.first; iter != res.second; ++iter)
     {
-      iter->second->ApplySubscriberRegistration(subscription_info, topic_information, layer_states, reader_par);
+      iter->second->ApplySubscriberRegistration(subscription_info, topic_information, layer_states, reader_par, content_id_filter, max_frequency_hz, ecal_topic.history_replay);
     }
   }
 
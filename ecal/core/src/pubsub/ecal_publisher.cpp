@@ -36,6 +36,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace eCAL
 {
@@ -98,6 +99,23 @@ namespace eCAL
   }
 
   bool CPublisher::Send(CPayloadWriter& payload_, long long time_)
+  {
+    // messages without content id are sent with content id 0
+    return Send(payload_, time_, 0);
+  }
+
+  bool CPublisher::Send(const std::string& payload_, long long time_)
+  {
+    return(Send(payload_.data(), payload_.size(), time_));
+  }
+
+  bool CPublisher::Send(const void* const buf_, const size_t len_, const long long time_, const long long content_id_)
+  {
+    CBufferPayloadWriter payload{ buf_, len_ };
+    return Send(payload, time_, content_id_);
+  }
+
+  bool CPublisher::Send(CPayloadWriter& payload_, long long time_, long long content_id_)
   {
     auto publisher_impl = m_publisher_impl.lock();
     if (!publisher_impl) return false;
@@ -106,7 +124,8 @@ namespace eCAL
      // or we do not have any subscription at all
      // then the data writer will only do some statistics
      // for the monitoring layer and return
-    if (GetSubscriberCount() == 0)
+     // (publishers with history keep the sample for late joining subscribers)
+    if ((GetSubscriberCount() == 0) && !publisher_impl->HasHistory())
     {
       publisher_impl->RefreshSendCounter();
       // we return false here to indicate that we did not really send something
@@ -115,12 +134,40 @@ namespace eCAL
 
     // send content via data writer layer
     const long long write_time = (time_ == DEFAULT_TIME_ARGUMENT) ? eCAL::Time::GetMicroSeconds() : time_;
-    return publisher_impl->Write(payload_, write_time, 0);
+    return publisher_impl->Write(payload_, write_time, content_id_);
   }
 
-  bool CPublisher::Send(const std::string& payload_, long long time_)
+  bool CPublisher::Send(const std::string& payload_, long long time_, long long content_id_)
   {
-    return(Send(payload_.data(), payload_.size(), time_));
+    return(Send(payload_.data(), payload_.size(), time_, content_id_));
+  }
+
+  bool CPublisher::SendBatch(const SBatchMessage* const messages_, const size_t count_)
+  {
+    auto publisher_impl = m_publisher_impl.lock();
+    if (!publisher_impl) return false;
+    if ((messages_ == nullptr) || (count_ == 0)) return false;
+
+    // no subscription, see Send
+    if ((GetSubscriberCount() == 0) && !publisher_impl->HasHistory())
+    {
+      publisher_impl->RefreshSendCounter();
+      return false;
+    }
+
+    // resolve the default send time once for the whole batch
+    std::vector<SBatchMessage> batch(messages_, messages_ + count_);
+    const long long write_time = eCAL::Time::GetMicroSeconds();
+    for (auto& message : batch)
+    {
+      if (message.time == DEFAULT_TIME_ARGUMENT) message.time = write_time;
+    }
+    return publisher_impl->WriteBatch(batch);
+  }
+
+  bool CPublisher::SendBatch(const std::vector<SBatchMessage>& messages_)
+  {
+    return SendBatch(messages_.data(), messages_.size());
   }
 
   size_t CPublisher::GetSubscriberCount() const
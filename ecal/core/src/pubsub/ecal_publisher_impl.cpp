@@ -43,6 +43,7 @@
 #include "readwrite/config/builder/shm_attribute_builder.h"
 #include "readwrite/config/builder/tcp_attribute_builder.h"
 #include "readwrite/config/builder/udp_attribute_builder.h"
+#include "readwrite/config/builder/uds_attribute_builder.h"
 
 #include "registration/ecal_registration_provider.h"
 
@@ -98,6 +99,8 @@ namespace
     logLayerState("UDP", states.udp);
     logLayerState("SHM", states.shm);
     logLayerState("TCP", states.tcp);
+    logLayerState("INPROC", states.inproc);
+    logLayerState("UDS", states.uds);
   }
 #endif
 }
@@ -117,6 +120,12 @@ namespace eCAL
     case TransportLayer::eType::tcp:
       tcp.fetch_add(1, std::memory_order_relaxed);
       break;
+    case TransportLayer::eType::inproc:
+      inproc.fetch_add(1, std::memory_order_relaxed);
+      break;
+    case TransportLayer::eType::uds:
+      uds.fetch_add(1, std::memory_order_relaxed);
+      break;
     default:
       break;
     }
@@ -135,6 +144,12 @@ namespace eCAL
     case TransportLayer::eType::tcp:
       tcp.fetch_sub(1, std::memory_order_relaxed);
       break;
+    case TransportLayer::eType::inproc:
+      inproc.fetch_sub(1, std::memory_order_relaxed);
+      break;
+    case TransportLayer::eType::uds:
+      uds.fetch_sub(1, std::memory_order_relaxed);
+      break;
     default:
       break;
     }
@@ -145,6 +160,8 @@ namespace eCAL
     udp.store(0, std::memory_order_relaxed);
     shm.store(0, std::memory_order_relaxed);
     tcp.store(0, std::memory_order_relaxed);
+    inproc.store(0, std::memory_order_relaxed);
+    uds.store(0, std::memory_order_relaxed);
   }
 
   bool CPublisherImpl::SSendLayerConnectionCounters::UdpEnabled() const
@@ -162,6 +179,16 @@ namespace eCAL
     return (tcp.load(std::memory_order_relaxed) > 0);
   }
 
+  bool CPublisherImpl::SSendLayerConnectionCounters::InprocEnabled() const
+  {
+    return (inproc.load(std::memory_order_relaxed) > 0);
+  }
+
+  bool CPublisherImpl::SSendLayerConnectionCounters::UdsEnabled() const
+  {
+    return (uds.load(std::memory_order_relaxed) > 0);
+  }
+
   CPublisherImpl::CPublisherImpl(const SDataTypeInformation& topic_info_, const eCAL::eCALWriter::SAttributes& attr_, SPublisherGlobalContext global_context_)
     : m_publisher_id(eCAL::Util::GenerateUniqueEntityId())
     , m_topic_info(topic_info_)
@@ -180,6 +207,24 @@ namespace eCAL
     m_topic_id.topic_id.host_name = m_attributes.host_name;
     m_topic_id.topic_id.process_id = m_attributes.process_id;
 
+    // create adaptive layer selector
+    if (m_attributes.adaptive_layer_selection.enable)
+    {
+      m_adaptive_layer_selector = std::make_unique<CAdaptiveLayerSelector>(m_attributes.adaptive_layer_selection);
+    }
+
+    // create send sequencers for concurrent send calls
+    if (m_attributes.concurrent_send)
+    {
+      m_send_sequencers = std::make_unique<SSendSequencers>();
+    }
+
+    // create the sample history for late joining subscribers
+    if (m_attributes.history_depth > 0)
+    {
+      m_history = std::make_unique<CSampleHistory>(m_attributes.history_depth);
+    }
+
     // mark as created
     m_created = true;
   }
@@ -211,41 +256,136 @@ namespace eCAL
 
   bool CPublisherImpl::Write(CPayloadWriter& payload_, long long time_, long long filter_id_)
   {
-    // get payload buffer size (one time, to avoid multiple computations)
-    const size_t payload_buf_size(payload_.GetSize());
+    // adaptive layer selection: send on the layers selected for the size class of this payload only
+    size_t adaptive_payload_size(0);
+    AdaptiveLayerSelection::LayerMaskT adaptive_layers(~AdaptiveLayerSelection::LayerMaskT(0));
+    if (m_adaptive_layer_selector)
+    {
+      adaptive_payload_size = payload_.GetSize();
+      adaptive_layers       = m_adaptive_layer_selector->GetSendLayers(adaptive_payload_size);
+    }
+
+    // publisher side content filter: skip the layers without a subscriber accepting this content id
+    // (udp multicast and tcp deliver to all subscribers of a layer, so they can only be skipped as a whole)
+    const auto content_id_filters = std::atomic_load(&m_layer_content_id_filters);
+
+    // subscriber rate limits: skip the layers without a subscriber due for this sample,
+    // shm signals the processes of the due subscribers only
+    const bool rate_limited = m_rate_limited;
+    SDueLayers due_layers;
+    if (rate_limited) CollectDueLayers(filter_id_, due_layers);
+
 #if ECAL_CORE_TRANSPORT_SHM
-    const bool shm_send_enabled = m_writer_shm && m_send_layer_connection_counters.ShmEnabled();
+    const bool shm_send_enabled = m_writer_shm && m_send_layer_connection_counters.ShmEnabled() && ((adaptive_layers & AdaptiveLayerSelection::LayerMask(TransportLayer::eType::shm)) != 0)
+      && (!content_id_filters || content_id_filters->shm.Accepts(filter_id_)) && (!rate_limited || due_layers.shm);
 #endif
 #if ECAL_CORE_TRANSPORT_UDP    
-    const bool udp_send_enabled = m_writer_udp && m_send_layer_connection_counters.UdpEnabled();
+    const bool udp_send_enabled = m_writer_udp && m_send_layer_connection_counters.UdpEnabled() && ((adaptive_layers & AdaptiveLayerSelection::LayerMask(TransportLayer::eType::udp_mc)) != 0)
+      && (!content_id_filters || content_id_filters->udp.Accepts(filter_id_)) && (!rate_limited || due_layers.udp);
 #endif
 #if ECAL_CORE_TRANSPORT_TCP
-    const bool tcp_send_enabled = m_writer_tcp && m_send_layer_connection_counters.TcpEnabled();
+    const bool tcp_send_enabled = m_writer_tcp && m_send_layer_connection_counters.TcpEnabled() && ((adaptive_layers & AdaptiveLayerSelection::LayerMask(TransportLayer::eType::tcp)) != 0)
+      && (!content_id_filters || content_id_filters->tcp.Accepts(filter_id_)) && (!rate_limited || due_layers.tcp);
+#endif
+#if ECAL_CORE_TRANSPORT_INPROC
+    const bool inproc_send_enabled = m_writer_inproc && m_send_layer_connection_counters.InprocEnabled()
+      && (!content_id_filters || content_id_filters->inproc.Accepts(filter_id_)) && (!rate_limited || due_layers.inproc);
+#endif
+#if ECAL_CORE_TRANSPORT_UDS
+    const bool uds_send_enabled = m_writer_uds && m_send_layer_connection_counters.UdsEnabled() && ((adaptive_layers & AdaptiveLayerSelection::LayerMask(TransportLayer::eType::uds)) != 0)
+      && (!content_id_filters || content_id_filters->uds.Accepts(filter_id_)) && (!rate_limited || due_layers.uds);
 #endif
 
-    // are we allowed to perform zero copy writing?
-    bool allow_zero_copy(false);
+    // do we need a serialized payload at all?
+    bool serialize(true);
+#if ECAL_CORE_TRANSPORT_INPROC
+    // typed intra process delivery: if the payload provides its message object and inproc
+    // is the only active layer, the serialization can be skipped if all local subscribers take the object
+    const void* inproc_object(nullptr);
+    const char* inproc_object_type(nullptr);
+    if (inproc_send_enabled)
+    {
+      inproc_object      = payload_.GetObject();
+      inproc_object_type = payload_.GetObjectType();
+    }
+    if (inproc_object != nullptr)
+    {
+      bool other_layer_enabled(false);
 #if ECAL_CORE_TRANSPORT_SHM
-    allow_zero_copy = m_attributes.shm.zero_copy_mode; // zero copy mode activated by user
+      other_layer_enabled |= shm_send_enabled;
 #endif
 #if ECAL_CORE_TRANSPORT_UDP
-    // udp is active -> no zero copy
-    allow_zero_copy &= !udp_send_enabled;
+      other_layer_enabled |= udp_send_enabled;
 #endif
 #if ECAL_CORE_TRANSPORT_TCP
-    // tcp is active -> no zero copy
-    allow_zero_copy &= !tcp_send_enabled;
+      other_layer_enabled |= tcp_send_enabled;
 #endif
+#if ECAL_CORE_TRANSPORT_UDS
+      other_layer_enabled |= uds_send_enabled;
+#endif
+      serialize = other_layer_enabled || !m_writer_inproc->AcceptsObject(inproc_object_type);
+    }
+#endif
+    // the history keeps a serialized copy of every sample
+    if (m_history) serialize = true;
+
+    // get payload buffer size (one time, to avoid multiple computations)
+    const size_t payload_buf_size(serialize ? (m_adaptive_layer_selector ? adaptive_payload_size : payload_.GetSize()) : 0);
+
+    // measure the send time of the layers for the adaptive layer selection
+    auto measured_write = [this, payload_buf_size](TransportLayer::eType layer_, const auto& write_) -> bool
+      {
+        if (!m_adaptive_layer_selector) return write_();
+
+        const auto send_start = std::chrono::steady_clock::now();
+        const bool sent = write_();
+        m_adaptive_layer_selector->AddSendTime(layer_, payload_buf_size, std::chrono::steady_clock::now() - send_start);
+        return sent;
+      };
 
-    // create a payload copy for all layer
-    if (!allow_zero_copy)
+    // concurrent send calls serialize into their own buffer taken from the pool
+    std::vector<char> concurrent_payload_buffer;
+    if (m_send_sequencers)
     {
-      m_payload_buffer.resize(payload_buf_size);
-      payload_.WriteFull(m_payload_buffer.data(), m_payload_buffer.size());
+      const std::lock_guard<std::mutex> lock(m_payload_buffer_pool_mutex);
+      if (!m_payload_buffer_pool.empty())
+      {
+        concurrent_payload_buffer.swap(m_payload_buffer_pool.back());
+        m_payload_buffer_pool.pop_back();
+      }
     }
+    std::vector<char>& payload_buffer = m_send_sequencers ? concurrent_payload_buffer : m_payload_buffer;
+
+    // the payload is serialized exactly once and shared by all layers: directly into the memory file
+    // if shm is active and no history is kept (the other layers send from there), into the payload buffer otherwise
+    const char* payload_addr(nullptr);
+    bool        payload_serialized(false);
+    auto serialized_payload = [&]() -> const char*
+      {
+        if (!payload_serialized && serialize)
+        {
+          payload_buffer.resize(payload_buf_size);
+          payload_.WriteFull(payload_buffer.data(), payload_buffer.size());
+          payload_addr       = payload_buffer.data();
+          payload_serialized = true;
+        }
+        return payload_addr;
+      };
+
+    // draw the send clock, concurrent send calls pass every layer in the order of their clock
+    const long long snd_clock = NextSendClock();
+    CSendSequencer::CTurn shm_turn   (m_send_sequencers ? &m_send_sequencers->shm    : nullptr, snd_clock);
+    CSendSequencer::CTurn udp_turn   (m_send_sequencers ? &m_send_sequencers->udp    : nullptr, snd_clock);
+    CSendSequencer::CTurn tcp_turn   (m_send_sequencers ? &m_send_sequencers->tcp    : nullptr, snd_clock);
+    CSendSequencer::CTurn inproc_turn(m_send_sequencers ? &m_send_sequencers->inproc : nullptr, snd_clock);
+    CSendSequencer::CTurn uds_turn   (m_send_sequencers ? &m_send_sequencers->uds    : nullptr, snd_clock);
 
     // prepare counter and internal states
-    const size_t snd_hash = PrepareWrite(filter_id_, payload_buf_size);
+    const size_t snd_hash = PrepareWrite(filter_id_, payload_buf_size, snd_clock);
+
+    // serialize concurrent send calls in parallel, before they queue up for the layers;
+    // with a history the memory file is no stable source, a replay may rewrite it between the layers
+    if (m_send_sequencers || m_history) serialized_payload();
 
     // did we write anything
     bool written(false);
@@ -256,6 +396,9 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_SHM
     if (shm_send_enabled)
     {
+      // wait for the preceding send calls on this layer
+      shm_turn.Enter();
+
 #ifndef NDEBUG
       eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::SHM");
 #endif
@@ -263,15 +406,18 @@ namespace eCAL
       // send it
       bool shm_sent(false);
       {
+        const auto history_write_lock = LockHistoryWrite();
+
         // fill writer data
         struct SWriterAttr wattr;
         wattr.len = payload_buf_size;
-        wattr.id = m_id;
-        wattr.clock = m_clock;
+        wattr.id = filter_id_;
+        wattr.clock = snd_clock;
         wattr.hash = snd_hash;
         wattr.time = time_;
         wattr.zero_copy = m_attributes.shm.zero_copy_mode;
         wattr.acknowledge_timeout_ms = m_attributes.shm.acknowledge_timeout_ms;
+        wattr.signal_process_ids = rate_limited ? &due_layers.shm_process_ids : nullptr;
 
         // prepare send
         if (m_writer_shm->PrepareWrite(wattr))
@@ -281,19 +427,21 @@ namespace eCAL
           Process::SleepMS(5);
         }
 
-        // we are the only active layer, and we support zero copy -> we do a zero copy write via payload
-        if (allow_zero_copy)
+        if (payload_serialized)
         {
-          // write to shm layer (write content into the opened memory file without additional copy)
-          shm_sent = m_writer_shm->Write(payload_, wattr);
+          // write to shm layer (copy the payload that was already serialized for concurrent send calls or the history)
+          CBufferPayloadWriter buffer_payload(payload_addr, payload_buf_size);
+          shm_sent = measured_write(TransportLayer::eType::shm, [&]() { return m_writer_shm->Write(buffer_payload, wattr); });
         }
-        // multiple layer are active -> we make a copy and use that one
         else
         {
-          // wrap the buffer into a payload object
-          CBufferPayloadWriter payload_buf(m_payload_buffer.data(), m_payload_buffer.size());
-          // write to shm layer (write content into the opened memory file without additional copy)
-          shm_sent = m_writer_shm->Write(payload_buf, wattr);
+          // write to shm layer (serialize the payload into the opened memory file without additional copy)
+          shm_sent = measured_write(TransportLayer::eType::shm, [&]() { return m_writer_shm->Write(payload_, wattr); });
+          if (shm_sent)
+          {
+            payload_addr       = m_writer_shm->GetPayloadAddress();
+            payload_serialized = (payload_addr != nullptr);
+          }
         }
 
         m_layers.shm.active = true;
@@ -311,6 +459,7 @@ namespace eCAL
       }
 #endif
     }
+    shm_turn.Leave();
 #endif // ECAL_CORE_TRANSPORT_SHM
 
     ////////////////////////////////////////////////////////////////////////////
@@ -319,6 +468,9 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_UDP
     if (udp_send_enabled)
     {
+      // wait for the preceding send calls on this layer
+      udp_turn.Enter();
+
 #ifndef NDEBUG
       eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::udp");
 #endif
@@ -326,11 +478,13 @@ namespace eCAL
       // send it
       bool udp_sent(false);
       {
+        const auto history_write_lock = LockHistoryWrite();
+
         // fill writer data
         struct SWriterAttr wattr;
         wattr.len = payload_buf_size;
-        wattr.id = m_id;
-        wattr.clock = m_clock;
+        wattr.id = filter_id_;
+        wattr.clock = snd_clock;
         wattr.hash = snd_hash;
         wattr.time = time_;
         wattr.loopback = m_attributes.loopback;
@@ -344,7 +498,8 @@ namespace eCAL
         }
 
         // write to udp multicast layer
-        udp_sent = m_writer_udp->Write(m_payload_buffer.data(), wattr);
+        const char* udp_payload = serialized_payload();
+        udp_sent = measured_write(TransportLayer::eType::udp_mc, [&]() { return m_writer_udp->Write(udp_payload, wattr); });
         m_layers.udp.active = true;
       }
       written |= udp_sent;
@@ -360,6 +515,7 @@ namespace eCAL
       }
 #endif
     }
+    udp_turn.Leave();
 #endif // ECAL_CORE_TRANSPORT_UDP
 
     ////////////////////////////////////////////////////////////////////////////
@@ -368,6 +524,9 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_TCP
     if (tcp_send_enabled)
     {
+      // wait for the preceding send calls on this layer
+      tcp_turn.Enter();
+
 #ifndef NDEBUG
       eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Send::TCP");
 #endif
@@ -375,16 +534,19 @@ namespace eCAL
       // send it
       bool tcp_sent(false);
       {
+        const auto history_write_lock = LockHistoryWrite();
+
         // fill writer data
         struct SWriterAttr wattr;
         wattr.len = payload_buf_size;
-        wattr.id = m_id;
-        wattr.clock = m_clock;
+        wattr.id = filter_id_;
+        wattr.clock = snd_clock;
         wattr.hash = snd_hash;
         wattr.time = time_;
 
         // write to tcp layer
-        tcp_sent = m_writer_tcp->Write(m_payload_buffer.data(), wattr);
+        const char* tcp_payload = serialized_payload();
+        tcp_sent = measured_write(TransportLayer::eType::tcp, [&]() { return m_writer_tcp->Write(tcp_payload, wattr); });
         m_layers.tcp.active = true;
       }
       written |= tcp_sent;
@@ -400,12 +562,306 @@ namespace eCAL
       }
 #endif
     }
+    tcp_turn.Leave();
 #endif // ECAL_CORE_TRANSPORT_TCP
 
+    ////////////////////////////////////////////////////////////////////////////
+    // INPROC
+    ////////////////////////////////////////////////////////////////////////////
+#if ECAL_CORE_TRANSPORT_INPROC
+    if (inproc_send_enabled)
+    {
+      // wait for the preceding send calls on this layer
+      inproc_turn.Enter();
+
+#ifndef NDEBUG
+      eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::INPROC");
+#endif
+
+      // send it
+      bool inproc_sent(false);
+      {
+        // fill writer data
+        struct SWriterAttr wattr;
+        wattr.len = payload_buf_size;
+        wattr.id = filter_id_;
+        wattr.clock = snd_clock;
+        wattr.hash = snd_hash;
+        wattr.time = time_;
+
+        // hand the payload buffer (and the message object if available) to the subscribers of this process
+        const SInprocObject object{ inproc_object, inproc_object_type, serialize };
+        inproc_sent = m_writer_inproc->Write(serialized_payload(), wattr, object);
+        m_layers.inproc.active = true;
+      }
+      written |= inproc_sent;
+
+#ifndef NDEBUG
+      if (inproc_sent)
+      {
+        eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::INPROC - SUCCESS");
+      }
+      else
+      {
+        eCAL::Logging::Log(Logging::log_level_error, m_attributes.topic_name + "::CPublisherImpl::Write::INPROC - FAILED");
+      }
+#endif
+    }
+    inproc_turn.Leave();
+#endif // ECAL_CORE_TRANSPORT_INPROC
+
+    ////////////////////////////////////////////////////////////////////////////
+    // UDS
+    ////////////////////////////////////////////////////////////////////////////
+#if ECAL_CORE_TRANSPORT_UDS
+    if (uds_send_enabled)
+    {
+      // wait for the preceding send calls on this layer
+      uds_turn.Enter();
+
+#ifndef NDEBUG
+      eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::UDS");
+#endif
+
+      // send it
+      bool uds_sent(false);
+      {
+        const auto history_write_lock = LockHistoryWrite();
+
+        // fill writer data
+        struct SWriterAttr wattr;
+        wattr.len = payload_buf_size;
+        wattr.id = filter_id_;
+        wattr.clock = snd_clock;
+        wattr.hash = snd_hash;
+        wattr.time = time_;
+
+        // write to unix domain socket layer
+        const char* uds_payload = serialized_payload();
+        uds_sent = measured_write(TransportLayer::eType::uds, [&]() { return m_writer_uds->Write(uds_payload, wattr); });
+        m_layers.uds.active = true;
+      }
+      written |= uds_sent;
+
+#ifndef NDEBUG
+      if (uds_sent)
+      {
+        eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CPublisherImpl::Write::UDS - SUCCESS");
+      }
+      else
+      {
+        eCAL::Logging::Log(Logging::log_level_error, m_attributes.topic_name + "::CPublisherImpl::Write::UDS - FAILED");
+      }
+#endif
+    }
+    uds_turn.Leave();
+#endif // ECAL_CORE_TRANSPORT_UDS
+
+    // keep the sample for late joining subscribers
+    if (m_history)
+    {
+      struct SWriterAttr wattr;
+      wattr.len = payload_buf_size;
+      wattr.id = filter_id_;
+      wattr.clock = snd_clock;
+      wattr.hash = snd_hash;
+      wattr.time = time_;
+      const char* history_payload = serialized_payload();
+
+      const std::lock_guard<std::mutex> lock(m_history_mutex);
+      m_history->Add(history_payload, wattr);
+    }
+
+    // hand the payload buffer back to the pool for the next concurrent send call
+    if (m_send_sequencers)
+    {
+      const std::lock_guard<std::mutex> lock(m_payload_buffer_pool_mutex);
+      m_payload_buffer_pool.push_back(std::move(concurrent_payload_buffer));
+    }
+
     // return success
     return written;
   }
 
+  bool CPublisherImpl::WriteBatch(const std::vector<SBatchMessage>& messages_)
+  {
+    if (messages_.empty()) return false;
+
+    // subscriber rate limits and the adaptive layer selection decide per sample, so the batch is written sample by sample
+    if (m_rate_limited || m_adaptive_layer_selector)
+    {
+      bool written(false);
+      for (const auto& message : messages_)
+      {
+        CBufferPayloadWriter payload(message.buffer, message.buffer_size);
+        written |= Write(payload, message.time, message.content_id);
+      }
+      return written;
+    }
+
+    // a layer with subscriber content filters sends the messages accepted by one of its subscribers only
+    const auto content_id_filters = std::atomic_load(&m_layer_content_id_filters);
+    auto accepts_any = [&messages_](const CContentIdFilter& filter_)
+      {
+        return std::any_of(messages_.begin(), messages_.end(), [&filter_](const SBatchMessage& message_) { return filter_.Accepts(message_.content_id); });
+      };
+
+#if ECAL_CORE_TRANSPORT_SHM
+    const bool shm_send_enabled = m_writer_shm && m_send_layer_connection_counters.ShmEnabled() && (!content_id_filters || accepts_any(content_id_filters->shm));
+#endif
+#if ECAL_CORE_TRANSPORT_UDP
+    const bool udp_send_enabled = m_writer_udp && m_send_layer_connection_counters.UdpEnabled() && (!content_id_filters || accepts_any(content_id_filters->udp));
+#endif
+#if ECAL_CORE_TRANSPORT_TCP
+    const bool tcp_send_enabled = m_writer_tcp && m_send_layer_connection_counters.TcpEnabled() && (!content_id_filters || accepts_any(content_id_filters->tcp));
+#endif
+#if ECAL_CORE_TRANSPORT_INPROC
+    const bool inproc_send_enabled = m_writer_inproc && m_send_layer_connection_counters.InprocEnabled() && (!content_id_filters || accepts_any(content_id_filters->inproc));
+#endif
+#if ECAL_CORE_TRANSPORT_UDS
+    const bool uds_send_enabled = m_writer_uds && m_send_layer_connection_counters.UdsEnabled() && (!content_id_filters || accepts_any(content_id_filters->uds));
+#endif
+
+    // draw consecutive send clocks, concurrent send calls pass every layer after the whole batch
+    const long long first_clock = NextSendClock(messages_.size());
+    const long long last_clock  = first_clock + static_cast<long long>(messages_.size()) - 1;
+    CSendSequencer::CTurn shm_turn   (m_send_sequencers ? &m_send_sequencers->shm    : nullptr, first_clock, last_clock);
+    CSendSequencer::CTurn udp_turn   (m_send_sequencers ? &m_send_sequencers->udp    : nullptr, first_clock, last_clock);
+    CSendSequencer::CTurn tcp_turn   (m_send_sequencers ? &m_send_sequencers->tcp    : nullptr, first_clock, last_clock);
+    CSendSequencer::CTurn inproc_turn(m_send_sequencers ? &m_send_sequencers->inproc : nullptr, first_clock, last_clock);
+    CSendSequencer::CTurn uds_turn   (m_send_sequencers ? &m_send_sequencers->uds    : nullptr, first_clock, last_clock);
+
+    // every message is a sample with its own clock, the layers send the payloads from the user buffers
+    std::vector<SWriterBatchSample> samples(messages_.size());
+    for (size_t i = 0; i < messages_.size(); ++i)
+    {
+      auto& sample = samples[i];
+      sample.buf           = static_cast<const char*>(messages_[i].buffer);
+      sample.attr.len      = messages_[i].buffer_size;
+      sample.attr.id       = messages_[i].content_id;
+      sample.attr.clock    = first_clock + static_cast<long long>(i);
+      sample.attr.hash     = PrepareWrite(sample.attr.id, sample.attr.len, sample.attr.clock);
+      sample.attr.time     = messages_[i].time;
+      sample.attr.loopback = m_attributes.loopback;
+    }
+
+    // the samples of a layer, reduced to the accepted content ids if its subscribers filter
+    std::vector<SWriterBatchSample> filtered_samples;
+    auto layer_samples = [&samples, &filtered_samples, &content_id_filters](CContentIdFilter SLayerContentIdFilters::* filter_) -> const std::vector<SWriterBatchSample>&
+      {
+        if (!content_id_filters) return samples;
+        const CContentIdFilter& filter = (*content_id_filters).*filter_;
+        filtered_samples.clear();
+        for (const auto& sample : samples)
+        {
+          if (filter.Accepts(sample.attr.id)) filtered_samples.push_back(sample);
+        }
+        return filtered_samples;
+      };
+
+    // did we write anything
+    bool written(false);
+
+#if ECAL_CORE_TRANSPORT_SHM
+    if (shm_send_enabled)
+    {
+      shm_turn.Enter();
+      const auto history_write_lock = LockHistoryWrite();
+
+      // one memory file write (one lock, one signal) for all samples if the readers accept sample batches
+      auto write_shm = [this](CPayloadWriter& payload_, SWriterAttr& wattr_) -> bool
+        {
+          wattr_.zero_copy              = m_attributes.shm.zero_copy_mode;
+          wattr_.acknowledge_timeout_ms = m_attributes.shm.acknowledge_timeout_ms;
+          if (m_writer_shm->PrepareWrite(wattr_))
+          {
+            // register new to update listening subscribers and rematch
+            Register();
+            Process::SleepMS(5);
+          }
+          return m_writer_shm->Write(payload_, wattr_);
+        };
+
+      const auto& shm_samples = layer_samples(&SLayerContentIdFilters::shm);
+      bool shm_sent(false);
+      if (m_writer_shm->IsSampleBatchSupported() && (shm_samples.size() > 1))
+      {
+        SWriterAttr wattr;
+        const std::vector<char>& sample_batch = m_writer_shm->BuildSampleBatch(shm_samples, wattr);
+        CBufferPayloadWriter batch_payload(sample_batch.data(), sample_batch.size());
+        shm_sent = write_shm(batch_payload, wattr);
+      }
+      else
+      {
+        for (const auto& sample : shm_samples)
+        {
+          SWriterAttr wattr = sample.attr;
+          CBufferPayloadWriter sample_payload(sample.buf, sample.attr.len);
+          shm_sent |= write_shm(sample_payload, wattr);
+        }
+      }
+      m_layers.shm.active = true;
+      written |= shm_sent;
+    }
+    shm_turn.Leave();
+#endif // ECAL_CORE_TRANSPORT_SHM
+
+#if ECAL_CORE_TRANSPORT_UDP
+    if (udp_send_enabled)
+    {
+      udp_turn.Enter();
+      const auto history_write_lock = LockHistoryWrite();
+      written |= m_writer_udp->WriteBatch(layer_samples(&SLayerContentIdFilters::udp));
+      m_layers.udp.active = true;
+    }
+    udp_turn.Leave();
+#endif // ECAL_CORE_TRANSPORT_UDP
+
+#if ECAL_CORE_TRANSPORT_TCP
+    if (tcp_send_enabled)
+    {
+      tcp_turn.Enter();
+      const auto history_write_lock = LockHistoryWrite();
+      written |= m_writer_tcp->WriteBatch(layer_samples(&SLayerContentIdFilters::tcp));
+      m_layers.tcp.active = true;
+    }
+    tcp_turn.Leave();
+#endif // ECAL_CORE_TRANSPORT_TCP
+
+#if ECAL_CORE_TRANSPORT_INPROC
+    if (inproc_send_enabled)
+    {
+      inproc_turn.Enter();
+      written |= m_writer_inproc->WriteBatch(layer_samples(&SLayerContentIdFilters::inproc));
+      m_layers.inproc.active = true;
+    }
+    inproc_turn.Leave();
+#endif // ECAL_CORE_TRANSPORT_INPROC
+
+#if ECAL_CORE_TRANSPORT_UDS
+    if (uds_send_enabled)
+    {
+      uds_turn.Enter();
+      const auto history_write_lock = LockHistoryWrite();
+      written |= m_writer_uds->WriteBatch(layer_samples(&SLayerContentIdFilters::uds));
+      m_layers.uds.active = true;
+    }
+    uds_turn.Leave();
+#endif // ECAL_CORE_TRANSPORT_UDS
+
+    // keep the samples for late joining subscribers
+    if (m_history)
+    {
+      const std::lock_guard<std::mutex> lock(m_history_mutex);
+      for (const auto& sample : samples)
+      {
+        m_history->Add(sample.buf, sample.attr);
+      }
+    }
+
+    return written;
+  }
+
   bool CPublisherImpl::SetDataTypeInformation(const SDataTypeInformation& topic_info_)
   {
     m_topic_info = topic_info_;
@@ -449,7 +905,7 @@ namespace eCAL
     return true;
   }
 
-  void CPublisherImpl::ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const std::string& reader_par_)
+  void CPublisherImpl::ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const Registration::ConnectionPar& reader_par_, const CContentIdFilter& content_id_filter_, double max_frequency_hz_, bool history_replay_)
   {
     // collect layer states
     std::vector<eTLayerType> pub_layers;
@@ -472,22 +928,41 @@ namespace eCAL
 
     m_layers.tcp.read_enabled = sub_layer_states_.tcp.read_enabled; // just for debugging/logging
 #endif
+#if ECAL_CORE_TRANSPORT_INPROC
+    if (m_attributes.inproc.enable)            pub_layers.push_back(tl_ecal_inproc);
+    if (sub_layer_states_.inproc.read_enabled) sub_layers.push_back(tl_ecal_inproc);
+
+    m_layers.inproc.read_enabled = sub_layer_states_.inproc.read_enabled; // just for debugging/logging
+#endif
+#if ECAL_CORE_TRANSPORT_UDS
+    if (m_attributes.uds.enable)            pub_layers.push_back(tl_ecal_uds);
+    if (sub_layer_states_.uds.read_enabled) sub_layers.push_back(tl_ecal_uds);
+
+    m_layers.uds.read_enabled = sub_layer_states_.uds.read_enabled; // just for debugging/logging
+#endif
 
     // determine if we need to start a transport layer
-    const TransportLayer::eType transport_layer_for_subscription = DetermineTransportLayer(pub_layers, sub_layers, m_attributes.host_name == subscription_info_.host_name);
-    switch (transport_layer_for_subscription)
+    const bool same_host    = m_attributes.host_name == subscription_info_.host_name;
+    const bool same_process = same_host && (m_attributes.process_id == subscription_info_.process_id);
+    const TransportLayer::eType transport_layer_for_subscription = DetermineTransportLayer(pub_layers, sub_layers, same_host, same_process);
+    StartTransportLayer(transport_layer_for_subscription);
+
+    // adaptive layer selection: start all layers we share with the subscriber,
+    // the layer is selected per payload size class while sending
+    std::vector<TransportLayer::eType> candidate_layers;
+    if (m_adaptive_layer_selector
+      && (transport_layer_for_subscription != TransportLayer::eType::none)
+      && (transport_layer_for_subscription != TransportLayer::eType::inproc))
     {
-    case TransportLayer::eType::udp_mc:
-      StartUdpLayer();
-      break;
-    case TransportLayer::eType::shm:
-      StartShmLayer();
-      break;
-    case TransportLayer::eType::tcp:
-      StartTcpLayer();
-      break;
-    default:
-      break;
+      candidate_layers = DetermineCandidateTransportLayers(pub_layers, sub_layers, same_host);
+      AdaptiveLayerSelection::LayerMaskT candidate_layer_mask(0);
+      for (const auto& layer : candidate_layers)
+      {
+        StartTransportLayer(layer);
+        candidate_layer_mask |= AdaptiveLayerSelection::LayerMask(layer);
+      }
+      m_adaptive_layer_selector->ApplySubscription(subscription_info_, candidate_layer_mask, transport_layer_for_subscription);
+      ApplyAdaptiveLayerStatistics(subscription_info_, sub_layer_states_);
     }
 
 #ifndef NDEBUG
@@ -513,8 +988,16 @@ namespace eCAL
 
       if (subscription_info_iter == m_connection_map.end())
       {
-        m_connection_map[subscription_info_] = SConnection{ data_type_info_, sub_layer_states_, transport_layer_for_subscription, eConnectionState::pending };
-        m_send_layer_connection_counters.Increment(transport_layer_for_subscription);
+        m_connection_map[subscription_info_] = SConnection{ data_type_info_, sub_layer_states_, transport_layer_for_subscription, candidate_layers, eConnectionState::pending, content_id_filter_, RateLimiter<std::chrono::steady_clock>(max_frequency_hz_) };
+        if (candidate_layers.empty())
+        {
+          m_send_layer_connection_counters.Increment(transport_layer_for_subscription);
+        }
+        for (const auto& layer : candidate_layers)
+        {
+          m_send_layer_connection_counters.Increment(layer);
+        }
+        UpdateSendFilters();
       }
       else
       {
@@ -536,6 +1019,13 @@ namespace eCAL
 
         connection.data_type_info = data_type_info_;
         connection.layer_states = sub_layer_states_;
+
+        if ((connection.content_id_filter != content_id_filter_) || (connection.rate_limiter.GetMaxFrequency() != max_frequency_hz_))
+        {
+          connection.content_id_filter = content_id_filter_;
+          if (connection.rate_limiter.GetMaxFrequency() != max_frequency_hz_) connection.rate_limiter = RateLimiter<std::chrono::steady_clock>(max_frequency_hz_);
+          UpdateSendFilters();
+        }
       }
     }
 
@@ -543,6 +1033,12 @@ namespace eCAL
     // handle these events outside the lock
     if (is_new_connection)
     {
+      // replay the history first, the samples sent from the connect event follow it
+      if (m_history && history_replay_)
+      {
+        ReplayHistory(subscription_info_, transport_layer_for_subscription, content_id_filter_);
+      }
+
       // fire connect event
       FireConnectEvent(subscription_info_, data_type_info_);
     }
@@ -579,15 +1075,25 @@ namespace eCAL
 
         if (connection.state != eConnectionState::closed)
         {
-          m_send_layer_connection_counters.Decrement(connection.selected_layer);
+          if (connection.candidate_layers.empty())
+          {
+            m_send_layer_connection_counters.Decrement(connection.selected_layer);
+          }
+          for (const auto& layer : connection.candidate_layers)
+          {
+            m_send_layer_connection_counters.Decrement(layer);
+          }
           connection.state = eConnectionState::closed;
         }
 
         // remove key from connection map
         m_connection_map.erase(subscription_info_iter);
+        UpdateSendFilters();
       }
     }
 
+    if (m_adaptive_layer_selector) m_adaptive_layer_selector->RemoveSubscription(subscription_info_);
+
     // fire disconnect event
     FireDisconnectEvent(subscription_info_, data_type_info_);
 
@@ -596,18 +1102,236 @@ namespace eCAL
 #endif
   }
 
+  void CPublisherImpl::UpdateSendFilters()
+  {
+    // m_connection_map_mutex is locked by the caller
+    bool subscriber_filter(false);
+    bool rate_limited(false);
+    std::map<TransportLayer::eType, CContentIdFilter> layer_filters;
+    for (const auto& connection : m_connection_map)
+    {
+      const auto& content_id_filter = connection.second.content_id_filter;
+      subscriber_filter |= !content_id_filter.AcceptsAll();
+      rate_limited      |= connection.second.rate_limiter.IsLimited();
+
+      // a layer sends the content ids wanted by any of its subscribers
+      auto add_layer_filter = [&layer_filters, &content_id_filter](TransportLayer::eType layer_)
+        {
+          auto iter = layer_filters.find(layer_);
+          if (iter == layer_filters.end()) layer_filters.emplace(layer_, content_id_filter);
+          else                             iter->second.Merge(content_id_filter);
+        };
+      if (connection.second.candidate_layers.empty()) add_layer_filter(connection.second.selected_layer);
+      for (const auto& layer : connection.second.candidate_layers) add_layer_filter(layer);
+    }
+
+    std::shared_ptr<SLayerContentIdFilters> layer_content_id_filters;
+    if (subscriber_filter)
+    {
+      layer_content_id_filters         = std::make_shared<SLayerContentIdFilters>();
+      layer_content_id_filters->udp    = layer_filters[TransportLayer::eType::udp_mc];
+      layer_content_id_filters->shm    = layer_filters[TransportLayer::eType::shm];
+      layer_content_id_filters->tcp    = layer_filters[TransportLayer::eType::tcp];
+      layer_content_id_filters->inproc = layer_filters[TransportLayer::eType::inproc];
+      layer_content_id_filters->uds    = layer_filters[TransportLayer::eType::uds];
+    }
+    std::atomic_store(&m_layer_content_id_filters, std::shared_ptr<const SLayerContentIdFilters>(std::move(layer_content_id_filters)));
+    m_rate_limited = rate_limited;
+  }
+
+  void CPublisherImpl::ReplayHistory(const SSubscriptionInfo& subscription_info_, TransportLayer::eType layer_, const CContentIdFilter& content_id_filter_)
+  {
+    // the history is replayed from snapshots, so send calls are not blocked while replaying (an inproc replay
+    // runs subscriber callbacks that may send on this publisher), the samples added by send calls running
+    // concurrently to the first snapshot are taken behind its sequence fence and replayed in a second pass
+    uint64_t sequence_fence(0);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      std::vector<CSampleHistory::SSample> snapshot;
+      {
+        const std::lock_guard<std::mutex> lock(m_history_mutex);
+        snapshot = m_history->GetSamples(sequence_fence);
+      }
+      if (snapshot.empty()) return;
+
+      // the samples accepted by the subscriber, replayed with their original clocks on the layer
+      // selected for the subscriber (the other subscribers of this layer drop them as duplicates)
+      std::vector<SWriterBatchSample> samples;
+      samples.reserve(snapshot.size());
+      for (const auto& history_sample : snapshot)
+      {
+        if (!content_id_filter_.Accepts(history_sample.attr.id)) continue;
+        SWriterBatchSample sample;
+        sample.buf  = history_sample.payload->data();
+        sample.attr = history_sample.attr;
+        samples.push_back(sample);
+      }
+      if (samples.empty()) continue;
+
+#ifndef NDEBUG
+      eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::ReplayHistory - " + std::to_string(samples.size()) + " samples");
+#endif
+
+      ReplaySamples(subscription_info_, layer_, samples);
+    }
+  }
+
+  void CPublisherImpl::ReplaySamples(const SSubscriptionInfo& subscription_info_, TransportLayer::eType layer_, std::vector<SWriterBatchSample>& samples_)
+  {
+    // inproc delivers to the subscriber callbacks directly and is never locked
+    std::unique_lock<std::mutex> history_write_lock;
+    if (layer_ != TransportLayer::eType::inproc) history_write_lock = LockHistoryWrite();
+
+    switch (layer_)
+    {
+#if ECAL_CORE_TRANSPORT_SHM
+    case TransportLayer::eType::shm:
+      if (m_writer_shm)
+      {
+        // signal the process of the new subscriber only
+        const std::vector<int32_t> signal_process_ids{ subscription_info_.process_id };
+        auto write_shm = [this, &signal_process_ids](CPayloadWriter& payload_, SWriterAttr& wattr_) -> bool
+          {
+            wattr_.zero_copy              = m_attributes.shm.zero_copy_mode;
+            wattr_.acknowledge_timeout_ms = m_attributes.shm.acknowledge_timeout_ms;
+            wattr_.signal_process_ids     = &signal_process_ids;
+            wattr_.replay                 = true;
+            if (m_writer_shm->PrepareWrite(wattr_))
+            {
+              // register new to update listening subscribers and rematch
+              Register();
+              Process::SleepMS(5);
+            }
+            return m_writer_shm->Write(payload_, wattr_);
+          };
+
+        if (m_writer_shm->IsSampleBatchSupported() && (samples_.size() > 1))
+        {
+          SWriterAttr wattr;
+          const std::vector<char>& sample_batch = m_writer_shm->BuildSampleBatch(samples_, wattr);
+          CBufferPayloadWriter batch_payload(sample_batch.data(), sample_batch.size());
+          write_shm(batch_payload, wattr);
+        }
+        else
+        {
+          for (const auto& sample : samples_)
+          {
+            SWriterAttr wattr = sample.attr;
+            CBufferPayloadWriter sample_payload(sample.buf, sample.attr.len);
+            write_shm(sample_payload, wattr);
+          }
+        }
+      }
+      break;
+#endif
+#if ECAL_CORE_TRANSPORT_UDP
+    case TransportLayer::eType::udp_mc:
+      if (m_writer_udp)
+      {
+        for (auto& sample : samples_) sample.attr.loopback = m_attributes.loopback;
+        m_writer_udp->WriteBatch(samples_);
+      }
+      break;
+#endif
+#if ECAL_CORE_TRANSPORT_TCP
+    case TransportLayer::eType::tcp:
+      if (m_writer_tcp) m_writer_tcp->WriteBatch(samples_);
+      break;
+#endif
+#if ECAL_CORE_TRANSPORT_INPROC
+    case TransportLayer::eType::inproc:
+      if (m_writer_inproc) m_writer_inproc->WriteBatch(samples_);
+      break;
+#endif
+#if ECAL_CORE_TRANSPORT_UDS
+    case TransportLayer::eType::uds:
+      if (m_writer_uds) m_writer_uds->WriteBatch(samples_);
+      break;
+#endif
+    default:
+      break;
+    }
+  }
+
+  std::unique_lock<std::mutex> CPublisherImpl::LockHistoryWrite()
+  {
+    // the layer writers are not thread safe, a history replay on the registration thread is serialized with the send calls
+    if (!m_history) return std::unique_lock<std::mutex>();
+    return std::unique_lock<std::mutex>(m_history_write_mutex);
+  }
+
+  void CPublisherImpl::CollectDueLayers(long long content_id_, SDueLayers& due_layers_)
+  {
+    const auto now = std::chrono::steady_clock::now();
+
+    const std::lock_guard<std::mutex> lock(m_connection_map_mutex);
+    for (auto& connection : m_connection_map)
+    {
+      // the subscriber wants this sample
+      if (!connection.second.content_id_filter.Accepts(content_id_)) continue;
+      if (!connection.second.rate_limiter.Pass(now))                 continue;
+
+      auto add_due_layer = [&due_layers_, &connection](TransportLayer::eType layer_)
+        {
+          switch (layer_)
+          {
+          case TransportLayer::eType::udp_mc:
+            due_layers_.udp = true;
+            break;
+          case TransportLayer::eType::shm:
+            due_layers_.shm = true;
+            if (std::find(due_layers_.shm_process_ids.begin(), due_layers_.shm_process_ids.end(), connection.first.process_id) == due_layers_.shm_process_ids.end())
+            {
+              due_layers_.shm_process_ids.push_back(connection.first.process_id);
+            }
+            break;
+          case TransportLayer::eType::tcp:
+            due_layers_.tcp = true;
+            break;
+          case TransportLayer::eType::inproc:
+            due_layers_.inproc = true;
+            break;
+          case TransportLayer::eType::uds:
+            due_layers_.uds = true;
+            break;
+          default:
+            break;
+          }
+        };
+      if (connection.second.candidate_layers.empty()) add_due_layer(connection.second.selected_layer);
+      for (const auto& layer : connection.second.candidate_layers) add_due_layer(layer);
+    }
+  }
+
   void CPublisherImpl::RefreshSendCounter()
   {
-    // increase write clock
-    m_clock++;
+    const long long clock = NextSendClock();
+
+    // nothing is written for this clock, concurrent send calls must not wait for it
+    if (m_send_sequencers)
+    {
+      m_send_sequencers->udp.Leave(clock);
+      m_send_sequencers->shm.Leave(clock);
+      m_send_sequencers->tcp.Leave(clock);
+      m_send_sequencers->inproc.Leave(clock);
+      m_send_sequencers->uds.Leave(clock);
+    }
+  }
+
+  long long CPublisherImpl::NextSendClock(size_t count_)
+  {
+    // increase write clock (every sample draws its own clock value, the ones of a batch are consecutive)
+    const long long clock = m_clock.fetch_add(static_cast<long long>(count_)) + 1;
 
     // update send frequency
     {
       // we should think about if we would like to potentially use the `time_` variable to tick with (but we would need the same base for checking incoming samples then....
       const auto send_time = std::chrono::steady_clock::now();
       const std::lock_guard<std::mutex> lock(m_frequency_calculator_mutex);
-      m_frequency_calculator.addTick(send_time);
+      for (size_t i = 0; i < count_; ++i) m_frequency_calculator.addTick(send_time);
     }
+
+    return clock;
   }
 
   bool CPublisherImpl::IsSubscribed() const
@@ -648,6 +1372,9 @@ namespace eCAL
 
   void CPublisherImpl::GetRegistration(Registration::Sample& sample)
   {
+    // (re)select the transport layers once per registration cycle
+    if (m_adaptive_layer_selector) m_adaptive_layer_selector->Evaluate();
+
     GetRegistrationSample(sample);
   }
 
@@ -683,6 +1410,7 @@ namespace eCAL
       udp_tlayer.enabled = m_layers.udp.write_enabled;
       udp_tlayer.active = m_layers.udp.active;
       udp_tlayer.par_layer.layer_par_udpmc = m_writer_udp->GetConnectionParameter();
+      if (m_adaptive_layer_selector) m_adaptive_layer_selector->GetStatistics(tl_ecal_udp, udp_tlayer.statistics);
       ecal_reg_sample_topic.transport_layer.push_back(udp_tlayer);
     }
 #endif
@@ -697,6 +1425,7 @@ namespace eCAL
       shm_tlayer.enabled = m_layers.shm.write_enabled;
       shm_tlayer.active = m_layers.shm.active;
       shm_tlayer.par_layer.layer_par_shm = m_writer_shm->GetConnectionParameter();
+      if (m_adaptive_layer_selector) m_adaptive_layer_selector->GetStatistics(tl_ecal_shm, shm_tlayer.statistics);
       ecal_reg_sample_topic.transport_layer.push_back(shm_tlayer);
     }
 #endif
@@ -711,10 +1440,39 @@ namespace eCAL
       tcp_tlayer.enabled = m_layers.tcp.write_enabled;
       tcp_tlayer.active = m_layers.tcp.active;
       tcp_tlayer.par_layer.layer_par_tcp = m_writer_tcp->GetConnectionParameter();
+      if (m_adaptive_layer_selector) m_adaptive_layer_selector->GetStatistics(tl_ecal_tcp, tcp_tlayer.statistics);
       ecal_reg_sample_topic.transport_layer.push_back(tcp_tlayer);
     }
 #endif
 
+#if ECAL_CORE_TRANSPORT_INPROC
+    // inproc layer
+    if (m_writer_inproc)
+    {
+      eCAL::Registration::TLayer inproc_tlayer;
+      inproc_tlayer.type = tl_ecal_inproc;
+      inproc_tlayer.version = ecal_transport_layer_version;
+      inproc_tlayer.enabled = m_layers.inproc.write_enabled;
+      inproc_tlayer.active = m_layers.inproc.active;
+      ecal_reg_sample_topic.transport_layer.push_back(inproc_tlayer);
+    }
+#endif
+
+#if ECAL_CORE_TRANSPORT_UDS
+    // uds layer
+    if (m_writer_uds)
+    {
+      eCAL::Registration::TLayer uds_tlayer;
+      uds_tlayer.type = tl_ecal_uds;
+      uds_tlayer.version = ecal_transport_layer_version;
+      uds_tlayer.enabled = m_layers.uds.write_enabled;
+      uds_tlayer.active = m_layers.uds.active;
+      uds_tlayer.par_layer.layer_par_uds = m_writer_uds->GetConnectionParameter();
+      if (m_adaptive_layer_selector) m_adaptive_layer_selector->GetStatistics(tl_ecal_uds, uds_tlayer.statistics);
+      ecal_reg_sample_topic.transport_layer.push_back(uds_tlayer);
+    }
+#endif
+
     ecal_reg_sample_topic.process_name = m_attributes.process_name;
     ecal_reg_sample_topic.unit_name    = m_attributes.unit_name;
     ecal_reg_sample_topic.data_id      = m_id;
@@ -864,6 +1622,82 @@ namespace eCAL
 #endif // ECAL_CORE_TRANSPORT_TCP
   }
 
+  bool CPublisherImpl::StartInprocLayer()
+  {
+#if ECAL_CORE_TRANSPORT_INPROC
+    if (m_layers.inproc.write_enabled) return false;
+
+    // flag enabled
+    m_layers.inproc.write_enabled = true;
+
+    // log state
+    eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::StartInprocLayer::ACTIVATED");
+
+    // create writer
+    m_writer_inproc = std::make_unique<CDataWriterInproc>(m_attributes, m_publisher_id, g_subgate());
+
+    // register activated layer
+    Register();
+
+#ifndef NDEBUG
+    eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::StartInprocLayer::WRITER_CREATED");
+#endif
+    return true;
+#else  // ECAL_CORE_TRANSPORT_INPROC
+    return false;
+#endif // ECAL_CORE_TRANSPORT_INPROC
+  }
+
+  bool CPublisherImpl::StartUdsLayer()
+  {
+#if ECAL_CORE_TRANSPORT_UDS
+    if (m_layers.uds.write_enabled) return false;
+
+    // flag enabled
+    m_layers.uds.write_enabled = true;
+
+    // log state
+    eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::StartUdsLayer::ACTIVATED");
+
+    // create writer
+    m_writer_uds = std::make_unique<CDataWriterUDS>(eCAL::eCALWriter::BuildUDSAttributes(m_publisher_id, m_attributes));
+
+    // register activated layer
+    Register();
+
+#ifndef NDEBUG
+    eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CPublisherImpl::StartUdsLayer::WRITER_CREATED");
+#endif
+    return true;
+#else  // ECAL_CORE_TRANSPORT_UDS
+    return false;
+#endif // ECAL_CORE_TRANSPORT_UDS
+  }
+
+  void CPublisherImpl::StartTransportLayer(TransportLayer::eType layer_)
+  {
+    switch (layer_)
+    {
+    case TransportLayer::eType::udp_mc:
+      StartUdpLayer();
+      break;
+    case TransportLayer::eType::shm:
+      StartShmLayer();
+      break;
+    case TransportLayer::eType::tcp:
+      StartTcpLayer();
+      break;
+    case TransportLayer::eType::inproc:
+      StartInprocLayer();
+      break;
+    case TransportLayer::eType::uds:
+      StartUdsLayer();
+      break;
+    default:
+      break;
+    }
+  }
+
   void CPublisherImpl::StopAllLayer()
   {
 #if ECAL_CORE_TRANSPORT_UDP
@@ -890,20 +1724,33 @@ namespace eCAL
     m_writer_tcp.reset();
 #endif
 
+#if ECAL_CORE_TRANSPORT_INPROC
+    // flag disabled
+    m_layers.inproc.write_enabled = false;
+
+    // destroy writer
+    m_writer_inproc.reset();
+#endif
+
+#if ECAL_CORE_TRANSPORT_UDS
+    // flag disabled
+    m_layers.uds.write_enabled = false;
+
+    // destroy writer
+    m_writer_uds.reset();
+#endif
+
     m_send_layer_connection_counters.Reset();
   }
 
-  size_t CPublisherImpl::PrepareWrite(long long id_, size_t len_)
+  size_t CPublisherImpl::PrepareWrite(long long id_, size_t len_, long long clock_)
   {
     // store id
     m_id = id_;
 
-    // handle write counters
-    RefreshSendCounter();
-
     // calculate unique send hash
     const std::hash<SSndHash> hf;
-    const size_t snd_hash = hf(SSndHash(m_publisher_id, m_clock));
+    const size_t snd_hash = hf(SSndHash(m_publisher_id, clock_));
 
     // store size for monitoring
     m_topic_size = len_;
@@ -912,8 +1759,17 @@ namespace eCAL
     return snd_hash;
   }
 
-  TransportLayer::eType CPublisherImpl::DetermineTransportLayer(const std::vector<eTLayerType>& enabled_pub_layer_, const std::vector<eTLayerType>& enabled_sub_layer_, bool same_host_)
+  TransportLayer::eType CPublisherImpl::DetermineTransportLayer(const std::vector<eTLayerType>& enabled_pub_layer_, const std::vector<eTLayerType>& enabled_sub_layer_, bool same_host_, bool same_process_)
   {
+    // the intra process layer is not part of the priority lists,
+    // it always wins if both sides share the process and enabled it
+    if (same_process_
+      && std::find(enabled_pub_layer_.begin(), enabled_pub_layer_.end(), tl_ecal_inproc) != enabled_pub_layer_.end()
+      && std::find(enabled_sub_layer_.begin(), enabled_sub_layer_.end(), tl_ecal_inproc) != enabled_sub_layer_.end())
+    {
+      return TransportLayer::eType::inproc;
+    }
+
     // determine the priority list to use
     const Publisher::Configuration::LayerPriorityVector& layer_priority_vector = same_host_ ? m_attributes.layer_priority_local : m_attributes.layer_priority_remote;
 
@@ -923,6 +1779,7 @@ namespace eCAL
       {TransportLayer::eType::shm, tl_ecal_shm},
       {TransportLayer::eType::udp_mc, tl_ecal_udp},
       {TransportLayer::eType::tcp, tl_ecal_tcp},
+      {TransportLayer::eType::uds, tl_ecal_uds},
     };
 
     for (const TransportLayer::eType layer : layer_priority_vector)
@@ -938,6 +1795,51 @@ namespace eCAL
     return TransportLayer::eType::none;
   }
 
+  std::vector<TransportLayer::eType> CPublisherImpl::DetermineCandidateTransportLayers(const std::vector<eTLayerType>& enabled_pub_layer_, const std::vector<eTLayerType>& enabled_sub_layer_, bool same_host_)
+  {
+    static const std::map<TransportLayer::eType, eTLayerType> transport_layer_mapping {
+      {TransportLayer::eType::shm, tl_ecal_shm},
+      {TransportLayer::eType::udp_mc, tl_ecal_udp},
+      {TransportLayer::eType::tcp, tl_ecal_tcp},
+      {TransportLayer::eType::uds, tl_ecal_uds},
+    };
+
+    // all layers of the priority list that are available in both publisher and subscriber options
+    std::vector<TransportLayer::eType> candidate_layers;
+    const Publisher::Configuration::LayerPriorityVector& layer_priority_vector = same_host_ ? m_attributes.layer_priority_local : m_attributes.layer_priority_remote;
+    for (const TransportLayer::eType layer : layer_priority_vector)
+    {
+      const auto mapping = transport_layer_mapping.find(layer);
+      if (mapping == transport_layer_mapping.end()) continue;
+
+      if (std::find(enabled_pub_layer_.begin(), enabled_pub_layer_.end(), mapping->second) != enabled_pub_layer_.end()
+        && std::find(enabled_sub_layer_.begin(), enabled_sub_layer_.end(), mapping->second) != enabled_sub_layer_.end())
+      {
+        candidate_layers.push_back(layer);
+      }
+    }
+    return candidate_layers;
+  }
+
+  void CPublisherImpl::ApplyAdaptiveLayerStatistics(const SSubscriptionInfo& subscription_info_, const SLayerStates& sub_layer_states_)
+  {
+    // apply the delivery statistics the subscriber reported for this publisher
+    auto apply_statistics = [this, &subscription_info_](eTLayerType layer_, const SLayerState& layer_state_)
+      {
+        for (const auto& statistics : layer_state_.statistics)
+        {
+          if (statistics.publisher_id == m_publisher_id)
+          {
+            m_adaptive_layer_selector->ApplyStatistics(subscription_info_, layer_, statistics);
+          }
+        }
+      };
+    apply_statistics(tl_ecal_udp, sub_layer_states_.udp);
+    apply_statistics(tl_ecal_shm, sub_layer_states_.shm);
+    apply_statistics(tl_ecal_tcp, sub_layer_states_.tcp);
+    apply_statistics(tl_ecal_uds, sub_layer_states_.uds);
+  }
+
   int32_t CPublisherImpl::GetFrequency()
   {
     const auto frequency_time = std::chrono::steady_clock::now();
@@ -30,8 +30,13 @@
 #include <ecal/v5/ecal_callback.h>
 
 #include "serialization/ecal_serialize_sample_registration.h"
+#include "util/content_id_filter.h"
 #include "util/frequency_calculator.h"
+#include "util/rate_limiter.h"
 #include "readwrite/config/attributes/writer_attributes.h"
+#include "pubsub/ecal_adaptive_layer_selection.h"
+#include "pubsub/ecal_send_sequencer.h"
+#include "readwrite/ecal_writer_history.h"
 
 #if ECAL_CORE_TRANSPORT_UDP
 #include "readwrite/udp/ecal_writer_udp.h"
@@ -45,6 +50,14 @@
 #include "readwrite/tcp/ecal_writer_tcp.h"
 #endif
 
+#if ECAL_CORE_TRANSPORT_INPROC
+#include "readwrite/inproc/ecal_writer_inproc.h"
+#endif
+
+#if ECAL_CORE_TRANSPORT_UDS
+#include "readwrite/uds/ecal_writer_uds.h"
+#endif
+
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -75,6 +88,8 @@ namespace eCAL
       bool read_enabled  = false;   // is subscriber enabled to read data on this layer?
       bool write_enabled = false;   // is this publisher configured to write data from this layer?
       bool active        = false;   // data has been sent on this layer
+
+      std::vector<Registration::LayerStatistics> statistics;   // delivery statistics reported by the subscriber (adaptive layer selection)
     };
  
     struct SLayerStates
@@ -82,6 +97,8 @@ namespace eCAL
       SLayerState udp;
       SLayerState shm;
       SLayerState tcp;
+      SLayerState inproc;
+      SLayerState uds;
     };
 
     using SSubscriptionInfo = Registration::SampleIdentifier;
@@ -90,13 +107,14 @@ namespace eCAL
     ~CPublisherImpl();
 
     bool Write(CPayloadWriter& payload_, long long time_, long long filter_id_);
+    bool WriteBatch(const std::vector<SBatchMessage>& messages_);
 
     bool SetDataTypeInformation(const SDataTypeInformation& topic_info_);
 
     bool SetEventCallback(const PubEventCallbackT& callback_);
     bool RemoveEventCallback();
 
-    void ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const std::string& reader_par_);
+    void ApplySubscriberRegistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& sub_layer_states_, const Registration::ConnectionPar& reader_par_, const CContentIdFilter& content_id_filter_, double max_frequency_hz_, bool history_replay_);
     void ApplySubscriberUnregistration(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_);
 
     void GetRegistration(Registration::Sample& sample);
@@ -105,6 +123,7 @@ namespace eCAL
     bool IsCreated() const { return(m_created); }
 
     bool IsSubscribed() const;
+    bool HasHistory() const { return m_history != nullptr; }
     size_t GetSubscriberCount() const;
 
     const STopicId& GetTopicId() const { return m_topic_id; }
@@ -122,6 +141,9 @@ namespace eCAL
     bool StartUdpLayer();
     bool StartShmLayer();
     bool StartTcpLayer();
+    bool StartInprocLayer();
+    bool StartUdsLayer();
+    void StartTransportLayer(TransportLayer::eType layer_);
 
     void StopAllLayer();
 
@@ -130,20 +152,40 @@ namespace eCAL
     void FireConnectEvent   (const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_);
     void FireDisconnectEvent(const SSubscriptionInfo& subscription_info_, const SDataTypeInformation& data_type_info_);
 
-    size_t PrepareWrite(long long id_, size_t len_);
+    long long NextSendClock(size_t count_ = 1);
+    size_t PrepareWrite(long long id_, size_t len_, long long clock_);
 
-    TransportLayer::eType DetermineTransportLayer(const std::vector<eTLayerType>& enabled_pub_layer_, const std::vector<eTLayerType>& enabled_sub_layer_, bool same_host_);
+    TransportLayer::eType DetermineTransportLayer(const std::vector<eTLayerType>& enabled_pub_layer_, const std::vector<eTLayerType>& enabled_sub_layer_, bool same_host_, bool same_process_);
+    std::vector<TransportLayer::eType> DetermineCandidateTransportLayers(const std::vector<eTLayerType>& enabled_pub_layer_, const std::vector<eTLayerType>& enabled_sub_layer_, bool same_host_);
+    void ApplyAdaptiveLayerStatistics(const SSubscriptionInfo& subscription_info_, const SLayerStates& sub_layer_states_);
+    void UpdateSendFilters();
+    void ReplayHistory(const SSubscriptionInfo& subscription_info_, TransportLayer::eType layer_, const CContentIdFilter& content_id_filter_);
+    void ReplaySamples(const SSubscriptionInfo& subscription_info_, TransportLayer::eType layer_, std::vector<SWriterBatchSample>& samples_);
+    std::unique_lock<std::mutex> LockHistoryWrite();
     
     int32_t GetFrequency();
 
     EntityIdT                              m_publisher_id;
     SDataTypeInformation                   m_topic_info;
-    size_t                                 m_topic_size = 0;
+    std::atomic<size_t>                    m_topic_size{ 0 };
     eCAL::eCALWriter::SAttributes          m_attributes;
     STopicId                               m_topic_id;
 
     std::vector<char>                      m_payload_buffer;
 
+    // concurrent send: every producer serializes into its own buffer and passes the layers in send clock order
+    struct SSendSequencers
+    {
+      CSendSequencer udp;
+      CSendSequencer shm;
+      CSendSequencer tcp;
+      CSendSequencer inproc;
+      CSendSequencer uds;
+    };
+    std::unique_ptr<SSendSequencers>       m_send_sequencers;
+    std::mutex                             m_payload_buffer_pool_mutex;
+    std::vector<std::vector<char>>         m_payload_buffer_pool;
+
     enum class eConnectionState
     {
       pending,
@@ -156,7 +198,10 @@ namespace eCAL
       SDataTypeInformation data_type_info;
       SLayerStates         layer_states;
       TransportLayer::eType selected_layer = TransportLayer::eType::none;
+      std::vector<TransportLayer::eType> candidate_layers;   // started layers of an adaptive connection
       eConnectionState     state = eConnectionState::closed;
+      CContentIdFilter     content_id_filter;                 // content ids the subscriber wants to receive
+      RateLimiter<std::chrono::steady_clock> rate_limiter;    // maximum rate the subscriber wants to receive
     };
     using SSubscriptionMapT = std::map<SSubscriptionInfo, SConnection>;
 
@@ -169,10 +214,14 @@ namespace eCAL
       bool UdpEnabled() const;
       bool ShmEnabled() const;
       bool TcpEnabled() const;
+      bool InprocEnabled() const;
+      bool UdsEnabled() const;
 
       std::atomic<size_t> udp{ 0 };
       std::atomic<size_t> shm{ 0 };
       std::atomic<size_t> tcp{ 0 };
+      std::atomic<size_t> inproc{ 0 };
+      std::atomic<size_t> uds{ 0 };
     };
 
     mutable std::mutex                     m_connection_map_mutex;
@@ -180,11 +229,42 @@ namespace eCAL
     std::atomic<size_t>                    m_connection_count{ 0 };
     SSendLayerConnectionCounters           m_send_layer_connection_counters;
 
+    // publisher side content filter: content ids wanted by any subscriber of a layer, a layer is skipped for all other content ids
+    struct SLayerContentIdFilters
+    {
+      CContentIdFilter udp;
+      CContentIdFilter shm;
+      CContentIdFilter tcp;
+      CContentIdFilter inproc;
+      CContentIdFilter uds;
+    };
+    std::shared_ptr<const SLayerContentIdFilters> m_layer_content_id_filters;   // nullptr if no subscriber filters (replaced as a whole, read without lock)
+
+    // subscriber rate limits: layers (and shm processes) with a subscriber due for the next sample
+    struct SDueLayers
+    {
+      bool udp    = false;
+      bool shm    = false;
+      bool tcp    = false;
+      bool inproc = false;
+      bool uds    = false;
+      std::vector<int32_t> shm_process_ids;
+    };
+    void CollectDueLayers(long long content_id_, SDueLayers& due_layers_);
+    std::atomic<bool>                      m_rate_limited{ false };   // any rate limited subscriber connected
+
+    // late joiner history: the last samples, replayed to every new subscriber asking for them
+    // (the history mutex guards the history only, the write mutex the writers of the non inproc layers
+    // while the replay writes on them, both are never held while delivering to inproc callbacks)
+    std::mutex                             m_history_mutex;
+    std::mutex                             m_history_write_mutex;
+    std::unique_ptr<CSampleHistory>        m_history;
+
     std::mutex                             m_event_id_callback_mutex;
     PubEventCallbackT                      m_event_id_callback;
 
-    long long                              m_id = 0;
-    long long                              m_clock = 0;
+    std::atomic<long long>                 m_id{ 0 };
+    std::atomic<long long>                 m_clock{ 0 };
 
     std::mutex                             m_frequency_calculator_mutex;
     ResettableFrequencyCalculator<std::chrono::steady_clock> m_frequency_calculator;
@@ -198,6 +278,14 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_TCP
     std::unique_ptr<CDataWriterTCP>        m_writer_tcp;
 #endif
+#if ECAL_CORE_TRANSPORT_INPROC
+    std::unique_ptr<CDataWriterInproc>     m_writer_inproc;
+#endif
+#if ECAL_CORE_TRANSPORT_UDS
+    std::unique_ptr<CDataWriterUDS>        m_writer_uds;
+#endif
+
+    std::unique_ptr<CAdaptiveLayerSelector> m_adaptive_layer_selector;
 
     SLayerStates                           m_layers;
     std::atomic<bool>                      m_created;
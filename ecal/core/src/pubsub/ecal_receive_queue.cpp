@@ -0,0 +1,402 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL subscriber receive queue and callback executors
+**/
+
+#include "ecal_receive_queue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <utility>
+
+namespace
+{
+  // samples a shared pool thread processes from one queue before it serves the next queue
+  constexpr size_t receive_pool_batch_size = 16;
+
+  // queue whose callback is executed by the current thread (innermost one if a callback processes another caller executor queue)
+  thread_local const eCAL::CReceiveQueue* executing_queue = nullptr;
+}
+
+namespace eCAL
+{
+  const SharedPayloadT& CSharedPayload::Get()
+  {
+    if (!m_payload) m_payload = std::make_shared<const std::vector<char>>(m_data, m_data + m_size);
+    return m_payload;
+  }
+
+  CReceiveQueue::CReceiveQueue(const eCALReader::SReceiveQueueAttributes& attr_, ProcessCallbackT process_callback_) :
+    m_attributes(attr_),
+    m_process_callback(std::move(process_callback_))
+  {
+    if (m_attributes.depth < 1) m_attributes.depth = 1;
+
+    switch (m_attributes.executor)
+    {
+    case Subscriber::ReceiveQueue::eExecutor::dedicated_thread:
+      m_thread = std::thread(&CReceiveQueue::Run, this);
+      break;
+    case Subscriber::ReceiveQueue::eExecutor::shared_pool:
+      m_pool = CReceiveThreadPool::GetInstance();
+      break;
+    case Subscriber::ReceiveQueue::eExecutor::caller:
+    default:
+      break;
+    }
+  }
+
+  CReceiveQueue::~CReceiveQueue()
+  {
+    Stop();
+  }
+
+  void CReceiveQueue::Stop()
+  {
+    // stopped by its own callback (the subscriber is destroyed in its callback), the executor can not wait for itself
+    const bool on_executor = (executing_queue == this);
+
+    std::shared_ptr<CReceiveThreadPool> pool;
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopped = true;
+      m_queue.clear();
+      // released by a pool thread if it executes this callback (see ~CReceiveThreadPool)
+      pool = std::move(m_pool);
+      // the dedicated thread is detached, it holds the queue until it returned from the callback
+      if (on_executor && m_thread.joinable()) m_detached_self = weak_from_this().lock();
+    }
+    m_not_empty_cv.notify_all();
+    m_not_full_cv.notify_all();
+
+    if (m_thread.joinable())
+    {
+      if (on_executor) m_thread.detach();
+      else             m_thread.join();
+    }
+
+    // wait for a callback running in a pool or application thread, but not for the calling one
+    if (!on_executor)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_idle_cv.wait(lock, [this]() { return m_processing == 0; });
+    }
+  }
+
+  bool CReceiveQueue::Push(const STopicId& topic_id_, const Registration::SampleIdentifier& publication_info_, const char* payload_, size_t size_, long long time_, long long clock_)
+  {
+    return PushSample(topic_id_, publication_info_, payload_, size_, nullptr, time_, clock_);
+  }
+
+  bool CReceiveQueue::Push(const STopicId& topic_id_, const Registration::SampleIdentifier& publication_info_, const SharedPayloadT& payload_, long long time_, long long clock_)
+  {
+    if (!payload_) return false;
+    return PushSample(topic_id_, publication_info_, nullptr, 0, payload_, time_, clock_);
+  }
+
+  bool CReceiveQueue::PushSample(const STopicId& topic_id_, const Registration::SampleIdentifier& publication_info_, const char* payload_, size_t size_, const SharedPayloadT& shared_payload_, long long time_, long long clock_)
+  {
+    const bool reserve_slot = (m_attributes.overflow_policy != Subscriber::ReceiveQueue::eOverflowPolicy::drop_oldest);
+
+    SQueuedSample sample;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (m_stopped) return false;
+
+      if (reserve_slot)
+      {
+        if (m_attributes.overflow_policy == Subscriber::ReceiveQueue::eOverflowPolicy::block)
+        {
+          m_not_full_cv.wait(lock, [this]() { return m_stopped || (m_queue.size() + m_reserved < m_attributes.depth); });
+          if (m_stopped) return false;
+        }
+        if (m_queue.size() + m_reserved >= m_attributes.depth)
+        {
+          m_drops++;
+          return false;
+        }
+        m_reserved++;
+      }
+
+      if (!m_free_samples.empty())
+      {
+        sample = std::move(m_free_samples.back());
+        m_free_samples.pop_back();
+      }
+    }
+
+    // copy the sample outside of the lock
+    sample.topic_id         = topic_id_;
+    sample.publication_info = publication_info_;
+    if (shared_payload_)
+    {
+      sample.shared_payload = shared_payload_;
+      sample.payload.clear();
+    }
+    else
+    {
+      sample.payload.assign(payload_, payload_ + size_);
+    }
+    sample.time             = time_;
+    sample.clock            = clock_;
+
+    std::shared_ptr<CReceiveThreadPool> pool;
+    std::shared_ptr<CReceiveNotifier>   notifier;
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      if (reserve_slot) m_reserved--;
+      if (m_stopped) return false;
+
+      // the application is woken up once, it processes the queue until it is empty
+      if (m_queue.empty()) notifier = m_notifier.lock();
+
+      // drop_oldest: make room by discarding the oldest sample
+      if (m_queue.size() >= m_attributes.depth)
+      {
+        RecycleSample(std::move(m_queue.front()));
+        m_queue.pop_front();
+        m_drops++;
+      }
+      m_queue.push_back(std::move(sample));
+      m_high_water_mark = std::max(m_high_water_mark, m_queue.size());
+
+      // hand the queue over to the shared pool if it is not already waiting there
+      if (m_pool && !m_scheduled)
+      {
+        m_scheduled = true;
+        pool        = m_pool;
+      }
+    }
+    m_not_empty_cv.notify_one();
+
+    if (pool) pool->Post(shared_from_this());
+    if (notifier) notifier->Notify();
+    return true;
+  }
+
+  size_t CReceiveQueue::Process(int timeout_ms_)
+  {
+    // the callback may destroy the subscriber owning this queue
+    const std::shared_ptr<CReceiveQueue> self = shared_from_this();
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      auto ready = [this]() { return m_stopped || !m_queue.empty(); };
+      if (timeout_ms_ < 0)
+      {
+        m_not_empty_cv.wait(lock, ready);
+      }
+      else if (timeout_ms_ > 0)
+      {
+        m_not_empty_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms_), ready);
+      }
+    }
+    return ProcessPending(m_attributes.depth);
+  }
+
+  bool CReceiveQueue::SetNotifier(const std::shared_ptr<CReceiveNotifier>& notifier_)
+  {
+    bool notify(false);
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      const auto current_notifier = m_notifier.lock();
+      if (notifier_ && current_notifier && (current_notifier != notifier_)) return false;
+      m_notifier = notifier_;
+      notify     = notifier_ && !m_queue.empty();
+    }
+
+    // samples queued before, wake up the application right away
+    if (notify) notifier_->Notify();
+    return true;
+  }
+
+  void CReceiveQueue::ResetNotifier(const CReceiveNotifier* notifier_)
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_notifier.lock().get() == notifier_) m_notifier.reset();
+  }
+
+  bool CReceiveQueue::Empty() const
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queue.empty();
+  }
+
+  SReceiveQueueStatistics CReceiveQueue::GetStatistics() const
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    SReceiveQueueStatistics statistics;
+    statistics.depth           = static_cast<int32_t>(m_attributes.depth);
+    statistics.size            = static_cast<int32_t>(m_queue.size());
+    statistics.high_water_mark = static_cast<int32_t>(m_high_water_mark);
+    statistics.drops           = static_cast<int32_t>(std::min<size_t>(m_drops, std::numeric_limits<int32_t>::max()));
+    return statistics;
+  }
+
+  size_t CReceiveQueue::ProcessPending(size_t max_samples_)
+  {
+    size_t processed(0);
+    while (processed < max_samples_)
+    {
+      SQueuedSample sample;
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        // samples of one queue are processed one after the other (the caller executor may be driven by multiple threads)
+        if (m_stopped || m_queue.empty() || (m_processing > 0)) break;
+        sample = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_processing++;
+      }
+      m_not_full_cv.notify_one();
+
+      const CReceiveQueue* const outer_queue = executing_queue;
+      executing_queue = this;
+      m_process_callback(sample);
+      executing_queue = outer_queue;
+      processed++;
+
+      {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_processing--;
+        RecycleSample(std::move(sample));
+      }
+      m_idle_cv.notify_all();
+    }
+    return processed;
+  }
+
+  void CReceiveQueue::RecycleSample(SQueuedSample&& sample_)
+  {
+    // m_mutex is locked by the caller, the own payload buffer is kept, the shared one released
+    if (m_free_samples.size() >= m_attributes.depth) return;
+    sample_.shared_payload.reset();
+    m_free_samples.push_back(std::move(sample_));
+  }
+
+  bool CReceiveQueue::ProcessScheduled()
+  {
+    ProcessPending(receive_pool_batch_size);
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stopped || m_queue.empty())
+    {
+      m_scheduled = false;
+      return false;
+    }
+    return true;
+  }
+
+  void CReceiveQueue::Run()
+  {
+    while (true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_not_empty_cv.wait(lock, [this]() { return m_stopped || !m_queue.empty(); });
+        if (m_stopped) break;
+      }
+      ProcessPending(m_attributes.depth);
+    }
+
+    // detached by its own callback, the queue may be destroyed with the last reference here
+    std::shared_ptr<CReceiveQueue> self;
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      self = std::move(m_detached_self);
+    }
+  }
+
+  std::shared_ptr<CReceiveThreadPool> CReceiveThreadPool::GetInstance()
+  {
+    static std::mutex                        instance_mutex;
+    static std::weak_ptr<CReceiveThreadPool> instance;
+
+    const std::lock_guard<std::mutex> lock(instance_mutex);
+    auto pool = instance.lock();
+    if (!pool)
+    {
+      pool     = std::make_shared<CReceiveThreadPool>(std::max(2U, std::thread::hardware_concurrency()));
+      instance = pool;
+    }
+    return pool;
+  }
+
+  CReceiveThreadPool::CReceiveThreadPool(size_t thread_count_) :
+    m_state(std::make_shared<SState>())
+  {
+    for (size_t i = 0; i < thread_count_; ++i)
+    {
+      m_threads.emplace_back(&CReceiveThreadPool::Run, m_state);
+    }
+  }
+
+  CReceiveThreadPool::~CReceiveThreadPool()
+  {
+    std::deque<std::shared_ptr<CReceiveQueue>> queues;
+    {
+      const std::lock_guard<std::mutex> lock(m_state->mutex);
+      m_state->stop = true;
+      queues.swap(m_state->queues);
+    }
+    m_state->cv.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+      // a pool thread releasing the last queue finishes on its own, on the shared state
+      if (thread.get_id() == std::this_thread::get_id()) thread.detach();
+      else if (thread.joinable())                         thread.join();
+    }
+  }
+
+  void CReceiveThreadPool::Post(std::shared_ptr<CReceiveQueue> queue_)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_state->mutex);
+      if (m_state->stop) return;
+      m_state->queues.push_back(std::move(queue_));
+    }
+    m_state->cv.notify_one();
+  }
+
+  void CReceiveThreadPool::Run(const std::shared_ptr<SState>& state_)
+  {
+    while (true)
+    {
+      std::shared_ptr<CReceiveQueue> queue;
+      {
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        state_->cv.wait(lock, [&state_]() { return state_->stop || !state_->queues.empty(); });
+        if (state_->stop) return;
+        queue = std::move(state_->queues.front());
+        state_->queues.pop_front();
+      }
+
+      // samples left, line up again behind the other queues (the pool may be gone by now)
+      if (!queue->ProcessScheduled()) continue;
+      {
+        const std::lock_guard<std::mutex> lock(state_->mutex);
+        if (state_->stop) return;
+        state_->queues.push_back(std::move(queue));
+      }
+      state_->cv.notify_one();
+    }
+  }
+}
@@ -0,0 +1,202 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL subscriber receive queue and callback executors
+**/
+
+#pragma once
+
+#include <ecal/pubsub/types.h>
+
+#include "readwrite/config/attributes/reader_attributes.h"
+#include "serialization/ecal_struct_sample_registration.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  // immutable payload shared by the receive queues of several readers
+  using SharedPayloadT = std::shared_ptr<const std::vector<char>>;
+
+  /*
+  * Payload of one received sample fanned out to the readers of a topic. The copy is
+  * made by the first reader queueing the sample, the following readers share it.
+  */
+  class CSharedPayload
+  {
+  public:
+    CSharedPayload(const char* data_, size_t size_) : m_data(data_), m_size(size_) {}
+
+    const SharedPayloadT& Get();
+
+  private:
+    const char*    m_data;
+    size_t         m_size;
+    SharedPayloadT m_payload;
+  };
+
+  // sample copied into a receive queue, processed later by the queue executor
+  struct SQueuedSample
+  {
+    STopicId                       topic_id;
+    Registration::SampleIdentifier publication_info;
+    std::vector<char>              payload;          // own copy of the payload
+    SharedPayloadT                 shared_payload;   // used instead of the own copy if set
+    long long                      time  = 0;
+    long long                      clock = 0;
+
+    const char* PayloadData() const { return shared_payload ? shared_payload->data() : payload.data(); }
+    size_t      PayloadSize() const { return shared_payload ? shared_payload->size() : payload.size(); }
+  };
+
+  struct SReceiveQueueStatistics
+  {
+    int32_t depth           = 0;
+    int32_t size            = 0;
+    int32_t high_water_mark = 0;
+    int32_t drops           = 0;
+  };
+
+  class CReceiveThreadPool;
+
+  // wakes up an application waiting for the samples of several caller executor queues (see CWaitSetImpl)
+  class CReceiveNotifier
+  {
+  public:
+    virtual ~CReceiveNotifier() = default;
+
+    // called without queue lock when a sample is pushed into an empty queue
+    virtual void Notify() = 0;
+  };
+
+  /*
+  * Bounded queue between the transport threads delivering samples and the execution of the
+  * subscriber callback. Depending on the executor the queue is processed by its own thread,
+  * by the process wide receive thread pool or by the application (Process).
+  * Samples of one queue are never processed concurrently and keep their order.
+  */
+  class CReceiveQueue : public std::enable_shared_from_this<CReceiveQueue>
+  {
+  public:
+    using ProcessCallbackT = std::function<void(const SQueuedSample&)>;
+
+    CReceiveQueue(const eCALReader::SReceiveQueueAttributes& attr_, ProcessCallbackT process_callback_);
+    ~CReceiveQueue();
+
+    CReceiveQueue(const CReceiveQueue&) = delete;
+    CReceiveQueue& operator=(const CReceiveQueue&) = delete;
+
+    // stops the executor and waits for a running callback, queued samples are discarded,
+    // called by the callback itself the executor finishes it afterwards
+    void Stop();
+
+    // returns false if the sample was dropped (queue full with drop_newest policy or queue stopped)
+    bool Push(const STopicId& topic_id_, const Registration::SampleIdentifier& publication_info_, const char* payload_, size_t size_, long long time_, long long clock_);
+    // queues a reference to the shared payload instead of a copy
+    bool Push(const STopicId& topic_id_, const Registration::SampleIdentifier& publication_info_, const SharedPayloadT& payload_, long long time_, long long clock_);
+
+    // caller executor: process all queued samples, wait up to timeout_ms_ for the first one (-1 = infinite)
+    size_t Process(int timeout_ms_);
+
+    // caller executor: notify notifier_ whenever the queue gets samples again, returns false
+    // if the queue is already attached to another notifier (notifier_ nullptr detaches)
+    bool SetNotifier(const std::shared_ptr<CReceiveNotifier>& notifier_);
+    // detaches the notifier if it is the attached one
+    void ResetNotifier(const CReceiveNotifier* notifier_);
+
+    bool Empty() const;
+
+    SReceiveQueueStatistics GetStatistics() const;
+
+  private:
+    friend class CReceiveThreadPool;
+
+    bool PushSample(const STopicId& topic_id_, const Registration::SampleIdentifier& publication_info_, const char* payload_, size_t size_, const SharedPayloadT& shared_payload_, long long time_, long long clock_);
+    void RecycleSample(SQueuedSample&& sample_);
+
+    size_t ProcessPending(size_t max_samples_);
+    // shared pool executor: process a batch of samples, returns true if samples are left
+    bool ProcessScheduled();
+    void Run();
+
+    eCALReader::SReceiveQueueAttributes  m_attributes;
+    ProcessCallbackT                     m_process_callback;
+
+    mutable std::mutex                   m_mutex;
+    std::condition_variable              m_not_empty_cv;
+    std::condition_variable              m_not_full_cv;
+    std::condition_variable              m_idle_cv;
+    std::deque<SQueuedSample>            m_queue;
+    std::vector<SQueuedSample>           m_free_samples;     // recycled samples to avoid payload allocations
+    size_t                               m_reserved    = 0;  // slots reserved by producers copying their payload
+    size_t                               m_processing  = 0;  // number of threads running the callback
+    bool                                 m_scheduled   = false;
+    bool                                 m_stopped     = false;
+
+    size_t                               m_high_water_mark = 0;
+    size_t                               m_drops           = 0;
+
+    std::thread                          m_thread;
+    std::shared_ptr<CReceiveQueue>       m_detached_self;    // keeps the queue alive for a thread detached by its own callback
+    std::shared_ptr<CReceiveThreadPool>  m_pool;
+    std::weak_ptr<CReceiveNotifier>      m_notifier;
+  };
+
+  /*
+  * Process wide thread pool executing the receive queues with the shared pool executor,
+  * it lives as long as one of these queues exists. The last queue may be released by a pool
+  * thread, so the threads work on a shared state that outlives the pool.
+  */
+  class CReceiveThreadPool
+  {
+  public:
+    static std::shared_ptr<CReceiveThreadPool> GetInstance();
+
+    explicit CReceiveThreadPool(size_t thread_count_);
+    ~CReceiveThreadPool();
+
+    CReceiveThreadPool(const CReceiveThreadPool&) = delete;
+    CReceiveThreadPool& operator=(const CReceiveThreadPool&) = delete;
+
+    void Post(std::shared_ptr<CReceiveQueue> queue_);
+
+  private:
+    struct SState
+    {
+      std::mutex                                 mutex;
+      std::condition_variable                    cv;
+      std::deque<std::shared_ptr<CReceiveQueue>> queues;
+      bool                                       stop = false;
+    };
+
+    static void Run(const std::shared_ptr<SState>& state_);
+
+    std::shared_ptr<SState>                    m_state;
+    std::vector<std::thread>                   m_threads;
+  };
+}
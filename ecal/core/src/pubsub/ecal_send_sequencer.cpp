@@ -0,0 +1,55 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL send sequencer for concurrent publisher writes
+**/
+
+#include "ecal_send_sequencer.h"
+
+namespace eCAL
+{
+  void CSendSequencer::Enter(long long clock_)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this, clock_]() { return m_next_clock >= clock_; });
+  }
+
+  void CSendSequencer::Leave(long long clock_)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      if (clock_ != m_next_clock)
+      {
+        m_left_ahead.insert(clock_);
+        return;
+      }
+
+      // advance over all clock values that already left ahead of their turn
+      ++m_next_clock;
+      auto iter = m_left_ahead.begin();
+      while (iter != m_left_ahead.end() && *iter == m_next_clock)
+      {
+        iter = m_left_ahead.erase(iter);
+        ++m_next_clock;
+      }
+    }
+    m_cv.notify_all();
+  }
+}
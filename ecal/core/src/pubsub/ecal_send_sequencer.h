@@ -0,0 +1,77 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL send sequencer for concurrent publisher writes
+**/
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <set>
+
+namespace eCAL
+{
+  /*
+  * Orders the writes of concurrent producers on one transport layer by their send clock.
+  * Every clock value drawn by the publisher has to leave the sequencer exactly once, either
+  * after its write (Enter / Leave) or without writing at all (Leave only). Clock values
+  * that leave ahead of their turn are remembered until all smaller ones have left.
+  */
+  class CSendSequencer
+  {
+  public:
+    // block until all clock values before clock_ left the sequencer
+    void Enter(long long clock_);
+    void Leave(long long clock_);
+
+    // scoped turn of one clock value (or a consecutive range of a batch write),
+    // leaves the sequencer on destruction at the latest
+    class CTurn
+    {
+    public:
+      CTurn(CSendSequencer* sequencer_, long long clock_) : m_sequencer(sequencer_), m_clock(clock_), m_last_clock(clock_) {}
+      CTurn(CSendSequencer* sequencer_, long long first_clock_, long long last_clock_) : m_sequencer(sequencer_), m_clock(first_clock_), m_last_clock(last_clock_) {}
+      ~CTurn() { Leave(); }
+
+      CTurn(const CTurn&) = delete;
+      CTurn& operator=(const CTurn&) = delete;
+
+      void Enter() { if (m_sequencer != nullptr) m_sequencer->Enter(m_clock); }
+      void Leave()
+      {
+        if (m_sequencer == nullptr) return;
+        for (long long clock = m_clock; clock <= m_last_clock; ++clock) m_sequencer->Leave(clock);
+        m_sequencer = nullptr;
+      }
+
+    private:
+      CSendSequencer* m_sequencer;
+      long long       m_clock;
+      long long       m_last_clock;
+    };
+
+  private:
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+    long long               m_next_clock = 1;
+    std::set<long long>     m_left_ahead;
+  };
+}
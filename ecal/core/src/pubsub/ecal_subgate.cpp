@@ -23,6 +23,8 @@
 **/
 
 #include "pubsub/ecal_subgate.h"
+#include "pubsub/ecal_receive_queue.h"
+#include "readwrite/ecal_sample_batch.h"
 #include "ecal_globals.h"
 
 #include "ecal/log.h"
@@ -65,6 +67,8 @@ namespace eCAL
     // stop & destroy all remaining subscriber
     const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
     m_topic_name_subscriber_map.clear();
+    m_publisher_topic_map.clear();
+    std::atomic_store(&m_dispatch_table, DispatchTablePtrT());
   }
 
   bool CSubGate::Register(const std::string& topic_name_, const std::shared_ptr<CSubscriberImpl>& datareader_)
@@ -74,6 +78,7 @@ namespace eCAL
     // register reader
     const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
     m_topic_name_subscriber_map.emplace(std::pair<std::string, std::shared_ptr<CSubscriberImpl>>(topic_name_, datareader_));
+    UpdateDispatchTable();
 
     return(true);
   }
@@ -94,24 +99,37 @@ namespace eCAL
         break;
       }
     }
+    if (ret_state) UpdateDispatchTable();
 
     return(ret_state);
   }
 
   bool CSubGate::HasSample(const std::string& sample_name_)
   {
-    const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-    return(m_topic_name_subscriber_map.find(sample_name_) != m_topic_name_subscriber_map.end());
+    const DispatchTablePtrT dispatch_table = GetDispatchTable();
+    if (!dispatch_table) return false;
+    return(dispatch_table->topic_readers.find(sample_name_) != dispatch_table->topic_readers.end());
   }
 
   bool CSubGate::ApplySample(const char* serialized_sample_data_, size_t serialized_sample_size_, eTLayerType layer_)
   {
     if(!m_created) return false;
 
-    Payload::Sample ecal_sample;
+    // unpack coalesced samples
+    if (IsSampleBatch(serialized_sample_data_, serialized_sample_size_))
+    {
+      bool applied(false);
+      ForEachSampleInBatch(serialized_sample_data_, serialized_sample_size_, [this, &applied, layer_](const char* sample_data_, size_t sample_size_)
+        {
+          applied = ApplySample(sample_data_, sample_size_, layer_) || applied;
+        });
+      return applied;
+    }
+
+    // the sample view refers to the serialized sample, nothing is copied here
+    Payload::SampleView ecal_sample;
     if (!DeserializeFromBuffer(serialized_sample_data_, serialized_sample_size_, ecal_sample)) return false;
 
-    size_t applied_size(0);
     switch (ecal_sample.cmd_type)
     {
     case bct_set_sample:
@@ -121,91 +139,97 @@ namespace eCAL
       if (layer_ == eTLayerType::tl_none)
       {
         // log it
-        eCAL::Logging::Log(Logging::log_level_error, ecal_sample.topic_info.topic_name + " : payload received without layer definition !");
+        eCAL::Logging::Log(Logging::log_level_error, std::string(ecal_sample.topic_info.topic_name) + " : payload received without layer definition !");
       }
 #endif
 
-      // extract payload
-      const char* payload_addr = nullptr;
-      size_t      payload_size = 0;
-      switch (ecal_sample.content.payload.type)
-      {
-      case eCAL::Payload::pl_raw:
-        payload_addr = ecal_sample.content.payload.raw_addr;
-        payload_size = ecal_sample.content.payload.raw_size;
-        break;
-      case eCAL::Payload::pl_vec:
-        payload_addr = ecal_sample.content.payload.vec.data();
-        payload_size = ecal_sample.content.payload.vec.size();
-        break;
-      default:
-        break;
-      }
-
-      // apply sample to data reader
-      std::vector<std::shared_ptr<CSubscriberImpl>> readers_to_apply;
-        
-      // Lock the sync map only while extracting the relevant shared pointers to the Datareaders.
-      // Apply the samples to the readers afterward.
-      {
-        // apply sample to data reader
-        const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-        auto res = m_topic_name_subscriber_map.equal_range(ecal_sample.topic_info.topic_name);
-        std::transform(
-          res.first, res.second, std::back_inserter(readers_to_apply), [](const auto& match) { return match.second; }
-        );
-      }
-
       const auto& ecal_sample_content = ecal_sample.content;
-      for (const auto& reader : readers_to_apply)
-      {
-        applied_size = reader->ApplySample(
-          ecal_sample.topic_info,
-          payload_addr,
-          payload_size,
-          ecal_sample_content.id,
-          ecal_sample_content.clock,
-          ecal_sample_content.time,
-          static_cast<size_t>(ecal_sample_content.hash),
-          layer_
-        );
-      }
+      return ApplySample(
+        ecal_sample.topic_info,
+        ecal_sample_content.payload_addr,
+        ecal_sample_content.payload_size,
+        ecal_sample_content.id,
+        ecal_sample_content.clock,
+        ecal_sample_content.time,
+        static_cast<size_t>(ecal_sample_content.hash),
+        layer_
+      );
     }
-    break;
     default:
       break;
     }
 
-    return (applied_size > 0);
+    return false;
   }
 
-  bool CSubGate::ApplySample(const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_)
+  bool CSubGate::ApplySample(const Payload::TopicInfoView& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, const SInprocObject* object_)
   {
     if (!m_created) return false;
 
-    // apply sample to data reader
-    size_t applied_size(0);
-    std::vector<std::shared_ptr<CSubscriberImpl>> readers_to_apply;
+    // resolve the readers by the publisher entity id, by the topic name for not yet registered publishers
+    const DispatchTablePtrT dispatch_table = GetDispatchTable();
+    if (!dispatch_table) return false;
 
-    // Lock the sync map only while extracting the relevant shared pointers to the Datareaders.
-    // Apply the samples to the readers afterwards.
+    const STopicReaders* topic_readers(nullptr);
+    auto publisher_iter = dispatch_table->publisher_readers.find(topic_info_.topic_id);
+    if ((publisher_iter != dispatch_table->publisher_readers.end()) && (publisher_iter->second.process_id == topic_info_.process_id))
     {
-      const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
-      auto res = m_topic_name_subscriber_map.equal_range(topic_info_.topic_name);
-      std::transform(
-        res.first, res.second, std::back_inserter(readers_to_apply), [](const auto& match) { return match.second; }
-      );
+      topic_readers = publisher_iter->second.topic_readers.get();
+    }
+    else
+    {
+      auto topic_iter = dispatch_table->topic_readers.find(topic_info_.topic_name);
+      if (topic_iter != dispatch_table->topic_readers.end()) topic_readers = topic_iter->second.get();
     }
+    if (topic_readers == nullptr) return false;
 
+    // the snapshot keeps the readers alive while the sample is applied
+    size_t applied_size(0);
+    if (topic_readers->queued_reader_count == 0)
+    {
+      for (const auto& reader : topic_readers->readers)
+      {
+        applied_size = reader->ApplySample(topic_info_, buf_, len_, id_, clock_, time_, hash_, layer_, object_);
+      }
+      return (applied_size > 0);
+    }
 
-    for (const auto& reader : readers_to_apply)
+    // Parallel fan-out: readers with a receive queue get the sample enqueued first, their executors
+    // run while the remaining readers execute their callbacks on this thread.
+    // Readers sharing the sample reference one immutable copy of the payload.
+    CSharedPayload  shared_payload(buf_, len_);
+    CSharedPayload* fan_out_payload = (topic_readers->queued_reader_count > 1) ? &shared_payload : nullptr;
+    for (const auto& reader : topic_readers->readers)
     {
-      applied_size = reader->ApplySample(topic_info_, buf_, len_, id_, clock_, time_, hash_, layer_);
+      if (!reader->HasReceiveQueue()) continue;
+      applied_size = std::max(applied_size, reader->ApplySample(topic_info_, buf_, len_, id_, clock_, time_, hash_, layer_, object_, fan_out_payload));
+    }
+    for (const auto& reader : topic_readers->readers)
+    {
+      if (reader->HasReceiveQueue()) continue;
+      applied_size = std::max(applied_size, reader->ApplySample(topic_info_, buf_, len_, id_, clock_, time_, hash_, layer_, object_));
     }
 
     return (applied_size > 0);
   }
 
+  bool CSubGate::AcceptsInprocObject(const std::string& topic_name_, const char* object_type_)
+  {
+    if (!m_created) return false;
+
+    const DispatchTablePtrT dispatch_table = GetDispatchTable();
+    if (!dispatch_table) return true;
+
+    auto topic_iter = dispatch_table->topic_readers.find(topic_name_);
+    if (topic_iter == dispatch_table->topic_readers.end()) return true;
+
+    for (const auto& reader : topic_iter->second->readers)
+    {
+      if (!reader->AcceptsInprocObject(object_type_)) return false;
+    }
+    return true;
+  }
+
   void CSubGate::ApplyPublisherRegistration(const Registration::Sample& ecal_sample_)
   {
     if(!m_created) return;
@@ -219,9 +243,15 @@ namespace eCAL
     const auto& publication_info = ecal_sample_.identifier;
     const SDataTypeInformation& topic_information = ecal_topic.datatype_information;
 
+    // resolve the dispatch of this publisher's samples
+    RegisterPublisher(ecal_sample_);
+
     CSubscriberImpl::SLayerStates layer_states;
     for (const auto& layer : ecal_topic.transport_layer)
     {
+      // publishers with adaptive layer selection report their layer statistics and expect ours
+      layer_states.report_statistics |= !layer.statistics.empty();
+
       // transport layer versions 0 and 1 did not support dynamic layer enable feature
       // so we set assume layer is enabled if we receive a registration in this case
       if (layer.enabled || layer.version < 2)
@@ -237,6 +267,12 @@ namespace eCAL
         case tl_ecal_tcp:
           layer_states.tcp.write_enabled = true;
           break;
+        case tl_ecal_inproc:
+          layer_states.inproc.write_enabled = true;
+          break;
+        case tl_ecal_uds:
+          layer_states.uds.write_enabled = true;
+          break;
         default:
           break;
         }
@@ -253,7 +289,7 @@ namespace eCAL
       {
         iter->second->ApplyLayerParameter(publication_info, transport_layer.type, transport_layer.par_layer);
       }
-      iter->second->ApplyPublisherRegistration(publication_info, topic_information, layer_states);
+      iter->second->ApplyPublisherRegistration(publication_info, topic_information, layer_states, ecal_sample_.topic.data_clock);
     }
   }
 
@@ -270,6 +306,8 @@ namespace eCAL
     const auto& publication_info = ecal_sample_.identifier;
     const SDataTypeInformation& topic_information = ecal_topic.datatype_information;
 
+    UnregisterPublisher(ecal_sample_);
+
     // unregister publisher
     const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
     auto res = m_topic_name_subscriber_map.equal_range(topic_name);
@@ -290,4 +328,69 @@ namespace eCAL
       iter.second->GetRegistration(reg_sample_list_.push_back());
     }
   }
+
+  CSubGate::DispatchTablePtrT CSubGate::GetDispatchTable() const
+  {
+    return std::atomic_load(&m_dispatch_table);
+  }
+
+  void CSubGate::UpdateDispatchTable()
+  {
+    auto dispatch_table = std::make_shared<SDispatchTable>();
+
+    // group the readers by topic
+    std::unordered_map<std::string, std::shared_ptr<STopicReaders>> topic_readers_map;
+    for (const auto& reader : m_topic_name_subscriber_map)
+    {
+      auto& topic_readers = topic_readers_map[reader.first];
+      if (!topic_readers) topic_readers = std::make_shared<STopicReaders>();
+      topic_readers->readers.push_back(reader.second);
+      if (reader.second->HasReceiveQueue()) topic_readers->queued_reader_count++;
+    }
+    for (auto& topic_readers : topic_readers_map)
+    {
+      dispatch_table->topic_readers.emplace(topic_readers.first, std::move(topic_readers.second));
+    }
+
+    // the registered publishers of these topics are dispatched by their entity id
+    for (const auto& publisher : m_publisher_topic_map)
+    {
+      auto topic_iter = dispatch_table->topic_readers.find(publisher.second.topic_name);
+      if (topic_iter == dispatch_table->topic_readers.end()) continue;
+      dispatch_table->publisher_readers.emplace(publisher.first, SPublisherReaders{ publisher.second.process_id, topic_iter->second });
+    }
+
+    std::atomic_store(&m_dispatch_table, DispatchTablePtrT(std::move(dispatch_table)));
+  }
+
+  void CSubGate::RegisterPublisher(const Registration::Sample& ecal_sample_)
+  {
+    const EntityIdT    publisher_id = ecal_sample_.identifier.entity_id;
+    const int32_t      process_id   = ecal_sample_.identifier.process_id;
+    const std::string& topic_name   = ecal_sample_.topic.topic_name;
+
+    // known publisher, nothing changes (registration refresh)
+    {
+      const std::shared_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
+      auto iter = m_publisher_topic_map.find(publisher_id);
+      if ((iter != m_publisher_topic_map.end()) && (iter->second.process_id == process_id) && (iter->second.topic_name == topic_name)) return;
+    }
+
+    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
+    m_publisher_topic_map[publisher_id] = SPublisherTopic{ topic_name, process_id };
+
+    // new publisher of a topic with local readers
+    if (m_topic_name_subscriber_map.find(topic_name) != m_topic_name_subscriber_map.end()) UpdateDispatchTable();
+  }
+
+  void CSubGate::UnregisterPublisher(const Registration::Sample& ecal_sample_)
+  {
+    const std::unique_lock<std::shared_timed_mutex> lock(m_topic_name_subscriber_mutex);
+    auto iter = m_publisher_topic_map.find(ecal_sample_.identifier.entity_id);
+    if (iter == m_publisher_topic_map.end()) return;
+
+    const bool dispatched = (m_topic_name_subscriber_map.find(iter->second.topic_name) != m_topic_name_subscriber_map.end());
+    m_publisher_topic_map.erase(iter);
+    if (dispatched) UpdateDispatchTable();
+  }
 }
@@ -26,12 +26,17 @@
 
 #include "pubsub/ecal_subscriber_impl.h"
 
+#include <tsl/robin_map.h>
+
 #include <atomic>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace eCAL
 {
@@ -50,7 +55,9 @@ namespace eCAL
     bool HasSample(const std::string& sample_name_);
 
     bool ApplySample(const char* serialized_sample_data_, size_t serialized_sample_size_, eTLayerType layer_);
-    bool ApplySample(const Payload::TopicInfo& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_);
+    bool ApplySample(const Payload::TopicInfoView& topic_info_, const char* buf_, size_t len_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, const SInprocObject* object_ = nullptr);
+
+    bool AcceptsInprocObject(const std::string& topic_name_, const char* object_type_);
 
     void ApplyPublisherRegistration(const Registration::Sample& ecal_sample_);
     void ApplyPublisherUnregistration(const Registration::Sample& ecal_sample_);
@@ -58,10 +65,64 @@ namespace eCAL
     void GetRegistrations(Registration::SampleList& reg_sample_list_);
 
   protected:
+    // readers of one topic
+    struct STopicReaders
+    {
+      std::vector<std::shared_ptr<CSubscriberImpl>> readers;
+      size_t                                        queued_reader_count = 0;   // readers with a receive queue
+    };
+    using TopicReadersPtrT = std::shared_ptr<const STopicReaders>;
+
+    struct SPublisherReaders
+    {
+      int32_t          process_id = 0;
+      TopicReadersPtrT topic_readers;
+    };
+
+    // topic name lookup with std::string_view keys (no key copy per sample)
+    struct STopicNameHash
+    {
+      using is_transparent = void;
+      size_t operator()(std::string_view topic_name_) const { return std::hash<std::string_view>()(topic_name_); }
+    };
+    struct STopicNameEqual
+    {
+      using is_transparent = void;
+      bool operator()(std::string_view lhs_, std::string_view rhs_) const { return lhs_ == rhs_; }
+    };
+
+    // Immutable dispatch table, rebuilt on every reader (un)registration and on every new publisher
+    // of a locally subscribed topic. Samples are dispatched by their publisher entity id (resolved
+    // by the publisher registration), the topic name is only looked up for not yet registered publishers.
+    struct SDispatchTable
+    {
+      tsl::robin_map<EntityIdT, SPublisherReaders>                                    publisher_readers;
+      tsl::robin_map<std::string, TopicReadersPtrT, STopicNameHash, STopicNameEqual>  topic_readers;
+    };
+    using DispatchTablePtrT = std::shared_ptr<const SDispatchTable>;
+
+    DispatchTablePtrT GetDispatchTable() const;
+    // m_topic_name_subscriber_mutex is locked (unique) by the caller
+    void UpdateDispatchTable();
+
+    void RegisterPublisher(const Registration::Sample& ecal_sample_);
+    void UnregisterPublisher(const Registration::Sample& ecal_sample_);
+
     static std::atomic<bool> m_created;
 
+    struct SPublisherTopic
+    {
+      std::string topic_name;
+      int32_t     process_id = 0;
+    };
+
     using TopicNameSubscriberMapT = std::unordered_multimap<std::string, std::shared_ptr<CSubscriberImpl>>;
+    using PublisherTopicMapT      = std::unordered_map<EntityIdT, SPublisherTopic>;
     std::shared_timed_mutex  m_topic_name_subscriber_mutex;
     TopicNameSubscriberMapT  m_topic_name_subscriber_map;
+    PublisherTopicMapT       m_publisher_topic_map;
+
+    // published like RCU: replaced as a whole (std::atomic_store), samples work on the loaded snapshot
+    DispatchTablePtrT        m_dispatch_table;
   };
 }
@@ -45,6 +45,9 @@ namespace eCAL
       global_context.shm_layer             = globals->shm_reader_layer();
       global_context.udp_layer             = globals->udp_reader_layer();
       global_context.tcp_layer             = globals->tcp_reader_layer();
+#if ECAL_CORE_TRANSPORT_UDS
+      global_context.uds_layer             = globals->uds_reader_layer();
+#endif
     }
     
 
@@ -97,12 +100,40 @@ namespace eCAL
     if (subscriber_impl) static_cast<void>(subscriber_impl->SetReceiveCallback(callback_));
   }
 
+  void CSubscriber::SetReceiveCallback(ReceiveCallbackT callback_, const std::string& object_type_)
+  {
+    auto subscriber_impl = m_subscriber_impl.lock();
+    if (subscriber_impl) static_cast<void>(subscriber_impl->SetReceiveCallback(callback_, object_type_));
+  }
+
   void CSubscriber::RemoveReceiveCallback()
   {
     auto subscriber_impl = m_subscriber_impl.lock();
     if (subscriber_impl) static_cast<void>(subscriber_impl->RemoveReceiveCallback());
   }
 
+  size_t CSubscriber::ProcessReceiveQueue(int timeout_ms_)
+  {
+    auto subscriber_impl = m_subscriber_impl.lock();
+    if (subscriber_impl) return subscriber_impl->ProcessReceiveQueue(timeout_ms_);
+    return 0;
+  }
+
+  bool CSubscriber::SetContentFilter(const std::vector<SContentIdRange>& id_ranges_)
+  {
+    auto subscriber_impl = m_subscriber_impl.lock();
+    if (!subscriber_impl) return false;
+
+    std::vector<CContentIdFilter::RangeT> ranges;
+    ranges.reserve(id_ranges_.size());
+    for (const auto& id_range : id_ranges_)
+    {
+      ranges.emplace_back(id_range.min_id, id_range.max_id);
+    }
+    subscriber_impl->SetContentIdFilter(CContentIdFilter(std::move(ranges)));
+    return true;
+  }
+
   size_t CSubscriber::GetPublisherCount() const
   {
     auto subscriber_impl = m_subscriber_impl.lock();
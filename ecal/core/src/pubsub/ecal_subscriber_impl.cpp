@@ -51,21 +51,71 @@
 
 #if ECAL_CORE_TRANSPORT_TCP
 #include "readwrite/tcp/ecal_reader_tcp.h"
+#include "readwrite/tcp/ecal_tcp_frame.h"
 #include "readwrite/config/builder/tcp_attribute_builder.h"
 #endif
 
+#if ECAL_CORE_TRANSPORT_UDS
+#include "readwrite/uds/ecal_reader_uds.h"
+#include "readwrite/config/builder/uds_attribute_builder.h"
+#endif
+
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iostream>
 #include <iterator>
 #include <limits>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <utility>
 
+namespace
+{
+  // receive callbacks executed by the current thread, innermost first
+  class CReceiveCallbackScope
+  {
+  public:
+    explicit CReceiveCallbackScope(const eCAL::CSubscriberImpl* reader_) : m_reader(reader_), m_outer(m_innermost)
+    {
+      m_innermost = this;
+    }
+
+    ~CReceiveCallbackScope()
+    {
+      m_innermost = m_outer;
+    }
+
+    CReceiveCallbackScope(const CReceiveCallbackScope&) = delete;
+    CReceiveCallbackScope& operator=(const CReceiveCallbackScope&) = delete;
+
+    static bool IsExecuting(const eCAL::CSubscriberImpl* reader_)
+    {
+      for (const CReceiveCallbackScope* scope = m_innermost; scope != nullptr; scope = scope->m_outer)
+      {
+        if (scope->m_reader == reader_) return true;
+      }
+      return false;
+    }
+
+    static bool IsExecutingAny()
+    {
+      return m_innermost != nullptr;
+    }
+
+  private:
+    const eCAL::CSubscriberImpl*               m_reader;
+    const CReceiveCallbackScope*               m_outer;
+    static thread_local const CReceiveCallbackScope* m_innermost;
+  };
+
+  thread_local const CReceiveCallbackScope* CReceiveCallbackScope::m_innermost = nullptr;
+}
+
 namespace eCAL
 {
   ////////////////////////////////////////
@@ -77,7 +127,6 @@ namespace eCAL
                  m_topic_size(0),
                  m_receive_time(0),
                  m_clock(0),
-                 m_frequency_calculator(3.0f),
                  m_created(false),
                  m_attributes(attr_),
                  m_global_context(std::move(global_context_))
@@ -93,6 +142,18 @@ namespace eCAL
     m_topic_id.topic_id.host_name = m_attributes.host_name;
     m_topic_id.topic_id.process_id = m_attributes.process_id;
 
+    // create receive queue to decouple the receive callback from the transport threads
+    if (m_attributes.receive_queue.depth > 0)
+    {
+      m_receive_queue = std::make_shared<CReceiveQueue>(m_attributes.receive_queue, [this](const SQueuedSample& sample_) { ProcessQueuedSample(sample_); });
+    }
+
+    // create read ring to buffer more than the newest sample for polling receives
+    if (m_attributes.read_buffer_depth > 1)
+    {
+      m_read_ring = std::make_unique<MpmcRing<SReadSample>>(m_attributes.read_buffer_depth);
+    }
+
     // start transport layers
     InitializeLayers();
     StartTransportLayer();
@@ -113,11 +174,12 @@ namespace eCAL
     // stop transport layers
     StopTransportLayer();
 
-    // reset receive callback
-    {
-      const std::lock_guard<std::mutex> lock(m_receive_callback_mutex);
-      m_receive_callback = nullptr;
-    }
+    // stop receive queue executor
+    if (m_receive_queue) m_receive_queue->Stop();
+
+    // reset receive callback, a destroyed reader must not execute it anymore
+    StoreReceiveCallback(nullptr);
+    WaitForReceiveCallback();
 
     // mark as no more created
     m_created = false;
@@ -130,6 +192,19 @@ namespace eCAL
   {
     if (!m_created) return(false);
 
+    // read ring, take the oldest sample
+    if (m_read_ring)
+    {
+      auto take = [&buf_, time_](SReadSample& sample_)
+        {
+          // the buffer of the caller is reused for a following sample
+          buf_.swap(sample_.payload);
+          if (time_ != nullptr) *time_ = sample_.time;
+        };
+      if (m_read_ring->Pop(take)) return(true);
+      return WaitForReadRing(rcv_timeout_ms_, [this, &take]() { return m_read_ring->Pop(take); });
+    }
+
     std::unique_lock<std::mutex> read_buffer_lock(m_read_buf_mutex);
 
     // No need to wait (for whatever time) if something has been received
@@ -167,7 +242,71 @@ namespace eCAL
     return(false);
   }
 
-  bool CSubscriberImpl::SetReceiveCallback(const ReceiveCallbackT& callback_)
+  size_t CSubscriberImpl::ReadBatch(std::vector<std::string>& bufs_, std::vector<long long>* times_ /* = nullptr */, int rcv_timeout_ms_ /* = 0 */)
+  {
+    if (!m_created) return(0);
+
+    // single sample read buffer
+    if (!m_read_ring)
+    {
+      bufs_.resize(1);
+      long long time(0);
+      const size_t count = Read(bufs_[0], &time, rcv_timeout_ms_) ? 1 : 0;
+      bufs_.resize(count);
+      if (times_ != nullptr) times_->assign(count, time);
+      return(count);
+    }
+
+    // take the samples buffered now in one step, one buffer of the caller is exchanged per sample
+    size_t index(0);
+    auto take = [&bufs_, times_, &index](SReadSample& sample_)
+      {
+        if (index == bufs_.size()) bufs_.emplace_back();
+        bufs_[index].swap(sample_.payload);
+        if (times_ != nullptr)
+        {
+          if (index == times_->size()) times_->emplace_back();
+          (*times_)[index] = sample_.time;
+        }
+        index++;
+      };
+    const size_t max_count = m_read_ring->Capacity();
+    if (m_read_ring->PopBatch(take, max_count) == 0)
+    {
+      WaitForReadRing(rcv_timeout_ms_, [this, &take, max_count]() { return m_read_ring->PopBatch(take, max_count) > 0; });
+    }
+
+    bufs_.resize(index);
+    if (times_ != nullptr) times_->resize(index);
+    return(index);
+  }
+
+  bool CSubscriberImpl::WaitForReadRing(int rcv_timeout_ms_, const std::function<bool()>& take_)
+  {
+    if (rcv_timeout_ms_ == 0) return(false);
+
+    // the producers notify only while a consumer is waiting, the samples are taken under the
+    // read buffer mutex while waiting only, so a notification can not get lost
+    std::unique_lock<std::mutex> read_buffer_lock(m_read_buf_mutex);
+    m_read_ring_waiters++;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool taken(false);
+    if (rcv_timeout_ms_ < 0)
+    {
+      m_read_buf_cv.wait(read_buffer_lock, take_);
+      taken = true;
+    }
+    else
+    {
+      taken = m_read_buf_cv.wait_for(read_buffer_lock, std::chrono::milliseconds(rcv_timeout_ms_), take_);
+    }
+
+    m_read_ring_waiters--;
+    return taken;
+  }
+
+  bool CSubscriberImpl::SetReceiveCallback(const ReceiveCallbackT& callback_, const std::string& object_type_)
   {
     if (!m_created) return(false);
 
@@ -175,10 +314,13 @@ namespace eCAL
     eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CSubscriberImpl::SetReceiveCallback");
 #endif
 
-    // set receive callback
+    // set receive callback, called from a receive callback we do not wait (two callbacks replacing
+    // each others callback would wait for each other)
+    StoreReceiveCallback(callback_ ? std::make_shared<const ReceiveCallbackT>(callback_) : nullptr);
+    if (!CReceiveCallbackScope::IsExecutingAny()) WaitForReceiveCallback();
     {
-      const std::lock_guard<std::mutex> lock(m_receive_callback_mutex);
-      m_receive_callback = callback_;
+      const std::lock_guard<std::mutex> lock(m_receive_object_type_mutex);
+      m_receive_object_type = object_type_;
     }
 
     return(true);
@@ -194,9 +336,11 @@ namespace eCAL
 
     // remove receive callback
     {
-      const std::lock_guard<std::mutex> lock(m_receive_callback_mutex);
-      m_receive_callback = nullptr;
+      const std::lock_guard<std::mutex> lock(m_receive_object_type_mutex);
+      m_receive_object_type.clear();
     }
+    StoreReceiveCallback(nullptr);
+    if (!CReceiveCallbackScope::IsExecutingAny()) WaitForReceiveCallback();
 
     return(true);
   }
@@ -239,10 +383,30 @@ namespace eCAL
     eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CSubscriberImpl::SetFilterIDs");
 #endif
 
-    m_id_set = filter_ids_;
+    std::vector<CContentIdFilter::RangeT> ranges;
+    ranges.reserve(filter_ids_.size());
+    for (const auto& filter_id : filter_ids_)
+    {
+      ranges.emplace_back(filter_id, filter_id);
+    }
+    SetContentIdFilter(CContentIdFilter(std::move(ranges)));
   }
 
-  void CSubscriberImpl::ApplyPublisherRegistration(const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& pub_layer_states_)
+  void CSubscriberImpl::SetContentIdFilter(const CContentIdFilter& filter_)
+  {
+#ifndef NDEBUG
+    eCAL::Logging::Log(Logging::log_level_debug2, m_attributes.topic_name + "::CSubscriberImpl::SetContentIdFilter");
+#endif
+
+    std::shared_ptr<const CContentIdFilter> content_id_filter;
+    if (!filter_.AcceptsAll()) content_id_filter = std::make_shared<const CContentIdFilter>(filter_);
+    std::atomic_store(&m_content_id_filter, content_id_filter);
+
+    // let the publishers know the new filter immediately
+    if (m_created) Register();
+  }
+
+  void CSubscriberImpl::ApplyPublisherRegistration(const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& pub_layer_states_, long long data_clock_)
   {
     // flag write enabled from publisher side (information not used yet)
 #if ECAL_CORE_TRANSPORT_UDP
@@ -254,6 +418,15 @@ namespace eCAL
 #if ECAL_CORE_TRANSPORT_TCP
     m_layers.tcp.write_enabled = pub_layer_states_.tcp.write_enabled;
 #endif
+#if ECAL_CORE_TRANSPORT_INPROC
+    m_layers.inproc.write_enabled = pub_layer_states_.inproc.write_enabled;
+#endif
+#if ECAL_CORE_TRANSPORT_UDS
+    m_layers.uds.write_enabled = pub_layer_states_.uds.write_enabled;
+#endif
+
+    // report delivery statistics to publishers with adaptive layer selection
+    m_layer_statistics.SetReportingEnabled(publication_info_.entity_id, pub_layer_states_.report_statistics);
 
     // add key to connection map, including connection state
     bool is_new_connection = false;
@@ -286,6 +459,22 @@ namespace eCAL
       m_connection_count = GetConnectionCount();
     }
 
+    // data type handed over to the receive callback
+    {
+      const auto publication_state = GetPublicationState(publication_info_);
+      const std::lock_guard<std::mutex> lock(publication_state->mutex);
+      if (!publication_state->data_type_info || !(*publication_state->data_type_info == data_type_info_))
+      {
+        publication_state->data_type_info = std::make_shared<const SDataTypeInformation>(data_type_info_);
+      }
+
+      // everything the publisher sent before we have seen it is history
+      if (publication_state->history_clock < 0)
+      {
+        publication_state->history_clock = data_clock_;
+      }
+    }
+
     // handle these events outside the lock
     if (is_new_connection)
     {
@@ -310,6 +499,21 @@ namespace eCAL
       m_connection_count = GetConnectionCount();
     }
 
+    m_layer_statistics.RemovePublisher(publication_info_.entity_id);
+
+#if ECAL_CORE_TRANSPORT_TCP
+    // forget the host name of the writer
+    if (m_global_context.tcp_layer) m_global_context.tcp_layer->RemPublisher(m_attributes.topic_name, publication_info_.entity_id);
+#endif
+
+    // the publication state is kept, it still counts the message drops of this publisher
+    const auto publication_state = FindPublicationState(publication_info_.entity_id);
+    if (publication_state)
+    {
+      const std::lock_guard<std::mutex> lock(publication_state->mutex);
+      publication_state->data_type_info.reset();
+    }
+
     // fire disconnect event
     FireDisconnectEvent(publication_info_, data_type_info_);
     
@@ -337,6 +541,11 @@ namespace eCAL
     case tl_ecal_tcp:
 #if ECAL_CORE_TRANSPORT_TCP
       if (m_global_context.tcp_layer) m_global_context.tcp_layer->SetConnectionParameter(par);
+#endif
+      break;
+    case tl_ecal_uds:
+#if ECAL_CORE_TRANSPORT_UDS
+      if (m_global_context.uds_layer) m_global_context.uds_layer->SetConnectionParameter(par);
 #endif
       break;
     default:
@@ -369,12 +578,19 @@ namespace eCAL
       if (m_global_context.tcp_layer) m_global_context.tcp_layer->Initialize(eCAL::eCALReader::BuildTCPLayerAttributes(m_attributes));
     }
 #endif
+
+    // initialize uds layer
+#if ECAL_CORE_TRANSPORT_UDS
+    if (m_attributes.uds.enable)
+    {
+      if (m_global_context.uds_layer) m_global_context.uds_layer->Initialize(eCAL::eCALReader::BuildUDSLayerAttributes(m_attributes));
+    }
+#endif
   }
 
-  size_t CSubscriberImpl::ApplySample(const Payload::TopicInfo& topic_info_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t /*hash_*/, eTLayerType layer_)
+  size_t CSubscriberImpl::ApplySample(const Payload::TopicInfoView& topic_info_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t /*hash_*/, eTLayerType layer_, const SInprocObject* object_, CSharedPayload* shared_payload_)
   {
-    // ensure thread safety
-    const std::lock_guard<std::mutex> lock(m_receive_callback_mutex);
+    // no reader wide lock is taken here, the samples of different publications are applied concurrently
     if (!m_created) return(0);
 
     // We don't want to apply samples which are received on layers which are not activated for this subscriber
@@ -383,25 +599,77 @@ namespace eCAL
       return 0;
     }
 
-    auto publication_info = PublicationInfoFromTopicInfo(topic_info_);
+    // Message objects are used if we accept their type, samples without serialized payload are useless otherwise
+    const bool use_object = (object_ != nullptr) && (object_->object != nullptr) && AcceptsInprocObject(object_->type);
+    if ((object_ != nullptr) && !object_->serialized && !use_object)
+    {
+      return 0;
+    }
+
+    // resolve the publication once, the following checks and statistics work on its state
+    const auto publication_state = GetPublicationState(topic_info_);
 
-    // We do not want to apply duplicate / old samples
-    if (!ShouldApplySampleBasedOnClock(publication_info, clock_))
+    // Delivery statistics per layer for publishers with adaptive layer selection,
+    // samples are counted before the duplicates of the other layers are dropped
+    if (m_layer_statistics.IsEnabled())
     {
-      // not clear why we are returning the size_ if we are not applying the sample, but why not...
-      return size_;
+      m_layer_statistics.AddSample(layer_, topic_info_.topic_id, size_, eCAL::Time::GetMicroSeconds() - time_);
     }
 
-    // We might not want to apply samples sent with a given ID (deprecated!)
-    if (!ShouldApplySampleBasedOnId(id_))
+    std::shared_ptr<const SDataTypeInformation> data_type_info;
     {
-      return 0;
+      // check and count the sample in one step, the same sample may arrive on several layers concurrently
+      const std::lock_guard<std::mutex> publication_lock(publication_state->mutex);
+
+      // We do not want to apply duplicate / old samples
+      if (!ShouldApplySampleBasedOnClock(*publication_state, clock_))
+      {
+        // not clear why we are returning the size_ if we are not applying the sample, but why not...
+        return size_;
+      }
+
+      // We do not want to apply replayed history if we did not ask for it
+      // (the publisher replays it if another subscriber on the same layer joins late)
+      if (!ShouldApplySampleBasedOnHistory(*publication_state, clock_))
+      {
+        return 0;
+      }
+
+      // We do not want to apply samples outside of the content filter
+      // (the publisher sends them if another subscriber on the same layer accepts them)
+      if (!ShouldApplySampleBasedOnId(id_))
+      {
+        return 0;
+      }
+
+      // We do not want to apply samples above the requested rate
+      // (the publisher sends them if another subscriber on the same layer is due)
+      if (!publication_state->rate_limiter.Pass(std::chrono::steady_clock::now()))
+      {
+        return 0;
+      }
+
+      // the publisher skips samples on purpose for filtered and rate limited subscribers, these are no drops
+      // (the duplicate detection needs the counter of every applied sample anyway)
+      const bool count_drops = !publication_state->rate_limiter.IsLimited() && !std::atomic_load(&m_content_id_filter);
+      TriggerMessageDropUdate(*publication_state, clock_, count_drops);
+      TriggerStatisticsUpdate(*publication_state, time_);
+
+      data_type_info = publication_state->data_type_info;
     }
 
-    // store receive layer
-    m_layers.udp.active |= layer_ == tl_ecal_udp;
-    m_layers.shm.active |= layer_ == tl_ecal_shm;
-    m_layers.tcp.active |= layer_ == tl_ecal_tcp;
+    // store receive layer (read first, the flag is set once only)
+    auto mark_active = [](std::atomic<bool>& active_) { if (!active_.load(std::memory_order_relaxed)) active_.store(true, std::memory_order_relaxed); };
+    switch (layer_)
+    {
+    case tl_ecal_udp:    mark_active(m_active_layers.udp);    break;
+    case tl_ecal_shm:    mark_active(m_active_layers.shm);    break;
+    case tl_ecal_tcp:    mark_active(m_active_layers.tcp);    break;
+    case tl_ecal_inproc: mark_active(m_active_layers.inproc); break;
+    case tl_ecal_uds:    mark_active(m_active_layers.uds);    break;
+    default:
+      break;
+    }
 
 #ifndef NDEBUG
     // log it
@@ -411,9 +679,6 @@ namespace eCAL
     // increase read clock
     m_clock++;
 
-    TriggerMessageDropUdate(publication_info, clock_);
-    TriggerStatisticsUpdate(time_);
-
     // reset timeout
     m_receive_time = 0;
 
@@ -423,40 +688,79 @@ namespace eCAL
     // execute callback
     bool processed = false;
     {
-      // call user receive callback function
-      if(m_receive_callback)
+      // call user receive callback function (loaded once for this sample)
+      const CReceiveCallbackRef callback(*this);
+      if(callback.Get())
       {
 #ifndef NDEBUG
         // log it
         eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CSubscriberImpl::ApplySample::ReceiveCallback");
 #endif
-        // prepare data struct
-        SReceiveCallbackData cb_data;
-        cb_data.buffer   = static_cast<const void*>(payload_);
-        cb_data.buffer_size  = size_;
-        cb_data.send_timestamp  = time_;
-        cb_data.send_clock = clock_;
-
         STopicId topic_id;
         topic_id.topic_name          = topic_info_.topic_name;
         topic_id.topic_id.host_name  = topic_info_.host_name;
         topic_id.topic_id.entity_id  = topic_info_.topic_id;
         topic_id.topic_id.process_id = topic_info_.process_id;
 
-        SPublicationInfo pub_info;
-        pub_info.entity_id  = topic_info_.topic_id;
-        pub_info.host_name  = topic_info_.host_name;
-        pub_info.process_id = topic_info_.process_id;
-
-        // execute it
-        const std::lock_guard<std::mutex> exec_lock(m_connection_map_mtx);
-        (m_receive_callback)(topic_id, m_connection_map[pub_info].data_type_info, cb_data);
-        processed = true;
+        if (m_receive_queue)
+        {
+          // queue a copy, the callback is executed by the queue executor
+          if (shared_payload_ != nullptr)
+          {
+            // the readers of this sample share one copy of the payload
+            m_receive_queue->Push(topic_id, publication_state->publication_info, shared_payload_->Get(), time_, clock_);
+          }
+          else
+          {
+            m_receive_queue->Push(topic_id, publication_state->publication_info, payload_, size_, time_, clock_);
+          }
+          processed = true;
+        }
+        else
+        {
+          // prepare data struct
+          SReceiveCallbackData cb_data;
+          cb_data.buffer   = static_cast<const void*>(payload_);
+          cb_data.buffer_size  = size_;
+          cb_data.send_timestamp  = time_;
+          cb_data.send_clock = clock_;
+          cb_data.object = use_object ? object_->object : nullptr;
+
+          // execute it
+          static const SDataTypeInformation unknown_data_type_info;
+          ExecuteReceiveCallback(*callback.Get(), topic_id, data_type_info ? *data_type_info : unknown_data_type_info, cb_data);
+          processed = true;
+        }
       }
     }
 
+    // if not consumed by user receive call, push sample into read ring
+    if (!processed && m_read_ring)
+    {
+      const bool pushed = m_read_ring->Push([payload_, size_, time_](SReadSample& sample_)
+        {
+          // the slot keeps the capacity of the buffer it got from the last receive
+          sample_.payload.assign(payload_, size_);
+          sample_.time = time_;
+        });
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      // inform receive
+      if (m_read_ring_waiters > 0)
+      {
+        const std::lock_guard<std::mutex> read_buffer_lock(m_read_buf_mutex);
+        m_read_buf_cv.notify_all();
+      }
+      if (!pushed)
+      {
+#ifndef NDEBUG
+        // log it
+        eCAL::Logging::Log(Logging::log_level_debug3, m_attributes.topic_name + "::CSubscriberImpl::ApplySample::Receive::ReadBufferFull");
+#endif
+      }
+    }
     // if not consumed by user receive call
-    if (!processed)
+    else if (!processed)
     {
       // push sample into read buffer
       const std::lock_guard<std::mutex> read_buffer_lock(m_read_buf_mutex);
@@ -548,7 +852,11 @@ namespace eCAL
       udp_tlayer.type      = tl_ecal_udp;
       udp_tlayer.version   = ecal_transport_layer_version;
       udp_tlayer.enabled   = m_layers.udp.read_enabled;
-      udp_tlayer.active    = m_layers.udp.active;
+      udp_tlayer.active    = m_active_layers.udp;
+      m_layer_statistics.GetStatistics(tl_ecal_udp, udp_tlayer.statistics);
+      udp_tlayer.par_layer.layer_par_udpmc.sample_batch  = true;
+      udp_tlayer.par_layer.layer_par_udpmc.fec_fragments = true;
+      if (m_global_context.udp_layer) udp_tlayer.par_layer.layer_par_udpmc.nack_id = m_global_context.udp_layer->GetNackId();
       ecal_reg_sample_topic.transport_layer.push_back(udp_tlayer);
     }
 #endif
@@ -560,7 +868,9 @@ namespace eCAL
       shm_tlayer.type      = tl_ecal_shm;
       shm_tlayer.version   = ecal_transport_layer_version;
       shm_tlayer.enabled   = m_layers.shm.read_enabled;
-      shm_tlayer.active    = m_layers.shm.active;
+      shm_tlayer.active    = m_active_layers.shm;
+      m_layer_statistics.GetStatistics(tl_ecal_shm, shm_tlayer.statistics);
+      shm_tlayer.par_layer.layer_par_shm.sample_batch = true;
       ecal_reg_sample_topic.transport_layer.push_back(shm_tlayer);
     }
 #endif
@@ -572,20 +882,70 @@ namespace eCAL
       tcp_tlayer.type      = tl_ecal_tcp;
       tcp_tlayer.version   = ecal_transport_layer_version;
       tcp_tlayer.enabled   = m_layers.tcp.read_enabled;
-      tcp_tlayer.active    = m_layers.tcp.active;
+      tcp_tlayer.active    = m_active_layers.tcp;
+      m_layer_statistics.GetStatistics(tl_ecal_tcp, tcp_tlayer.statistics);
+      tcp_tlayer.par_layer.layer_par_tcp.frame_version = TCP::frame_version_v2;
       ecal_reg_sample_topic.transport_layer.push_back(tcp_tlayer);
     }
 #endif
 
+#if ECAL_CORE_TRANSPORT_INPROC
+    // inproc layer
+    {
+      Registration::TLayer inproc_tlayer;
+      inproc_tlayer.type      = tl_ecal_inproc;
+      inproc_tlayer.version   = ecal_transport_layer_version;
+      inproc_tlayer.enabled   = m_layers.inproc.read_enabled;
+      inproc_tlayer.active    = m_active_layers.inproc;
+      ecal_reg_sample_topic.transport_layer.push_back(inproc_tlayer);
+    }
+#endif
+
+#if ECAL_CORE_TRANSPORT_UDS
+    // uds layer
+    {
+      Registration::TLayer uds_tlayer;
+      uds_tlayer.type      = tl_ecal_uds;
+      uds_tlayer.version   = ecal_transport_layer_version;
+      uds_tlayer.enabled   = m_layers.uds.read_enabled;
+      uds_tlayer.active    = m_active_layers.uds;
+      m_layer_statistics.GetStatistics(tl_ecal_uds, uds_tlayer.statistics);
+      ecal_reg_sample_topic.transport_layer.push_back(uds_tlayer);
+    }
+#endif
+
     ecal_reg_sample_topic.process_name   = m_attributes.process_name;
     ecal_reg_sample_topic.unit_name      = m_attributes.unit_name;
     ecal_reg_sample_topic.data_clock     = m_clock;
+    ecal_reg_sample_topic.data_frequency = GetFrequency();
+    ecal_reg_sample_topic.latency_us     = GetLatencyStatistics();
+    ecal_reg_sample_topic.message_drops  = GetMessageDropsAndFireDroppedEvents();
+
+    if (m_receive_queue)
     {
-      const std::lock_guard<std::mutex> lock(m_statistics_mutex);
-      ecal_reg_sample_topic.data_frequency = GetFrequency();
-      ecal_reg_sample_topic.latency_us = m_latency_us_calculator.GetStatistics();
+      const SReceiveQueueStatistics queue_statistics = m_receive_queue->GetStatistics();
+      ecal_reg_sample_topic.receive_queue_depth           = queue_statistics.depth;
+      ecal_reg_sample_topic.receive_queue_size            = queue_statistics.size;
+      ecal_reg_sample_topic.receive_queue_high_water_mark = queue_statistics.high_water_mark;
+      ecal_reg_sample_topic.receive_queue_drops           = queue_statistics.drops;
+    }
+
+    // rate limit and content filter, evaluated by the publishers
+    ecal_reg_sample_topic.max_frequency = static_cast<int32_t>(std::lround(m_attributes.max_frequency_hz * 1000.0));
+
+    // late joiner history, replayed by the publishers on connect
+    ecal_reg_sample_topic.history_replay = m_attributes.receive_history;
+
+    const auto content_id_filter = std::atomic_load(&m_content_id_filter);
+    if (content_id_filter)
+    {
+      for (const auto& range : content_id_filter->GetRanges())
+      {
+        auto& content_id_range  = ecal_reg_sample_topic.content_id_filter.push_back();
+        content_id_range.min_id = range.first;
+        content_id_range.max_id = range.second;
+      }
     }
-    ecal_reg_sample_topic.message_drops  = GetMessageDropsAndFireDroppedEvents();
 
     // we do not know the number of connections ..
     ecal_reg_sample_topic.connections_local = 0;
@@ -643,6 +1003,25 @@ namespace eCAL
       if (m_global_context.tcp_layer) m_global_context.tcp_layer->AddSubscription(m_attributes.host_name, m_attributes.topic_name, m_subscriber_id);
     }
 #endif
+
+#if ECAL_CORE_TRANSPORT_INPROC
+    if (m_attributes.inproc.enable)
+    {
+      // flag enabled, samples are applied by the publishers of this process directly
+      m_layers.inproc.read_enabled = true;
+    }
+#endif
+
+#if ECAL_CORE_TRANSPORT_UDS
+    if (m_attributes.uds.enable)
+    {
+      // flag enabled
+      m_layers.uds.read_enabled = true;
+
+      // subscribe to layer (if supported)
+      if (m_global_context.uds_layer) m_global_context.uds_layer->AddSubscription(m_attributes.host_name, m_attributes.topic_name, m_subscriber_id);
+    }
+#endif
   }
   
   void CSubscriberImpl::StopTransportLayer()
@@ -679,6 +1058,25 @@ namespace eCAL
       if (m_global_context.tcp_layer) m_global_context.tcp_layer->RemSubscription(m_attributes.host_name, m_attributes.topic_name, m_subscriber_id);
     }
 #endif
+
+#if ECAL_CORE_TRANSPORT_INPROC
+    if (m_attributes.inproc.enable)
+    {
+      // flag disabled
+      m_layers.inproc.read_enabled = false;
+    }
+#endif
+
+#if ECAL_CORE_TRANSPORT_UDS
+    if (m_attributes.uds.enable)
+    {
+      // flag disabled
+      m_layers.uds.read_enabled = false;
+
+      // unsubscribe from layer (if supported)
+      if (m_global_context.uds_layer) m_global_context.uds_layer->RemSubscription(m_attributes.host_name, m_attributes.topic_name, m_subscriber_id);
+    }
+#endif
   }
 
   void CSubscriberImpl::FireEvent(const eSubscriberEvent type_, const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_)
@@ -718,7 +1116,7 @@ namespace eCAL
     FireEvent(eSubscriberEvent::dropped, publication_info_, data_type_info_);
   }
 
-  CSubscriberImpl::SPublicationInfo CSubscriberImpl::PublicationInfoFromTopicInfo(const Payload::TopicInfo& topic_info_)
+  CSubscriberImpl::SPublicationInfo CSubscriberImpl::PublicationInfoFromTopicInfo(const Payload::TopicInfoView& topic_info_)
   {
     SPublicationInfo publication_info;
     publication_info.entity_id = topic_info_.topic_id;
@@ -741,10 +1139,50 @@ namespace eCAL
     return count;
   }
 
-  bool CSubscriberImpl::ShouldApplySampleBasedOnClock(const SPublicationInfo& publication_info_, long long clock_) const
+  std::shared_ptr<CSubscriberImpl::SPublicationState> CSubscriberImpl::FindPublicationState(EntityIdT entity_id_) const
+  {
+    const std::shared_lock<std::shared_timed_mutex> lock(m_publication_state_mutex);
+    auto iter = m_publication_states.find(entity_id_);
+    if (iter == m_publication_states.end()) return nullptr;
+    return iter->second;
+  }
+
+  std::shared_ptr<CSubscriberImpl::SPublicationState> CSubscriberImpl::GetPublicationState(const Payload::TopicInfoView& topic_info_)
+  {
+    auto publication_state = FindPublicationState(topic_info_.topic_id);
+    if (publication_state) return publication_state;
+
+    // first sample of this publication, samples may arrive before its registration
+    return GetPublicationState(PublicationInfoFromTopicInfo(topic_info_));
+  }
+
+  std::shared_ptr<CSubscriberImpl::SPublicationState> CSubscriberImpl::GetPublicationState(const SPublicationInfo& publication_info_)
+  {
+    auto publication_state = FindPublicationState(publication_info_.entity_id);
+    if (publication_state) return publication_state;
+
+    const std::unique_lock<std::shared_timed_mutex> lock(m_publication_state_mutex);
+    auto& new_publication_state = m_publication_states[publication_info_.entity_id];
+    if (!new_publication_state) new_publication_state = std::make_shared<SPublicationState>(publication_info_, m_attributes.max_frequency_hz);
+    return new_publication_state;
+  }
+
+  std::vector<std::shared_ptr<CSubscriberImpl::SPublicationState>> CSubscriberImpl::GetPublicationStates() const
+  {
+    std::vector<std::shared_ptr<SPublicationState>> publication_states;
+    const std::shared_lock<std::shared_timed_mutex> lock(m_publication_state_mutex);
+    publication_states.reserve(m_publication_states.size());
+    for (const auto& publication_state : m_publication_states)
+    {
+      publication_states.push_back(publication_state.second);
+    }
+    return publication_states;
+  }
+
+  bool CSubscriberImpl::ShouldApplySampleBasedOnClock(const SPublicationState& publication_state_, long long clock_) const
   {
     // If counter is already present (duplicate), or unsure if it was present, the sample is not applied
-    if (m_publisher_message_counter_map.HasCounter(publication_info_, clock_) != CounterCacheMapT::CounterInCache::False)
+    if (publication_state_.counter_cache.HasCounter(clock_) != CounterCache<>::CounterInCache::False)
     {
 #ifndef NDEBUG
       // log it
@@ -754,9 +1192,16 @@ namespace eCAL
       return false;
     }
 
+    // Replayed history of a publication is older than the samples received since the publisher registration.
+    // It is applied if it was not received before, the out of order check does not apply.
+    if (m_attributes.receive_history && (clock_ <= publication_state_.history_clock))
+    {
+      return true;
+    }
+
     // The sample counter is strictly monotonically increasing. If not so, we received an old message.
     // If it is applied or not depends on the configuration. Anyways, a message at low debug level is logged.
-    if (!m_publisher_message_counter_map.IsMonotonic(publication_info_, clock_))
+    if (!publication_state_.counter_cache.IsMonotonic(clock_))
     {
 #ifndef NDEBUG
       std::string msg = "Subscriber: \'";
@@ -782,33 +1227,144 @@ namespace eCAL
 
   bool CSubscriberImpl::ShouldApplySampleBasedOnId(long long id_) const
   {
-    // 
-    if (!m_id_set.empty() && (m_id_set.find(id_) == m_id_set.end()))
-    {
-      return false;
-    }
+    const auto content_id_filter = std::atomic_load(&m_content_id_filter);
+    return !content_id_filter || content_id_filter->Accepts(id_);
+  }
 
-    return true;
+  bool CSubscriberImpl::ShouldApplySampleBasedOnHistory(const SPublicationState& publication_state_, long long clock_) const
+  {
+    if (m_attributes.receive_history) return true;
+    return (publication_state_.history_clock < 0) || (clock_ > publication_state_.history_clock);
   }
 
-  void CSubscriberImpl::TriggerStatisticsUpdate(long long send_time_)
+  void CSubscriberImpl::TriggerStatisticsUpdate(SPublicationState& publication_state_, long long send_time_)
   {
     const auto receive_time_us = eCAL::Time::GetMicroSeconds();
     const eCAL::Time::ecal_clock::time_point receive_time_clock{ std::chrono::microseconds(send_time_) };
-    
-    const std::lock_guard<std::mutex> freq_lock(m_statistics_mutex);
-    m_frequency_calculator.addTick(receive_time_clock);
+
+    publication_state_.frequency_calculator.addTick(receive_time_clock);
 
     auto latency_us = receive_time_us - send_time_;
 
-    m_latency_us_calculator.Update(static_cast<double>(latency_us));
+    publication_state_.latency_us_calculator.Update(static_cast<double>(latency_us));
+    publication_state_.last_receive_time_us = receive_time_us;
+  }
+
+  void CSubscriberImpl::TriggerMessageDropUdate(SPublicationState& publication_state_, uint64_t message_counter, bool count_drops_)
+  {
+    if (count_drops_) publication_state_.drop_calculator.RegisterReceivedMessage(message_counter);
+    publication_state_.counter_cache.SetCounter(message_counter);
+  }
+
+  size_t CSubscriberImpl::ProcessReceiveQueue(int timeout_ms_)
+  {
+    if (!m_created) return 0;
+    if (!m_receive_queue || (m_attributes.receive_queue.executor != Subscriber::ReceiveQueue::eExecutor::caller)) return 0;
+
+    return m_receive_queue->Process(timeout_ms_);
+  }
+
+  bool CSubscriberImpl::SetReceiveNotifier(const std::shared_ptr<CReceiveNotifier>& notifier_)
+  {
+    if (!m_created) return false;
+    if (!m_receive_queue || (m_attributes.receive_queue.executor != Subscriber::ReceiveQueue::eExecutor::caller)) return false;
+
+    return m_receive_queue->SetNotifier(notifier_);
+  }
+
+  void CSubscriberImpl::ResetReceiveNotifier(const CReceiveNotifier* notifier_)
+  {
+    if (m_receive_queue) m_receive_queue->ResetNotifier(notifier_);
+  }
+
+  bool CSubscriberImpl::HasQueuedSamples() const
+  {
+    return m_receive_queue && !m_receive_queue->Empty();
   }
 
-  void CSubscriberImpl::TriggerMessageDropUdate(const SPublicationInfo& publication_info_, uint64_t message_counter)
+  CSubscriberImpl::CReceiveCallbackRef::CReceiveCallbackRef(CSubscriberImpl& reader_) : m_reader(reader_)
   {
-    const std::lock_guard<std::mutex> lock(m_message_drop_map_mutex);
-    m_message_drop_map.RegisterReceivedMessage(publication_info_, message_counter);
-    m_publisher_message_counter_map.SetCounter(publication_info_, message_counter);
+    // counted before the load, a replacing call that stored the new callback afterwards sees this one running
+    m_reader.m_receive_callback_running++;
+    m_callback = std::atomic_load(&m_reader.m_receive_callback);
+  }
+
+  CSubscriberImpl::CReceiveCallbackRef::~CReceiveCallbackRef()
+  {
+    if ((--m_reader.m_receive_callback_running == 0) && (m_reader.m_receive_callback_waiters > 0))
+    {
+      const std::lock_guard<std::mutex> wait_lock(m_reader.m_receive_callback_wait_mutex);
+      m_reader.m_receive_callback_wait_cv.notify_all();
+    }
+  }
+
+  void CSubscriberImpl::StoreReceiveCallback(const ReceiveCallbackPtrT& callback_)
+  {
+    std::atomic_store(&m_receive_callback, callback_);
+  }
+
+  void CSubscriberImpl::WaitForReceiveCallback()
+  {
+    // a callback replacing or removing itself does not wait for its own end
+    if (CReceiveCallbackScope::IsExecuting(this)) return;
+
+    // callbacks loaded before the callback was replaced finish first
+    m_receive_callback_waiters++;
+    {
+      std::unique_lock<std::mutex> wait_lock(m_receive_callback_wait_mutex);
+      m_receive_callback_wait_cv.wait(wait_lock, [this]() { return m_receive_callback_running == 0; });
+    }
+    m_receive_callback_waiters--;
+  }
+
+  void CSubscriberImpl::ExecuteReceiveCallback(const ReceiveCallbackT& callback_, const STopicId& topic_id_, const SDataTypeInformation& data_type_info_, const SReceiveCallbackData& cb_data_)
+  {
+    // no internal lock is held, the callback may call back into eCAL (a callback sending to its
+    // own topic intra process applies the sample nested on the same thread)
+    const CReceiveCallbackScope callback_scope(this);
+    callback_(topic_id_, data_type_info_, cb_data_);
+  }
+
+  void CSubscriberImpl::ProcessQueuedSample(const SQueuedSample& sample_)
+  {
+    // the callback may destroy this subscriber, it lives until the sample is processed
+    const std::shared_ptr<CSubscriberImpl> self = weak_from_this().lock();
+    if (!self || !m_created) return;
+
+    std::shared_ptr<const SDataTypeInformation> data_type_info;
+    const auto publication_state = FindPublicationState(sample_.publication_info.entity_id);
+    if (publication_state)
+    {
+      const std::lock_guard<std::mutex> publication_lock(publication_state->mutex);
+      data_type_info = publication_state->data_type_info;
+    }
+
+    // prepare data struct
+    SReceiveCallbackData cb_data;
+    cb_data.buffer         = static_cast<const void*>(sample_.PayloadData());
+    cb_data.buffer_size    = sample_.PayloadSize();
+    cb_data.send_timestamp = sample_.time;
+    cb_data.send_clock     = sample_.clock;
+
+    // execute it, the callback may have been removed since the sample was queued
+    const CReceiveCallbackRef callback(*this);
+    if (!callback.Get()) return;
+    static const SDataTypeInformation unknown_data_type_info;
+    ExecuteReceiveCallback(*callback.Get(), sample_.topic_id, data_type_info ? *data_type_info : unknown_data_type_info, cb_data);
+  }
+
+  bool CSubscriberImpl::AcceptsInprocObject(const char* object_type_) const
+  {
+    // intra process samples are not applied to this reader at all
+    if (!m_attributes.inproc.enable) return true;
+
+    // queued samples outlive the send call, they need the serialized payload
+    if (m_receive_queue) return false;
+
+    if (object_type_ == nullptr) return false;
+
+    const std::lock_guard<std::mutex> lock(m_receive_object_type_mutex);
+    return !m_receive_object_type.empty() && (m_receive_object_type == object_type_);
   }
 
   bool CSubscriberImpl::ShouldApplySampleBasedOnLayer(eTLayerType layer_) const
@@ -825,6 +1381,12 @@ namespace eCAL
     case tl_ecal_tcp:
       if (!m_attributes.tcp.enable) return false;
       break;
+    case tl_ecal_inproc:
+      if (!m_attributes.inproc.enable) return false;
+      break;
+    case tl_ecal_uds:
+      if (!m_attributes.uds.enable) return false;
+      break;
     default:
       break;
     }
@@ -836,7 +1398,15 @@ namespace eCAL
   {
     const auto frequency_time = eCAL::Time::ecal_clock::now();
 
-    const double frequency_in_mhz = m_frequency_calculator.getFrequency(frequency_time) * 1000;
+    // the frequencies of the publications add up to the receive frequency of this reader
+    double frequency(0.0);
+    for (const auto& publication_state : GetPublicationStates())
+    {
+      const std::lock_guard<std::mutex> lock(publication_state->mutex);
+      frequency += publication_state->frequency_calculator.getFrequency(frequency_time);
+    }
+
+    const double frequency_in_mhz = frequency * 1000;
 
     if (frequency_in_mhz > static_cast<double>(std::numeric_limits<int32_t>::max())) {
       return std::numeric_limits<int32_t>::max();
@@ -847,26 +1417,51 @@ namespace eCAL
     return static_cast<int32_t>(frequency_in_mhz);
   }
 
-  int32_t CSubscriberImpl::GetMessageDropsAndFireDroppedEvents()
+  Registration::Statistics CSubscriberImpl::GetLatencyStatistics()
   {
-    const std::lock_guard<std::mutex> lock_drops(m_message_drop_map_mutex);
-    const std::lock_guard<std::mutex> lock_connections(m_connection_map_mtx);
+    struct SLatencyStatistics
+    {
+      long long                last_receive_time_us;
+      Registration::Statistics statistics;
+    };
+    std::vector<SLatencyStatistics> publication_statistics;
+    for (const auto& publication_state : GetPublicationStates())
+    {
+      const std::lock_guard<std::mutex> lock(publication_state->mutex);
+      publication_statistics.push_back({ publication_state->last_receive_time_us, publication_state->latency_us_calculator.GetStatistics() });
+    }
 
-    auto message_drop_summary_map = m_message_drop_map.GetSummary();
+    // combine the publications, the most recent one provides the latest latency
+    std::sort(publication_statistics.begin(), publication_statistics.end(), [](const SLatencyStatistics& lhs_, const SLatencyStatistics& rhs_) { return lhs_.last_receive_time_us < rhs_.last_receive_time_us; });
+    StatisticsCalculator latency_us_calculator;
+    for (const auto& statistics : publication_statistics)
+    {
+      latency_us_calculator.Merge(statistics.statistics);
+    }
+    return latency_us_calculator.GetStatistics();
+  }
+
+  int32_t CSubscriberImpl::GetMessageDropsAndFireDroppedEvents()
+  {
     int32_t accumulated_message_drops = 0;
 
-    for (const auto& message_drop_summary_pair : message_drop_summary_map)
+    for (const auto& publication_state : GetPublicationStates())
     {
-      const auto& publisher_info = message_drop_summary_pair.first;
-      const auto& message_drop_summary = message_drop_summary_pair.second;
+      MessageDropCalculator::Summary message_drop_summary;
+      std::shared_ptr<const SDataTypeInformation> data_type_info;
+      {
+        const std::lock_guard<std::mutex> lock(publication_state->mutex);
+        message_drop_summary = publication_state->drop_calculator.GetSummary();
+        data_type_info       = publication_state->data_type_info;
+      }
 
       if (message_drop_summary.new_drops)
       {
         // @TODO: Firing dropped events should happen from a different thread, we should queue this somehow...
-        FireDroppedEvent(publisher_info, m_connection_map[publisher_info].data_type_info);
+        FireDroppedEvent(publication_state->publication_info, data_type_info ? *data_type_info : SDataTypeInformation());
       }
 
-      accumulated_message_drops += message_drop_summary.drops;
+      accumulated_message_drops += static_cast<int32_t>(message_drop_summary.drops);
     }
 
     return accumulated_message_drops;
@@ -30,10 +30,15 @@
 
 #include "serialization/ecal_serialize_sample_payload.h"
 #include "serialization/ecal_serialize_sample_registration.h"
+#include "pubsub/ecal_adaptive_layer_selection.h"
+#include "pubsub/ecal_receive_queue.h"
+#include "util/content_id_filter.h"
 #include "util/frequency_calculator.h"
 #include "util/message_drop_calculator.h"
+#include "util/rate_limiter.h"
 #include "util/statistics_calculator.h"
 #include "util/counter_cache.h"
+#include "util/mpmc_ring.h"
 #include "readwrite/config/attributes/reader_attributes.h"
 
 #include <atomic>
@@ -41,12 +46,16 @@
 #include <condition_variable>
 #include <cstddef>
 #include <deque>
+#include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace eCAL
 {
@@ -54,17 +63,27 @@ namespace eCAL
   class CSHMReaderLayer;
   class CUDPReaderLayer;
   class CTCPReaderLayer;
+  class CUDSReaderLayer;
   class CRegistrationProvider;
 
+  // message object handed over by a publisher of the same process (typed intra process delivery)
+  struct SInprocObject
+  {
+    const void* object     = nullptr;
+    const char* type       = nullptr;
+    bool        serialized = true;      // payload buffer contains the serialized object
+  };
+
   struct SSubscriberGlobalContext // SSubscriberContext, SSubscriberGlobalDependencies
   {
     std::shared_ptr<eCAL::CUDPReaderLayer>       udp_layer;
     std::shared_ptr<eCAL::CSHMReaderLayer>       shm_layer;
     std::shared_ptr<eCAL::CTCPReaderLayer>       tcp_layer;
+    std::shared_ptr<eCAL::CUDSReaderLayer>       uds_layer;
     std::shared_ptr<eCAL::CRegistrationProvider> registration_provider;
   };
 
-  class CSubscriberImpl
+  class CSubscriberImpl : public std::enable_shared_from_this<CSubscriberImpl>
   {
   public:
     struct SLayerState
@@ -79,6 +98,10 @@ namespace eCAL
       SLayerState udp;
       SLayerState shm;
       SLayerState tcp;
+      SLayerState inproc;
+      SLayerState uds;
+
+      bool report_statistics = false;   // publisher selects its layers adaptively and needs our delivery statistics
     };
 
     using SPublicationInfo = Registration::SampleIdentifier;
@@ -95,16 +118,19 @@ namespace eCAL
     CSubscriberImpl& operator=(CSubscriberImpl&&) = delete;
 
     bool Read(std::string& buf_, long long* time_ = nullptr, int rcv_timeout_ms_ = 0);
+    // takes all buffered samples at once, the buffers of bufs_ are handed over to the read buffer for reuse
+    size_t ReadBatch(std::vector<std::string>& bufs_, std::vector<long long>* times_ = nullptr, int rcv_timeout_ms_ = 0);
 
-    bool SetReceiveCallback(const ReceiveCallbackT& callback_);
+    bool SetReceiveCallback(const ReceiveCallbackT& callback_, const std::string& object_type_ = "");
     bool RemoveReceiveCallback();
 
     bool SetEventCallback(const SubEventCallbackT& callback_);
     bool RemoveEventCallback();
 
     void SetFilterIDs(const std::set<long long>& filter_ids_);
+    void SetContentIdFilter(const CContentIdFilter& filter_);
 
-    void ApplyPublisherRegistration(const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& pub_layer_states_);
+    void ApplyPublisherRegistration(const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_, const SLayerStates& pub_layer_states_, long long data_clock_);
     void ApplyPublisherUnregistration(const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_);
 
     void ApplyLayerParameter(const SPublicationInfo& publication_info_, eTLayerType type_, const Registration::ConnectionPar& parameter_);
@@ -120,7 +146,19 @@ namespace eCAL
     const SDataTypeInformation& GetDataTypeInformation() const { return(m_topic_info); }
 
     void InitializeLayers();
-    size_t ApplySample(const Payload::TopicInfo& topic_info_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_);
+    size_t ApplySample(const Payload::TopicInfoView& topic_info_, const char* payload_, size_t size_, long long id_, long long clock_, long long time_, size_t hash_, eTLayerType layer_, const SInprocObject* object_ = nullptr, CSharedPayload* shared_payload_ = nullptr);
+
+    // false if this reader needs the serialized payload of intra process samples with this object type
+    bool AcceptsInprocObject(const char* object_type_) const;
+
+    // caller executor of the receive queue: execute the receive callback for the queued samples
+    size_t ProcessReceiveQueue(int timeout_ms_);
+    // caller executor of the receive queue: wake up a wait set if samples are queued
+    bool SetReceiveNotifier(const std::shared_ptr<CReceiveNotifier>& notifier_);
+    void ResetReceiveNotifier(const CReceiveNotifier* notifier_);
+    bool HasQueuedSamples() const;
+    // samples are queued and the callback runs on the queue executor, not on the receiving thread
+    bool HasReceiveQueue() const { return(m_receive_queue != nullptr); }
 
   protected:
     void Register();
@@ -138,18 +176,72 @@ namespace eCAL
     void FireDisconnectEvent(const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_);
     void FireDroppedEvent   (const SPublicationInfo& publication_info_, const SDataTypeInformation& data_type_info_);
 
-    static SPublicationInfo PublicationInfoFromTopicInfo(const Payload::TopicInfo& topic_info_);
+    static SPublicationInfo PublicationInfoFromTopicInfo(const Payload::TopicInfoView& topic_info_);
 
     size_t GetConnectionCount();
 
-    bool ShouldApplySampleBasedOnClock(const SPublicationInfo& publication_info_, long long clock_) const;
+    // receive state of one publication, resolved once per sample. Its mutex is only held
+    // while the sample is checked and counted, never across the receive callback.
+    struct SPublicationState
+    {
+      SPublicationState(const SPublicationInfo& publication_info_, double max_frequency_hz_)
+        : publication_info(publication_info_), rate_limiter(max_frequency_hz_, 0.5) {}
+
+      const SPublicationInfo                                publication_info;
+
+      std::mutex                                            mutex;
+      CounterCache<>                                        counter_cache;
+      MessageDropCalculator                                 drop_calculator;
+      ResettableFrequencyCalculator<eCAL::Time::ecal_clock> frequency_calculator{ 3.0f };
+      StatisticsCalculator                                  latency_us_calculator;
+      long long                                             last_receive_time_us = 0;
+      RateLimiter<std::chrono::steady_clock>                rate_limiter;     // samples the publisher sent to other subscribers of the layer
+      std::shared_ptr<const SDataTypeInformation>           data_type_info;   // set by the publisher registration
+      long long                                             history_clock = -1; // publisher data clock at the first registration, older samples are history
+    };
+    using PublicationStateMapT = std::unordered_map<EntityIdT, std::shared_ptr<SPublicationState>>;
+
+    std::shared_ptr<SPublicationState> FindPublicationState(EntityIdT entity_id_) const;
+    std::shared_ptr<SPublicationState> GetPublicationState(const Payload::TopicInfoView& topic_info_);
+    std::shared_ptr<SPublicationState> GetPublicationState(const SPublicationInfo& publication_info_);
+    std::vector<std::shared_ptr<SPublicationState>> GetPublicationStates() const;
+
+    // the publication state mutex is locked by the caller
+    bool ShouldApplySampleBasedOnClock(const SPublicationState& publication_state_, long long clock_) const;
     bool ShouldApplySampleBasedOnLayer(eTLayerType layer_) const;
     bool ShouldApplySampleBasedOnId(long long id_) const;
+    bool ShouldApplySampleBasedOnHistory(const SPublicationState& publication_state_, long long clock_) const;
 
-    void TriggerStatisticsUpdate(long long send_time_);
-    void TriggerMessageDropUdate(const SPublicationInfo& publication_info_, uint64_t message_counter);
+    // the publication state mutex is locked by the caller
+    static void TriggerStatisticsUpdate(SPublicationState& publication_state_, long long send_time_);
+    static void TriggerMessageDropUdate(SPublicationState& publication_state_, uint64_t message_counter, bool count_drops_);
 
     int32_t GetFrequency();
+    Registration::Statistics GetLatencyStatistics();
+
+    using ReceiveCallbackPtrT = std::shared_ptr<const ReceiveCallbackT>;
+
+    // the receive callback loaded once for a sample, it counts as running until the reference is destroyed
+    class CReceiveCallbackRef
+    {
+    public:
+      explicit CReceiveCallbackRef(CSubscriberImpl& reader_);
+      ~CReceiveCallbackRef();
+
+      CReceiveCallbackRef(const CReceiveCallbackRef&) = delete;
+      CReceiveCallbackRef& operator=(const CReceiveCallbackRef&) = delete;
+
+      const ReceiveCallbackPtrT& Get() const { return m_callback; }
+
+    private:
+      CSubscriberImpl&    m_reader;
+      ReceiveCallbackPtrT m_callback;
+    };
+
+    void StoreReceiveCallback(const ReceiveCallbackPtrT& callback_);
+    void WaitForReceiveCallback();
+    void ExecuteReceiveCallback(const ReceiveCallbackT& callback_, const STopicId& topic_id_, const SDataTypeInformation& data_type_info_, const SReceiveCallbackData& cb_data_);
+    void ProcessQueuedSample(const SQueuedSample& sample_);
     int32_t GetMessageDropsAndFireDroppedEvents();
 
     EntityIdT                                 m_subscriber_id;
@@ -174,8 +266,27 @@ namespace eCAL
     std::string                               m_read_buf;
     long long                                 m_read_time = 0;
 
-    std::mutex                                m_receive_callback_mutex;
-    ReceiveCallbackT                          m_receive_callback;
+    // read buffer with more than one sample (read_buffer_depth > 1), pushed by the transport threads of
+    // all publications and popped by the readers without a lock, only a waiting read locks the read buffer mutex
+    struct SReadSample
+    {
+      std::string payload;
+      long long   time = 0;
+    };
+    bool WaitForReadRing(int rcv_timeout_ms_, const std::function<bool()>& take_);
+    std::unique_ptr<MpmcRing<SReadSample>>    m_read_ring;
+    std::atomic<int>                          m_read_ring_waiters{ 0 };
+
+    // the callback pointer is only accessed by std::atomic_load / std::atomic_store, no lock is held across the callback,
+    // replacing or removing it waits until the loaded callbacks of other threads finished
+    ReceiveCallbackPtrT                       m_receive_callback;
+    std::atomic<int>                          m_receive_callback_running{ 0 };
+    std::atomic<int>                          m_receive_callback_waiters{ 0 };
+    std::mutex                                m_receive_callback_wait_mutex;
+    std::condition_variable                   m_receive_callback_wait_cv;
+    std::shared_ptr<CReceiveQueue>            m_receive_queue;
+    mutable std::mutex                        m_receive_object_type_mutex;
+    std::string                               m_receive_object_type;
     std::atomic<int>                          m_receive_time;
 
     std::deque<size_t>                        m_sample_hash_queue;
@@ -185,20 +296,26 @@ namespace eCAL
 
     std::atomic<long long>                    m_clock;
 
-    std::mutex                                m_statistics_mutex;
-    ResettableFrequencyCalculator<eCAL::Time::ecal_clock> m_frequency_calculator;
-    StatisticsCalculator                      m_latency_us_calculator;
+    mutable std::shared_timed_mutex           m_publication_state_mutex;
+    PublicationStateMapT                      m_publication_states;
+
+    CLayerStatisticsCollector                 m_layer_statistics;
 
-    std::mutex                                m_message_drop_map_mutex;
-    using MessageDropMapT = MessageDropCalculatorMap<SPublicationInfo>;
-    MessageDropMapT                           m_message_drop_map;
-    
-    using CounterCacheMapT = CounterCacheMap<SPublicationInfo>;
-    CounterCacheMapT                          m_publisher_message_counter_map;
-    
-    std::set<long long>                       m_id_set;
+    // content filter, nullptr accepts every content id (replaced as a whole, read without lock)
+    std::shared_ptr<const CContentIdFilter>   m_content_id_filter;
 
     SLayerStates                              m_layers;
+
+    // layers data has been received on, set concurrently by the transport threads
+    struct SActiveLayers
+    {
+      std::atomic<bool> udp{ false };
+      std::atomic<bool> shm{ false };
+      std::atomic<bool> tcp{ false };
+      std::atomic<bool> inproc{ false };
+      std::atomic<bool> uds{ false };
+    };
+    SActiveLayers                             m_active_layers;
     std::atomic<bool>                         m_created;
 
     eCAL::eCALReader::SAttributes             m_attributes;
@@ -0,0 +1,64 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL wait set
+**/
+
+#include <ecal/pubsub/waitset.h>
+
+#include "ecal_waitset_impl.h"
+
+namespace eCAL
+{
+  CWaitSet::CWaitSet()
+    : m_waitset_impl(std::make_shared<CWaitSetImpl>())
+  {
+  }
+
+  CWaitSet::~CWaitSet()
+  {
+    m_waitset_impl->DetachAll();
+  }
+
+  bool CWaitSet::Attach(CSubscriber& subscriber_)
+  {
+    return m_waitset_impl->Attach(subscriber_.m_subscriber_impl.lock());
+  }
+
+  bool CWaitSet::Detach(CSubscriber& subscriber_)
+  {
+    return m_waitset_impl->Detach(subscriber_.m_subscriber_impl.lock());
+  }
+
+  int CWaitSet::GetFileDescriptor() const
+  {
+    return m_waitset_impl->GetFileDescriptor();
+  }
+
+  bool CWaitSet::Wait(int timeout_ms_)
+  {
+    return m_waitset_impl->Wait(timeout_ms_);
+  }
+
+  size_t CWaitSet::TakeAll()
+  {
+    return m_waitset_impl->TakeAll();
+  }
+}
@@ -0,0 +1,175 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL wait set implementation
+**/
+
+#include "ecal_waitset_impl.h"
+#include "ecal_subscriber_impl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace eCAL
+{
+  CWaitSetImpl::CWaitSetImpl()
+  {
+#if defined(__linux__)
+    m_event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+#endif
+  }
+
+  CWaitSetImpl::~CWaitSetImpl()
+  {
+#if defined(__linux__)
+    if (m_event_fd >= 0) close(m_event_fd);
+#endif
+  }
+
+  bool CWaitSetImpl::Attach(const std::shared_ptr<CSubscriberImpl>& subscriber_)
+  {
+    if (!subscriber_) return false;
+
+    const std::lock_guard<std::mutex> lock(m_subscribers_mutex);
+    for (const auto& subscriber : m_subscribers)
+    {
+      if (subscriber.lock() == subscriber_) return true;
+    }
+
+    // notifies right away if samples are queued already
+    if (!subscriber_->SetReceiveNotifier(shared_from_this())) return false;
+    m_subscribers.push_back(subscriber_);
+    return true;
+  }
+
+  bool CWaitSetImpl::Detach(const std::shared_ptr<CSubscriberImpl>& subscriber_)
+  {
+    if (!subscriber_) return false;
+
+    const std::lock_guard<std::mutex> lock(m_subscribers_mutex);
+    auto iter = std::find_if(m_subscribers.begin(), m_subscribers.end(), [&subscriber_](const std::weak_ptr<CSubscriberImpl>& subscriber) { return subscriber.lock() == subscriber_; });
+    if (iter == m_subscribers.end()) return false;
+
+    subscriber_->ResetReceiveNotifier(this);
+    m_subscribers.erase(iter);
+    return true;
+  }
+
+  void CWaitSetImpl::DetachAll()
+  {
+    const std::lock_guard<std::mutex> lock(m_subscribers_mutex);
+    for (const auto& subscriber : m_subscribers)
+    {
+      const auto subscriber_impl = subscriber.lock();
+      if (subscriber_impl) subscriber_impl->ResetReceiveNotifier(this);
+    }
+    m_subscribers.clear();
+  }
+
+  bool CWaitSetImpl::Wait(int timeout_ms_)
+  {
+    std::unique_lock<std::mutex> lock(m_signal_mutex);
+    auto signaled = [this]() { return m_signaled; };
+    if (timeout_ms_ < 0)
+    {
+      m_signal_cv.wait(lock, signaled);
+      return true;
+    }
+    return m_signal_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms_), signaled);
+  }
+
+  size_t CWaitSetImpl::TakeAll()
+  {
+    // reset first, samples queued from now on signal again
+    ResetSignal();
+
+    size_t processed(0);
+    bool   samples_left(false);
+    for (const auto& subscriber : GetSubscribers())
+    {
+      processed += subscriber->ProcessReceiveQueue(0);
+      samples_left |= subscriber->HasQueuedSamples();
+    }
+
+    // more samples than one queue depth arrived meanwhile, keep the wait set signaled
+    if (samples_left) Notify();
+    return processed;
+  }
+
+  void CWaitSetImpl::Notify()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_signal_mutex);
+      if (m_signaled) return;
+      m_signaled = true;
+#if defined(__linux__)
+      if (m_event_fd >= 0)
+      {
+        const uint64_t value(1);
+        (void)write(m_event_fd, &value, sizeof(value));
+      }
+#endif
+    }
+    m_signal_cv.notify_all();
+  }
+
+  void CWaitSetImpl::ResetSignal()
+  {
+    const std::lock_guard<std::mutex> lock(m_signal_mutex);
+    if (!m_signaled) return;
+    m_signaled = false;
+#if defined(__linux__)
+    if (m_event_fd >= 0)
+    {
+      uint64_t value(0);
+      (void)read(m_event_fd, &value, sizeof(value));
+    }
+#endif
+  }
+
+  std::vector<std::shared_ptr<CSubscriberImpl>> CWaitSetImpl::GetSubscribers()
+  {
+    // the callbacks run without wait set lock, they may attach or detach subscribers
+    std::vector<std::shared_ptr<CSubscriberImpl>> subscribers;
+    const std::lock_guard<std::mutex> lock(m_subscribers_mutex);
+    subscribers.reserve(m_subscribers.size());
+    for (auto iter = m_subscribers.begin(); iter != m_subscribers.end();)
+    {
+      auto subscriber_impl = iter->lock();
+      if (subscriber_impl)
+      {
+        subscribers.push_back(std::move(subscriber_impl));
+        ++iter;
+      }
+      else
+      {
+        // the subscriber has been destroyed
+        iter = m_subscribers.erase(iter);
+      }
+    }
+    return subscribers;
+  }
+}
@@ -0,0 +1,75 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  eCAL wait set implementation
+**/
+
+#pragma once
+
+#include "ecal_receive_queue.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eCAL
+{
+  class CSubscriberImpl;
+
+  /*
+  * Signal shared by the receive queues of the attached subscribers. The signal is set by the
+  * first sample pushed into an empty queue and reset by TakeAll, which processes the queues
+  * until they are empty. On Linux an eventfd mirrors the signal for epoll / poll based loops.
+  */
+  class CWaitSetImpl : public CReceiveNotifier, public std::enable_shared_from_this<CWaitSetImpl>
+  {
+  public:
+    CWaitSetImpl();
+    ~CWaitSetImpl() override;
+
+    CWaitSetImpl(const CWaitSetImpl&) = delete;
+    CWaitSetImpl& operator=(const CWaitSetImpl&) = delete;
+
+    bool Attach(const std::shared_ptr<CSubscriberImpl>& subscriber_);
+    bool Detach(const std::shared_ptr<CSubscriberImpl>& subscriber_);
+    void DetachAll();
+
+    int GetFileDescriptor() const { return m_event_fd; }
+
+    bool   Wait(int timeout_ms_);
+    size_t TakeAll();
+
+    void Notify() override;
+
+  private:
+    void ResetSignal();
+    std::vector<std::shared_ptr<CSubscriberImpl>> GetSubscribers();
+
+    std::mutex                                  m_subscribers_mutex;
+    std::vector<std::weak_ptr<CSubscriberImpl>> m_subscribers;
+
+    std::mutex                                  m_signal_mutex;
+    std::condition_variable                     m_signal_cv;
+    bool                                        m_signaled = false;
+    int                                         m_event_fd = -1;
+  };
+}
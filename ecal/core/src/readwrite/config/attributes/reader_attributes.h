@@ -33,6 +33,7 @@ namespace eCAL
       bool        broadcast;
       int         port;
       int         receivebuffer;
+      size_t      max_sample_size;
       std::string group;
     };
 
@@ -48,16 +49,41 @@ namespace eCAL
       bool enable;
     };
 
+    struct SINPROCAttributes
+    {
+      bool enable;
+    };
+
+    struct SUDSAttributes
+    {
+      bool   enable;
+      size_t max_sample_size;
+    };
+
+    struct SReceiveQueueAttributes
+    {
+      unsigned int                              depth;
+      Subscriber::ReceiveQueue::eOverflowPolicy overflow_policy;
+      Subscriber::ReceiveQueue::eExecutor       executor;
+    };
+
     struct SAttributes
     {
       bool         network_enabled;
       bool         drop_out_of_order_messages;
+      double       max_frequency_hz;
+      bool         receive_history;
+      unsigned int read_buffer_depth;
       bool         loopback;
       unsigned int registration_timeout_ms;
 
       SUDPAttributes udp;
       STCPAttributes tcp;
       SSHMAttributes shm;
+      SINPROCAttributes inproc;
+      SUDSAttributes uds;
+
+      SReceiveQueueAttributes receive_queue;
 
       std::string topic_name;
       std::string host_name;
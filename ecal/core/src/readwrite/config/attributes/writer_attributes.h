@@ -39,12 +39,30 @@ namespace eCAL
       int         max_datagram_size;
       std::string group;
       int         ttl;
+
+      bool         fec_enable;
+      unsigned int fec_block_size;
+      unsigned int fec_parity_count;
+
+      bool         reliable_enable;
+      unsigned int reliable_window_size;
+
+      unsigned int pacing_rate;
+      unsigned int pacing_burst;
+      unsigned int process_pacing_rate;
+      unsigned int process_pacing_burst;
+
+      unsigned int coalescing_max_delay_us;
+      unsigned int coalescing_max_size;
     };
 
     struct STCPAttributes
     {
       bool   enable;
       size_t thread_pool_size;
+
+      unsigned int coalescing_max_delay_us;
+      unsigned int coalescing_max_size;
     };
 
     struct SSHMAttributes
@@ -57,6 +75,26 @@ namespace eCAL
       unsigned int memfile_reserve_percent;
     };
 
+    struct SINPROCAttributes
+    {
+      bool         enable;
+    };
+
+    struct SUDSAttributes
+    {
+      bool         enable;
+      std::string  socket_directory;
+      size_t       memfd_min_size;
+    };
+
+
+    struct SAdaptiveLayerSelectionAttributes
+    {
+      bool         enable;
+      unsigned int hysteresis_percent;
+      unsigned int probe_interval;
+      unsigned int min_samples;
+    };
 
     struct SAttributes
     {
@@ -64,6 +102,11 @@ namespace eCAL
       LayerPriorityVector  layer_priority_local;
       LayerPriorityVector  layer_priority_remote;
 
+      SAdaptiveLayerSelectionAttributes adaptive_layer_selection;
+
+      bool                 concurrent_send;
+      unsigned int         history_depth;
+
       bool                 network_enabled;
       bool                 loopback;
 
@@ -78,6 +121,8 @@ namespace eCAL
       SUDPAttributes       udp;
       STCPAttributes       tcp;
       SSHMAttributes       shm;
+      SINPROCAttributes    inproc;
+      SUDSAttributes       uds;
     };
   }
 }
\ No newline at end of file
@@ -42,7 +42,11 @@ namespace eCAL
 
       attributes.topic_name = attr_.topic_name;
       attributes.topic_id   = topic_id_;
+      attributes.process_id = attr_.process_id;
       attributes.thread_pool_size = attr_.tcp.thread_pool_size;
+
+      attributes.coalescing_max_delay_us = attr_.tcp.coalescing_max_delay_us;
+      attributes.coalescing_max_size     = attr_.tcp.coalescing_max_size;
       
       return attributes;
     }
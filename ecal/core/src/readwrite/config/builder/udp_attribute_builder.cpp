@@ -31,6 +31,7 @@ namespace eCAL
 
       attributes.loopback       = true;
       attributes.receive_buffer = attr_.udp.receivebuffer;
+      attributes.max_sample_size = attr_.udp.max_sample_size;
       attributes.port           = attr_.udp.port;
       attributes.broadcast      = attr_.udp.broadcast;
       attributes.address        = attr_.udp.group;
@@ -56,6 +57,20 @@ namespace eCAL
       attributes.address     = attr_.udp.group;
       attributes.ttl         = attr_.udp.ttl;
 
+      attributes.fec_enable       = attr_.udp.fec_enable;
+      attributes.fec_block_size   = attr_.udp.fec_block_size;
+      attributes.fec_parity_count = attr_.udp.fec_parity_count;
+
+      attributes.reliable_enable      = attr_.udp.reliable_enable;
+      attributes.reliable_window_size = attr_.udp.reliable_window_size;
+
+      attributes.pacing_rate          = attr_.udp.pacing_rate;
+      attributes.pacing_burst         = attr_.udp.pacing_burst;
+      attributes.process_pacing_rate  = attr_.udp.process_pacing_rate;
+      attributes.process_pacing_burst = attr_.udp.process_pacing_burst;
+
+      attributes.coalescing_max_delay_us = attr_.udp.coalescing_max_delay_us;
+      attributes.coalescing_max_size     = attr_.udp.coalescing_max_size;
 
       return attributes;
     }
@@ -0,0 +1,50 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "uds_attribute_builder.h"
+
+namespace eCAL
+{
+  namespace eCALReader
+  {
+    UDSLayer::SAttributes BuildUDSLayerAttributes(const eCALReader::SAttributes& attr_)
+    {
+      UDSLayer::SAttributes attributes;
+      attributes.max_sample_size = attr_.uds.max_sample_size;
+      return attributes;
+    }
+  }
+
+  namespace eCALWriter
+  {
+    UDS::SAttributes BuildUDSAttributes(const uint64_t& topic_id_, const eCALWriter::SAttributes& attr_)
+    {
+      UDS::SAttributes attributes;
+
+      attributes.topic_name       = attr_.topic_name;
+      attributes.topic_id         = topic_id_;
+      attributes.process_id       = attr_.process_id;
+
+      attributes.socket_directory = attr_.uds.socket_directory;
+      attributes.memfd_min_size   = attr_.uds.memfd_min_size;
+
+      return attributes;
+    }
+  }
+}
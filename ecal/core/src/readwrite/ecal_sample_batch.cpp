@@ -0,0 +1,205 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  sample batches (coalescing of small samples on the network layers)
+**/
+
+#include "ecal_sample_batch.h"
+
+#include "ecal_utils/portable_endian.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace
+{
+  constexpr std::array<char, 4> batch_magic{ { '\0', 'B', 'A', 'T' } };
+  constexpr size_t              batch_alignment = 8;
+
+  size_t AlignedSize(size_t size_)
+  {
+    return (size_ + batch_alignment - 1) / batch_alignment * batch_alignment;
+  }
+
+  void WriteUInt32(char* target_, uint32_t value_)
+  {
+    value_ = htole32(value_);
+    std::memcpy(target_, &value_, sizeof(value_));
+  }
+
+  uint32_t ReadUInt32(const char* source_)
+  {
+    uint32_t value = 0;
+    std::memcpy(&value, source_, sizeof(value));
+    return le32toh(value);
+  }
+}
+
+namespace eCAL
+{
+  bool IsSampleBatch(const char* data_, size_t size_)
+  {
+    if ((data_ == nullptr) || (size_ < sample_batch_header_size)) return false;
+    return std::memcmp(data_, batch_magic.data(), batch_magic.size()) == 0;
+  }
+
+  bool ForEachSampleInBatch(const char* data_, size_t size_, const SampleBatchCallbackT& sample_callback_)
+  {
+    if (!IsSampleBatch(data_, size_)) return false;
+
+    const uint32_t sample_count = ReadUInt32(data_ + batch_magic.size());
+    size_t offset = sample_batch_header_size;
+    for (uint32_t sample = 0; sample < sample_count; ++sample)
+    {
+      if (size_ - offset < sample_batch_entry_header_size) return false;
+      const size_t sample_size = ReadUInt32(data_ + offset);
+      offset += sample_batch_entry_header_size;
+
+      if (size_ - offset < sample_size) return false;
+      sample_callback_(data_ + offset, sample_size);
+
+      // the last entry may omit its padding
+      offset += std::min(AlignedSize(sample_size), size_ - offset);
+    }
+    return true;
+  }
+
+  CSampleBatchBuilder::CSampleBatchBuilder(size_t max_size_) :
+    m_max_size(max_size_)
+  {
+  }
+
+  bool CSampleBatchBuilder::Fits(size_t sample_size_) const
+  {
+    if (sample_size_ > m_max_size) return false;
+    return sample_batch_header_size + sample_batch_entry_header_size + AlignedSize(sample_size_) <= m_max_size;
+  }
+
+  bool CSampleBatchBuilder::Add(const char* header_, size_t header_size_, const char* payload_, size_t payload_size_)
+  {
+    const size_t sample_size = header_size_ + payload_size_;
+    if (!Fits(sample_size)) return false;
+
+    const size_t entry_size = sample_batch_entry_header_size + AlignedSize(sample_size);
+    if (m_batch.empty())
+    {
+      m_batch.resize(sample_batch_header_size);
+      std::memcpy(m_batch.data(), batch_magic.data(), batch_magic.size());
+    }
+    if (m_batch.size() + entry_size > m_max_size) return false;
+
+    const size_t offset = m_batch.size();
+    m_batch.resize(offset + entry_size, 0);
+    char* entry = m_batch.data() + offset;
+    WriteUInt32(entry, static_cast<uint32_t>(sample_size));
+    WriteUInt32(entry + sizeof(uint32_t), 0);
+    if (header_size_  > 0) std::memcpy(entry + sample_batch_entry_header_size, header_, header_size_);
+    if (payload_size_ > 0) std::memcpy(entry + sample_batch_entry_header_size + header_size_, payload_, payload_size_);
+
+    ++m_sample_count;
+    WriteUInt32(m_batch.data() + batch_magic.size(), m_sample_count);
+    return true;
+  }
+
+  void CSampleBatchBuilder::Clear()
+  {
+    m_batch.clear();
+    m_sample_count = 0;
+  }
+
+  CSampleCoalescer::CSampleCoalescer(size_t max_size_, std::chrono::microseconds max_delay_, const FlushCallbackT& flush_callback_) :
+    m_max_delay(max_delay_),
+    m_flush_callback(flush_callback_),
+    m_batch(max_size_)
+  {
+    m_flush_thread = std::thread(&CSampleCoalescer::FlushThread, this);
+  }
+
+  CSampleCoalescer::~CSampleCoalescer()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_one();
+    if (m_flush_thread.joinable()) m_flush_thread.join();
+
+    // do not lose the pending samples
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    FlushLocked();
+  }
+
+  bool CSampleCoalescer::Add(const char* header_, size_t header_size_, const char* payload_, size_t payload_size_)
+  {
+    if (!m_batch.Fits(header_size_ + payload_size_)) return false;
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_batch.Add(header_, header_size_, payload_, payload_size_))
+    {
+      FlushLocked();
+      m_batch.Add(header_, header_size_, payload_, payload_size_);
+    }
+
+    // the deadline is set by the first sample of a batch
+    const bool first_sample = (m_batch.GetSampleCount() == 1);
+    if (first_sample) m_deadline = std::chrono::steady_clock::now() + m_max_delay;
+
+    if (m_batch.Full())     FlushLocked();
+    else if (first_sample)  m_cv.notify_one();
+
+    return true;
+  }
+
+  void CSampleCoalescer::Flush()
+  {
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    FlushLocked();
+  }
+
+  void CSampleCoalescer::FlushLocked()
+  {
+    if (m_batch.Empty()) return;
+
+    if (m_flush_callback) m_flush_callback(m_batch.Get());
+    m_batch.Clear();
+  }
+
+  void CSampleCoalescer::FlushThread()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+      if (m_batch.Empty())
+      {
+        m_cv.wait(lock);
+        continue;
+      }
+
+      // the deadline is set by the first sample of a batch, Add wakes us up for every new batch
+      if (std::chrono::steady_clock::now() >= m_deadline)
+      {
+        FlushLocked();
+        continue;
+      }
+      m_cv.wait_until(lock, m_deadline);
+    }
+  }
+}
@@ -0,0 +1,115 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  sample batches (coalescing of small samples on the network layers)
+ *
+ * A batch packs consecutive serialized samples of one writer into one datagram / tcp message:
+ *
+ *   batch header   '\0' 'B' 'A' 'T' + 32 bit sample count
+ *   sample entry   32 bit sample size + 32 bit reserved + sample + zero padding to 8 bytes
+ *
+ * All integers are little endian. The leading zero byte is an invalid protobuf tag, so
+ * receivers without batch support drop a batch instead of misinterpreting it.
+**/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  constexpr size_t sample_batch_header_size = 8;
+  constexpr size_t sample_batch_entry_header_size = 8;
+
+  bool IsSampleBatch(const char* data_, size_t size_);
+
+  // calls sample_callback_ for every sample of the batch, returns false if the batch is malformed
+  using SampleBatchCallbackT = std::function<void(const char* sample_data_, size_t sample_size_)>;
+  bool ForEachSampleInBatch(const char* data_, size_t size_, const SampleBatchCallbackT& sample_callback_);
+
+  // packs consecutive samples into one batch of at most max_size_ bytes
+  class CSampleBatchBuilder
+  {
+  public:
+    explicit CSampleBatchBuilder(size_t max_size_);
+
+    // true if a sample of this size fits into an empty batch
+    bool Fits(size_t sample_size_) const;
+
+    // appends the sample [header_][payload_], returns false if it does not fit into the batch
+    bool Add(const char* header_, size_t header_size_, const char* payload_, size_t payload_size_);
+
+    bool     Empty() const          { return m_sample_count == 0; }
+    uint32_t GetSampleCount() const { return m_sample_count; }
+    bool     Full() const           { return m_batch.size() + sample_batch_entry_header_size >= m_max_size; }
+
+    const std::vector<char>& Get() const { return m_batch; }
+    void Clear();
+
+  private:
+    const size_t      m_max_size;
+    std::vector<char> m_batch;
+    uint32_t          m_sample_count = 0;
+  };
+
+  // collects samples into a batch and hands it to the flush callback
+  // as soon as it reaches max_size_ or the oldest sample is older than max_delay_
+  class CSampleCoalescer
+  {
+  public:
+    using FlushCallbackT = std::function<void(const std::vector<char>& batch_)>;
+
+    CSampleCoalescer(size_t max_size_, std::chrono::microseconds max_delay_, const FlushCallbackT& flush_callback_);
+    ~CSampleCoalescer();
+
+    CSampleCoalescer(const CSampleCoalescer&) = delete;
+    CSampleCoalescer& operator=(const CSampleCoalescer&) = delete;
+    CSampleCoalescer(CSampleCoalescer&&) = delete;
+    CSampleCoalescer& operator=(CSampleCoalescer&&) = delete;
+
+    // appends the sample [header_][payload_] to the batch, returns false if the sample
+    // is too large to be batched (it then needs to be sent directly after calling Flush)
+    bool Add(const char* header_, size_t header_size_, const char* payload_, size_t payload_size_);
+
+    // sends the pending batch (if any)
+    void Flush();
+
+  private:
+    void FlushLocked();
+    void FlushThread();
+
+    const std::chrono::microseconds                    m_max_delay;
+    const FlushCallbackT                               m_flush_callback;
+
+    std::mutex                                         m_mutex;
+    std::condition_variable                            m_cv;
+    CSampleBatchBuilder                                m_batch;
+    std::chrono::steady_clock::time_point              m_deadline;
+    bool                                               m_stop = false;
+    std::thread                                        m_flush_thread;
+  };
+}
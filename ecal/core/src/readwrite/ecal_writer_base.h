@@ -32,6 +32,7 @@
 
 #include <atomic>
 #include <string>
+#include <vector>
 
 namespace eCAL
 {
@@ -43,7 +44,7 @@ namespace eCAL
 
     virtual SWriterInfo GetInfo() = 0;
 
-    virtual void ApplySubscription(const std::string& /*host_name_*/, const int32_t /*process_id_*/, const EntityIdT& /*topic_id_*/, const std::string& /*conn_par_*/) {};
+    virtual void ApplySubscription(const std::string& /*host_name_*/, const int32_t /*process_id_*/, const EntityIdT& /*topic_id_*/, const Registration::ConnectionPar& /*conn_par_*/) {};
     virtual void RemoveSubscription(const std::string& /*host_name_*/, const int32_t /*process_id_*/, const EntityIdT& /*topic_id_*/) {};
 
     virtual ConnectionParameter GetConnectionParameter() { return {}; };
@@ -51,5 +52,16 @@ namespace eCAL
     virtual bool PrepareWrite(const SWriterAttr& /*attr_*/) { return false; };
     virtual bool Write(CPayloadWriter& /*payload_*/, const SWriterAttr& /*attr_*/) { return false; };
     virtual bool Write(const void* /*buf_*/, const SWriterAttr& /*attr_*/) { return false; };
+
+    // writes the samples in order, layers able to pack them into fewer messages override this
+    virtual bool WriteBatch(const std::vector<SWriterBatchSample>& samples_)
+    {
+      bool written(false);
+      for (const auto& sample : samples_)
+      {
+        written |= Write(sample.buf, sample.attr);
+      }
+      return written;
+    };
   };
 }
@@ -24,6 +24,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace eCAL
 {
@@ -36,6 +38,17 @@ namespace eCAL
     long long    time                   = 0;
     bool         loopback               = false;
     bool         zero_copy              = false;
+    bool         batch                  = false;   // shm: payload is a sample batch
+    bool         replay                 = false;   // shm: payload is a replayed history sample
     long long    acknowledge_timeout_ms = 0;
+
+    const std::vector<int32_t>* signal_process_ids = nullptr;   // shm: processes to signal (nullptr = all connected processes)
+  };
+
+  // one already serialized sample of a batch write
+  struct SWriterBatchSample
+  {
+    const char*  buf = nullptr;
+    SWriterAttr  attr;
   };
 }
@@ -0,0 +1,74 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  sample history of a publisher (replayed to late joining subscribers)
+**/
+
+#include "ecal_writer_history.h"
+
+#include <utility>
+
+namespace eCAL
+{
+  CSampleHistory::CSampleHistory(size_t depth_)
+    : m_depth(depth_)
+  {
+  }
+
+  void CSampleHistory::Add(const char* buf_, const SWriterAttr& attr_)
+  {
+    if (m_depth == 0) return;
+
+    // reuse the payload buffer of the oldest sample (if no snapshot refers to it anymore)
+    SEntry sample;
+    if (m_samples.size() == m_depth)
+    {
+      sample = std::move(m_samples.front());
+      m_samples.pop_front();
+    }
+    if (!sample.payload || (sample.payload.use_count() > 1)) sample.payload = std::make_shared<std::vector<char>>();
+
+    if (buf_ != nullptr) sample.payload->assign(buf_, buf_ + attr_.len);
+    else                 sample.payload->clear();
+
+    // the history keeps the sample description only, no per write options
+    sample.attr       = SWriterAttr();
+    sample.attr.len   = sample.payload->size();
+    sample.attr.id    = attr_.id;
+    sample.attr.clock = attr_.clock;
+    sample.attr.hash  = attr_.hash;
+    sample.attr.time  = attr_.time;
+    sample.sequence   = ++m_sequence;
+
+    m_samples.push_back(std::move(sample));
+  }
+
+  std::vector<CSampleHistory::SSample> CSampleHistory::GetSamples(uint64_t& sequence_) const
+  {
+    std::vector<SSample> samples;
+    for (const auto& sample : m_samples)
+    {
+      if (sample.sequence <= sequence_) continue;
+      samples.push_back(SSample{ sample.payload, sample.attr });
+    }
+    sequence_ = m_sequence;
+    return samples;
+  }
+}
@@ -0,0 +1,70 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  sample history of a publisher (replayed to late joining subscribers)
+**/
+
+#pragma once
+
+#include "readwrite/ecal_writer_data.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace eCAL
+{
+  // keeps copies of the last depth_ serialized samples, the oldest sample is dropped first,
+  // every added sample gets a sequence number to take the samples added since a former snapshot
+  class CSampleHistory
+  {
+  public:
+    struct SSample
+    {
+      std::shared_ptr<const std::vector<char>> payload;
+      SWriterAttr                              attr;
+    };
+
+    explicit CSampleHistory(size_t depth_);
+
+    void Add(const char* buf_, const SWriterAttr& attr_);
+
+    bool   Empty() const { return m_samples.empty(); }
+    size_t Size() const  { return m_samples.size(); }
+
+    // snapshot of the stored samples added after sequence_ in send order, sequence_ is advanced to the
+    // last sample taken (the payloads are shared with the history and stay valid after later adds)
+    std::vector<SSample> GetSamples(uint64_t& sequence_) const;
+
+  private:
+    struct SEntry
+    {
+      std::shared_ptr<std::vector<char>> payload;
+      SWriterAttr                        attr;
+      uint64_t                           sequence = 0;
+    };
+
+    const size_t       m_depth;
+    uint64_t           m_sequence = 0;
+    std::deque<SEntry> m_samples;
+  };
+}
@@ -0,0 +1,81 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  intra process data writer
+**/
+
+#include "ecal_writer_inproc.h"
+#include "pubsub/ecal_subgate.h"
+
+#include <utility>
+
+namespace eCAL
+{
+  CDataWriterInproc::CDataWriterInproc(const eCALWriter::SAttributes& attr_, const EntityIdT& topic_id_, std::shared_ptr<CSubGate> subgate_)
+    : m_host_name(attr_.host_name)
+    , m_topic_name(attr_.topic_name)
+    , m_process_id(attr_.process_id)
+    , m_topic_id(topic_id_)
+    , m_subgate(std::move(subgate_))
+  {
+  }
+
+  SWriterInfo CDataWriterInproc::GetInfo()
+  {
+    SWriterInfo info_;
+
+    info_.name           = "inproc";
+    info_.description    = "Intra process data writer";
+
+    info_.has_mode_local = true;
+    info_.has_mode_cloud = false;
+
+    info_.send_size_max  = -1;
+
+    return info_;
+  }
+
+  bool CDataWriterInproc::Write(const void* buf_, const SWriterAttr& attr_)
+  {
+    return Write(buf_, attr_, SInprocObject());
+  }
+
+  bool CDataWriterInproc::Write(const void* buf_, const SWriterAttr& attr_, const SInprocObject& object_)
+  {
+    if (!m_subgate) return false;
+
+    // the topic info refers to the members, nothing is copied here
+    Payload::TopicInfoView topic_info;
+    topic_info.host_name  = m_host_name;
+    topic_info.topic_name = m_topic_name;
+    topic_info.process_id = m_process_id;
+    topic_info.topic_id   = m_topic_id;
+
+    // all local readers are served with the same buffer before we return
+    m_subgate->ApplySample(topic_info, static_cast<const char*>(buf_), attr_.len, attr_.id, attr_.clock, attr_.time, attr_.hash, tl_ecal_inproc, &object_);
+    return true;
+  }
+
+  bool CDataWriterInproc::AcceptsObject(const char* object_type_)
+  {
+    if (!m_subgate || (object_type_ == nullptr)) return false;
+    return m_subgate->AcceptsInprocObject(m_topic_name, object_type_);
+  }
+}
@@ -0,0 +1,64 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  intra process data writer
+ *
+ * Subscribers living in the publishers process are served directly through the subscriber
+ * gateway. The payload buffer of the publisher is handed to all local readers of the topic
+ * within the send call, there is no serialization, no memory file and no extra thread
+ * involved. As a consequence the receive callbacks are executed in the sending thread.
+**/
+
+#pragma once
+
+#include "pubsub/ecal_subscriber_impl.h"
+#include "readwrite/ecal_writer_base.h"
+#include "readwrite/config/attributes/writer_attributes.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace eCAL
+{
+  class CSubGate;
+
+  class CDataWriterInproc : public CDataWriterBase<Registration::ConnectionPar>
+  {
+  public:
+    CDataWriterInproc(const eCALWriter::SAttributes& attr_, const EntityIdT& topic_id_, std::shared_ptr<CSubGate> subgate_);
+
+    SWriterInfo GetInfo() override;
+
+    bool Write(const void* buf_, const SWriterAttr& attr_) override;
+    bool Write(const void* buf_, const SWriterAttr& attr_, const SInprocObject& object_);
+
+    // true if all local readers take message objects of this type, so no serialized payload is needed
+    bool AcceptsObject(const char* object_type_);
+
+  private:
+    std::string                m_host_name;
+    std::string                m_topic_name;
+    int32_t                    m_process_id = 0;
+    EntityIdT                  m_topic_id   = 0;
+
+    std::shared_ptr<CSubGate>  m_subgate;
+  };
+}
@@ -78,7 +78,13 @@ namespace eCAL
   {
     if (m_subgate)
     {
-      if (m_subgate->ApplySample(topic_info_, buf_, len_, id_, clock_, time_, hash_, tl_ecal_shm))
+      Payload::TopicInfoView topic_info_view;
+      topic_info_view.host_name  = topic_info_.host_name;
+      topic_info_view.topic_id   = topic_info_.topic_id;
+      topic_info_view.topic_name = topic_info_.topic_name;
+      topic_info_view.process_id = topic_info_.process_id;
+
+      if (m_subgate->ApplySample(topic_info_view, buf_, len_, id_, clock_, time_, hash_, tl_ecal_shm))
       {
         return len_;
       }
@@ -26,6 +26,7 @@
 
 #include "ecal_def.h"
 #include "ecal_writer_shm.h"
+#include "io/shm/ecal_memfile_header.h"
 
 #include <string>
 
@@ -35,6 +36,7 @@ namespace eCAL
 
   CDataWriterSHM::CDataWriterSHM(const eCALWriter::SHM::SAttributes& attr_, std::shared_ptr<CMemFileMap> memfile_map_) 
     : m_attributes(attr_)
+    , m_sample_batch(std::numeric_limits<size_t>::max())
     , m_memfile_map(std::move(memfile_map_))
   {
     // initialize memory file buffer
@@ -74,9 +76,12 @@ namespace eCAL
 
   bool CDataWriterSHM::Write(CPayloadWriter& payload_, const SWriterAttr& attr_)
   {
-    // write content
-    const bool force_full_write(m_memory_file_vec.size() > 1);
+    // write content (partial updates of the previous content are used in zero copy mode only,
+    // and only if the memory file holds the previous sample and not a sample batch or a replayed sample)
+    const bool force_full_write((m_memory_file_vec.size() > 1) || !attr_.zero_copy || m_full_write_required);
     const bool sent = m_memory_file_vec[m_write_idx]->Write(payload_, attr_, force_full_write);
+    m_payload_address = sent ? m_memory_file_vec[m_write_idx]->GetPayloadAddress() : nullptr;
+    m_full_write_required = attr_.batch || attr_.replay;
 
     // and increment file index
     m_write_idx++;
@@ -85,7 +90,37 @@ namespace eCAL
     return sent;
   }
 
-  void CDataWriterSHM::ApplySubscription(const std::string& host_name_, const int32_t process_id_, const EntityIdT& topic_id_, const std::string& /*conn_par_*/)
+  const std::vector<char>& CDataWriterSHM::BuildSampleBatch(const std::vector<SWriterBatchSample>& samples_, SWriterAttr& attr_)
+  {
+    m_sample_batch.Clear();
+    for (const auto& sample : samples_)
+    {
+      // every entry starts with its own memory file header
+      SMemFileHeader sample_hdr;
+      sample_hdr.data_size = static_cast<uint64_t>(sample.attr.len);
+      sample_hdr.id        = static_cast<uint64_t>(sample.attr.id);
+      sample_hdr.clock     = static_cast<uint64_t>(sample.attr.clock);
+      sample_hdr.time      = static_cast<int64_t>(sample.attr.time);
+      sample_hdr.hash      = static_cast<uint64_t>(sample.attr.hash);
+      m_sample_batch.Add(reinterpret_cast<const char*>(&sample_hdr), sample_hdr.hdr_size, sample.buf, sample.attr.len);
+    }
+
+    // the batch header carries the last sample, readers skip batches they have seen already by its clock
+    if (!samples_.empty())
+    {
+      const SWriterAttr& last_attr = samples_.back().attr;
+      attr_.id    = last_attr.id;
+      attr_.clock = last_attr.clock;
+      attr_.time  = last_attr.time;
+      attr_.hash  = last_attr.hash;
+    }
+    attr_.len   = m_sample_batch.Get().size();
+    attr_.batch = true;
+
+    return m_sample_batch.Get();
+  }
+
+  void CDataWriterSHM::ApplySubscription(const std::string& host_name_, const int32_t process_id_, const EntityIdT& topic_id_, const Registration::ConnectionPar& conn_par_)
   {
     // we accept local connections only
     if (host_name_ != m_attributes.host_name) return;
@@ -95,6 +130,9 @@ namespace eCAL
       const std::lock_guard<std::mutex> lock(m_process_id_topic_id_set_map_sync);
       auto& topic_set = m_process_id_topic_id_set_map[process_id_];
       topic_set.insert(topic_id_);
+
+      m_subscription_sample_batch[topic_id_] = conn_par_.layer_par_shm.sample_batch;
+      UpdateSampleBatchSupport();
     }
 
     for (auto& memory_file : m_memory_file_vec)
@@ -121,6 +159,9 @@ namespace eCAL
       const std::lock_guard<std::mutex> lock(m_process_id_topic_id_set_map_sync);
       auto process_it = m_process_id_topic_id_set_map.find(process_id_);
 
+      m_subscription_sample_batch.erase(topic_id_);
+      UpdateSampleBatchSupport();
+
       // this process id is connected to the memory file
       if (process_it != m_process_id_topic_id_set_map.end())
       {
@@ -161,6 +202,16 @@ namespace eCAL
     return layer_par_shm;
   }
 
+  void CDataWriterSHM::UpdateSampleBatchSupport()
+  {
+    bool sample_batch_supported = !m_subscription_sample_batch.empty();
+    for (const auto& subscription : m_subscription_sample_batch)
+    {
+      sample_batch_supported = sample_batch_supported && subscription.second;
+    }
+    m_sample_batch_supported = sample_batch_supported;
+  }
+
   bool CDataWriterSHM::SetBufferCount(size_t buffer_count_)
   {
     // no need to adapt anything
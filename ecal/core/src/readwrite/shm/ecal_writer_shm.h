@@ -27,9 +27,12 @@
 #include "config/attributes/writer_shm_attributes.h"
 
 #include "io/shm/ecal_memfile_sync.h"
+#include "readwrite/ecal_sample_batch.h"
 #include "readwrite/ecal_writer_base.h"
 
+#include <atomic>
 #include <cstddef>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -50,23 +53,40 @@ namespace eCAL
 
     bool Write(CPayloadWriter& payload_, const SWriterAttr& attr_) override;
 
-    void ApplySubscription(const std::string& host_name_, int32_t process_id_, const EntityIdT& topic_id_, const std::string& conn_par_) override;
+    // payload written into the memory file by the last successful Write (valid until the next Write)
+    const char* GetPayloadAddress() const { return m_payload_address; };
+
+    // true if all connected readers accept sample batches
+    bool IsSampleBatchSupported() const { return m_sample_batch_supported; };
+
+    // packs the samples into one sample batch that is written by one Write call (one memory file
+    // lock and one signal for all samples), attr_ is updated to describe the batch
+    const std::vector<char>& BuildSampleBatch(const std::vector<SWriterBatchSample>& samples_, SWriterAttr& attr_);
+
+    void ApplySubscription(const std::string& host_name_, int32_t process_id_, const EntityIdT& topic_id_, const Registration::ConnectionPar& conn_par_) override;
     void RemoveSubscription(const std::string& host_name_, int32_t process_id_, const EntityIdT& topic_id_) override;
 
     Registration::LayerParShm GetConnectionParameter() override;
 
   protected:
     bool SetBufferCount(size_t buffer_count_);
+    void UpdateSampleBatchSupport();
 
     eCALWriter::SHM::SAttributes                  m_attributes;
 
     size_t                                        m_write_idx = 0;
+    const char*                                   m_payload_address = nullptr;
+    bool                                          m_full_write_required = false;
     std::vector<std::shared_ptr<CSyncMemoryFile>> m_memory_file_vec;
     static const std::string                      m_memfile_base_name;
 
     using ProcessIDTopicIDSetT = std::map<int32_t, std::set<EntityIdT>>;
     std::mutex                                    m_process_id_topic_id_set_map_sync;
     ProcessIDTopicIDSetT                          m_process_id_topic_id_set_map;
+    std::map<EntityIdT, bool>                     m_subscription_sample_batch;
+    std::atomic<bool>                             m_sample_batch_supported{ false };
+
+    CSampleBatchBuilder                           m_sample_batch;
 
     std::shared_ptr<CMemFileMap>                  m_memfile_map;
   };
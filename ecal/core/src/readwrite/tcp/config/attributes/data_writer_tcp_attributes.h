@@ -33,8 +33,12 @@ namespace eCAL
       {
         std::string topic_name;
         uint64_t    topic_id;
+        int32_t     process_id;
 
         size_t thread_pool_size;
+
+        unsigned int coalescing_max_delay_us;
+        unsigned int coalescing_max_size;
       };
     }
   }
@@ -27,8 +27,11 @@
 
 #include "ecal_global_accessors.h"
 #include "ecal_reader_tcp.h"
+#include "ecal_tcp_frame.h"
 #include "ecal_tcp_pubsub_logger.h"
 
+#include "readwrite/ecal_sample_batch.h"
+
 #include "pubsub/ecal_subgate.h"
 
 #include "ecal_utils/portable_endian.h"
@@ -38,8 +41,9 @@ namespace eCAL
   ////////////////
   // READER
   ////////////////
-  CDataReaderTCP::CDataReaderTCP(const eCAL::eCALReader::TCP::SAttributes& attr_) 
-    : m_callback_active(false)
+  CDataReaderTCP::CDataReaderTCP(const std::string& topic_name_, const eCAL::eCALReader::TCP::SAttributes& attr_) 
+    : m_topic_name(topic_name_)
+    , m_callback_active(false)
     , m_attributes(attr_)
   {}
 
@@ -105,25 +109,68 @@ namespace eCAL
     return true;
   }
 
+  void CDataReaderTCP::AddPublisher(uint64_t topic_id_, const std::string& host_name_)
+  {
+    const std::unique_lock<std::shared_timed_mutex> lock(m_publisher_mutex);
+    m_publisher_host_name_map[topic_id_] = host_name_;
+  }
+
+  void CDataReaderTCP::RemPublisher(uint64_t topic_id_)
+  {
+    const std::unique_lock<std::shared_timed_mutex> lock(m_publisher_mutex);
+    m_publisher_host_name_map.erase(topic_id_);
+  }
+
   void CDataReaderTCP::OnTcpMessage(const tcp_pubsub::CallbackData& data_)
+  {
+    const char*  frame      = data_.buffer_->data();
+    const size_t frame_size = data_.buffer_->size();
+
+    // unpack coalesced frames
+    if (IsSampleBatch(frame, frame_size))
+    {
+      ForEachSampleInBatch(frame, frame_size, [this](const char* batch_frame_, size_t batch_frame_size_)
+        {
+          OnTcpFrame(batch_frame_, batch_frame_size_);
+        });
+      return;
+    }
+
+    OnTcpFrame(frame, frame_size);
+  }
+
+  void CDataReaderTCP::OnTcpFrame(const char* frame_, size_t frame_size_)
+  {
+    if (TCP::GetFrameVersion(frame_, frame_size_) >= TCP::frame_version_v2)
+    {
+      OnTcpFrameV2(frame_, frame_size_);
+    }
+    else
+    {
+      OnTcpFrameV1(frame_, frame_size_);
+    }
+  }
+
+  void CDataReaderTCP::OnTcpFrameV1(const char* frame_, size_t /*frame_size_*/)
   {
     //                             ECAL                    + header size field
     const size_t   header_length = m_attributes.ecal_magic + sizeof(uint16_t);
-    const uint16_t header_size   = le16toh(*reinterpret_cast<uint16_t*>(data_.buffer_->data() + m_attributes.ecal_magic));
+    const uint16_t header_size   = le16toh(*reinterpret_cast<const uint16_t*>(frame_ + m_attributes.ecal_magic));
 
     // extract header
-    const char* header_payload = data_.buffer_->data() + header_length;
+    const char* header_payload = frame_ + header_length;
     // extract data payload
     const char* data_payload   = header_payload + header_size;
 
-    // parse header
-    if (DeserializeFromBuffer(header_payload, header_size, m_ecal_header))
+    // parse header (the view references the receive buffer, nothing is copied)
+    Payload::SampleView ecal_header;
+    if (DeserializeFromBuffer(header_payload, header_size, ecal_header))
     {
       if (m_subgate)
       {
         // use this intermediate variables as optimization
-        const auto& ecal_header_topic_info = m_ecal_header.topic_info;
-        const auto& ecal_header_content    = m_ecal_header.content;
+        const auto& ecal_header_topic_info = ecal_header.topic_info;
+        const auto& ecal_header_content    = ecal_header.content;
 
         m_subgate->ApplySample(
           ecal_header_topic_info,
@@ -137,6 +184,40 @@ namespace eCAL
       }
     }
   }
+
+  void CDataReaderTCP::OnTcpFrameV2(const char* frame_, size_t frame_size_)
+  {
+    TCP::SFrameHeader frame_header;
+    size_t            payload_offset(0);
+    if (!TCP::DeserializeFrameHeaderV2(frame_, frame_size_, frame_header, payload_offset)) return;
+    if (!m_subgate) return;
+
+    // the v2 frame does not repeat the topic name (this reader serves exactly one topic),
+    // the host name is looked up by the publishers topic id from its registration
+    Payload::TopicInfoView topic_info;
+    topic_info.topic_name = m_topic_name;
+    topic_info.topic_id   = frame_header.topic_id;
+    topic_info.process_id = frame_header.process_id;
+
+    // copy the name, the map must not be locked while the sample is applied
+    std::string publisher_host_name;
+    {
+      const std::shared_lock<std::shared_timed_mutex> lock(m_publisher_mutex);
+      auto iter = m_publisher_host_name_map.find(frame_header.topic_id);
+      if (iter != m_publisher_host_name_map.end()) publisher_host_name = iter->second;
+    }
+    topic_info.host_name = publisher_host_name;
+
+    m_subgate->ApplySample(
+      topic_info,
+      frame_ + payload_offset,
+      static_cast<size_t>(frame_header.payload_size),
+      frame_header.id,
+      frame_header.clock,
+      frame_header.time,
+      static_cast<size_t>(frame_header.hash),
+      tl_ecal_tcp);
+  }
   
   ////////////////
   // LAYER
@@ -163,7 +244,7 @@ namespace eCAL
     const std::lock_guard<std::mutex> lock(m_datareadertcp_sync);
     if (m_datareadertcp_map.find(map_key) != m_datareadertcp_map.end()) return;
 
-    const std::shared_ptr<CDataReaderTCP> reader = std::make_shared<CDataReaderTCP>(eCAL::eCALReader::TCP::BuildTCPReaderAttributes(m_attributes));
+    const std::shared_ptr<CDataReaderTCP> reader = std::make_shared<CDataReaderTCP>(topic_name_, eCAL::eCALReader::TCP::BuildTCPReaderAttributes(m_attributes));
     reader->Create(m_executor, m_subgate);
 
     m_datareadertcp_map.insert(std::pair<std::string, std::shared_ptr<CDataReaderTCP>>(map_key, reader));
@@ -198,6 +279,18 @@ namespace eCAL
     if (iter == m_datareadertcp_map.end()) return;
 
     auto& reader = iter->second;
+    reader->AddPublisher(par_.topic_id, remote_hostname);
     reader->AddConnectionIfNecessary(remote_hostname, static_cast<uint16_t>(remote_port));
   }
+
+  void CTCPReaderLayer::RemPublisher(const std::string& topic_name_, const EntityIdT& topic_id_)
+  {
+    const std::string& map_key(topic_name_);
+
+    const std::lock_guard<std::mutex> lock(m_datareadertcp_sync);
+    const DataReaderTCPMapT::iterator iter = m_datareadertcp_map.find(map_key);
+    if (iter == m_datareadertcp_map.end()) return;
+
+    iter->second->RemPublisher(topic_id_);
+  }
 }
@@ -35,6 +35,8 @@
 
 #include <atomic>
 #include <mutex>
+#include <shared_mutex>
+#include <string>
 #include <unordered_map>
 
 namespace eCAL
@@ -47,7 +49,7 @@ namespace eCAL
   class CDataReaderTCP
   {
   public:
-    CDataReaderTCP(const eCAL::eCALReader::TCP::SAttributes& attr_);
+    CDataReaderTCP(const std::string& topic_name_, const eCAL::eCALReader::TCP::SAttributes& attr_);
     ~CDataReaderTCP();
 
     bool Create(std::shared_ptr<tcp_pubsub::Executor>& executor_, std::shared_ptr<eCAL::CSubGate> subgate_);
@@ -55,10 +57,21 @@ namespace eCAL
 
     bool AddConnectionIfNecessary(const std::string& host_name_, uint16_t port_);
 
+    // maps the publishers topic id to its registered host name (v2 frames do not carry it)
+    void AddPublisher(uint64_t topic_id_, const std::string& host_name_);
+    void RemPublisher(uint64_t topic_id_);
+
   private:
     void OnTcpMessage(const tcp_pubsub::CallbackData& callback_data);
+    void OnTcpFrame(const char* frame_, size_t frame_size_);
+    void OnTcpFrameV1(const char* frame_, size_t frame_size_);
+    void OnTcpFrameV2(const char* frame_, size_t frame_size_);
+
+    std::string                             m_topic_name;
 
-    Payload::Sample                         m_ecal_header;
+    using PublisherHostNameMapT = std::unordered_map<uint64_t, std::string>;
+    std::shared_timed_mutex                 m_publisher_mutex;
+    PublisherHostNameMapT                   m_publisher_host_name_map;
 
     std::shared_ptr<tcp_pubsub::Subscriber> m_subscriber;
     bool                                    m_callback_active;
@@ -81,6 +94,9 @@ namespace eCAL
 
     void SetConnectionParameter(SReaderLayerPar& /*par_*/) override;
 
+    // unregistered writer of a subscribed topic
+    void RemPublisher(const std::string& topic_name_, const EntityIdT& topic_id_);
+
   private:
     std::atomic<bool> m_initialized;
     std::shared_ptr<tcp_pubsub::Executor>   m_executor;
@@ -0,0 +1,153 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  tcp data layer frame header (binary framing v2)
+**/
+
+#include "ecal_tcp_frame.h"
+
+#include "ecal_utils/portable_endian.h"
+
+#include <cstring>
+
+namespace
+{
+  constexpr size_t   magic_size         = 4;
+  constexpr uint16_t legacy_header_size = 2;
+
+  constexpr size_t legacy_header_size_offset = 4;
+  constexpr size_t legacy_tag_offset         = 6;
+  constexpr size_t version_offset            = 7;
+  constexpr size_t header_size_offset        = 8;
+  constexpr size_t process_id_offset         = 12;
+  constexpr size_t topic_id_offset           = 16;
+  constexpr size_t id_offset                 = 24;
+  constexpr size_t clock_offset              = 32;
+  constexpr size_t time_offset               = 40;
+  constexpr size_t hash_offset               = 48;
+  constexpr size_t payload_size_offset       = 56;
+
+  void WriteUInt16(char* target_, uint16_t value_)
+  {
+    value_ = htole16(value_);
+    std::memcpy(target_, &value_, sizeof(value_));
+  }
+
+  void WriteUInt32(char* target_, uint32_t value_)
+  {
+    value_ = htole32(value_);
+    std::memcpy(target_, &value_, sizeof(value_));
+  }
+
+  void WriteUInt64(char* target_, uint64_t value_)
+  {
+    value_ = htole64(value_);
+    std::memcpy(target_, &value_, sizeof(value_));
+  }
+
+  uint16_t ReadUInt16(const char* source_)
+  {
+    uint16_t value = 0;
+    std::memcpy(&value, source_, sizeof(value));
+    return le16toh(value);
+  }
+
+  uint32_t ReadUInt32(const char* source_)
+  {
+    uint32_t value = 0;
+    std::memcpy(&value, source_, sizeof(value));
+    return le32toh(value);
+  }
+
+  uint64_t ReadUInt64(const char* source_)
+  {
+    uint64_t value = 0;
+    std::memcpy(&value, source_, sizeof(value));
+    return le64toh(value);
+  }
+}
+
+namespace eCAL
+{
+  namespace TCP
+  {
+    void SerializeFrameHeaderV2(const SFrameHeader& header_, std::vector<char>& target_buffer_)
+    {
+      target_buffer_.assign(frame_header_v2_size, 0);
+      char* data = target_buffer_.data();
+
+      data[0] = 'E';
+      data[1] = 'C';
+      data[2] = 'A';
+      data[3] = 'L';
+
+      WriteUInt16(data + legacy_header_size_offset, legacy_header_size);
+      data[legacy_tag_offset] = 0;
+      data[version_offset]    = static_cast<char>(frame_version_v2);
+      WriteUInt16(data + header_size_offset, static_cast<uint16_t>(frame_header_v2_size));
+
+      WriteUInt32(data + process_id_offset,   static_cast<uint32_t>(header_.process_id));
+      WriteUInt64(data + topic_id_offset,     header_.topic_id);
+      WriteUInt64(data + id_offset,           static_cast<uint64_t>(header_.id));
+      WriteUInt64(data + clock_offset,        static_cast<uint64_t>(header_.clock));
+      WriteUInt64(data + time_offset,         static_cast<uint64_t>(header_.time));
+      WriteUInt64(data + hash_offset,         static_cast<uint64_t>(header_.hash));
+      WriteUInt64(data + payload_size_offset, header_.payload_size);
+    }
+
+    int32_t GetFrameVersion(const char* data_, size_t size_)
+    {
+      if ((data_ == nullptr) || (size_ < magic_size + sizeof(uint16_t))) return 0;
+
+      // v1 frames carry a protobuf header here, which never starts with a zero byte
+      const uint16_t header_size = ReadUInt16(data_ + legacy_header_size_offset);
+      if ((header_size != legacy_header_size) || (size_ <= legacy_tag_offset) || (data_[legacy_tag_offset] != 0))
+      {
+        return frame_version_v1;
+      }
+
+      if (size_ <= version_offset) return 0;
+      return static_cast<int32_t>(static_cast<uint8_t>(data_[version_offset]));
+    }
+
+    bool DeserializeFrameHeaderV2(const char* data_, size_t size_, SFrameHeader& header_, size_t& payload_offset_)
+    {
+      if (GetFrameVersion(data_, size_) < frame_version_v2) return false;
+      if (size_ < frame_header_v2_size)                     return false;
+
+      // later versions may extend the header, the payload always starts at header size
+      const size_t header_size = ReadUInt16(data_ + header_size_offset);
+      if ((header_size < frame_header_v2_size) || (header_size > size_)) return false;
+
+      header_.process_id   = static_cast<int32_t>(ReadUInt32(data_ + process_id_offset));
+      header_.topic_id     = ReadUInt64(data_ + topic_id_offset);
+      header_.id           = static_cast<int64_t>(ReadUInt64(data_ + id_offset));
+      header_.clock        = static_cast<int64_t>(ReadUInt64(data_ + clock_offset));
+      header_.time         = static_cast<int64_t>(ReadUInt64(data_ + time_offset));
+      header_.hash         = static_cast<int64_t>(ReadUInt64(data_ + hash_offset));
+      header_.payload_size = ReadUInt64(data_ + payload_size_offset);
+
+      if (header_.payload_size > size_ - header_size) return false;
+
+      payload_offset_ = header_size;
+      return true;
+    }
+  }
+}
@@ -0,0 +1,82 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  tcp data layer frame header (binary framing v2)
+ *
+ * Every tcp frame starts with the 'ECAL' magic followed by a 16 bit header size.
+ * Framing v1 puts a protobuf encoded Payload::Sample there (padded to align the
+ * payload). Framing v2 uses a fixed little endian layout instead:
+ *
+ *   offset  size  field
+ *        0     4  magic 'ECAL'
+ *        4     2  legacy header size (always 2)
+ *        6     1  0x00 (invalid protobuf tag, v1 readers reject the frame)
+ *        7     1  frame version (2)
+ *        8     2  header size (payload offset, multiple of 8)
+ *       10     2  reserved
+ *       12     4  process id
+ *       16     8  topic id
+ *       24     8  sample id
+ *       32     8  clock
+ *       40     8  send time
+ *       48     8  hash
+ *       56     8  payload size
+ *
+ * Readers announce the framing version they understand in their tcp layer
+ * registration parameter, writers only send v2 frames if all subscribers do.
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace eCAL
+{
+  namespace TCP
+  {
+    constexpr int32_t frame_version_v1 = 1;
+    constexpr int32_t frame_version_v2 = 2;
+
+    // size of the v2 frame header, the payload directly follows (8 byte aligned)
+    constexpr size_t frame_header_v2_size = 64;
+
+    struct SFrameHeader
+    {
+      uint64_t topic_id     = 0;
+      int32_t  process_id   = 0;
+      int64_t  id           = 0;
+      int64_t  clock        = 0;
+      int64_t  time         = 0;
+      int64_t  hash         = 0;
+      uint64_t payload_size = 0;
+    };
+
+    // writes the complete v2 frame header (including the magic) into target_buffer_
+    void SerializeFrameHeaderV2(const SFrameHeader& header_, std::vector<char>& target_buffer_);
+
+    // returns the framing version of a received frame (0 if the frame is invalid)
+    int32_t GetFrameVersion(const char* data_, size_t size_);
+
+    // reads a v2 (or later) frame header, payload_offset_ is the start of the payload within data_
+    bool DeserializeFrameHeaderV2(const char* data_, size_t size_, SFrameHeader& header_, size_t& payload_offset_);
+  }
+}
@@ -27,10 +27,12 @@
 #include "serialization/ecal_serialize_sample_payload.h"
 
 #include "ecal_writer_tcp.h"
+#include "ecal_tcp_frame.h"
 #include "ecal_tcp_pubsub_logger.h"
 
 #include "ecal_utils/portable_endian.h"
 
+#include <chrono>
 #include <cstring>
 #include <asio.hpp>
 
@@ -72,6 +74,18 @@ namespace eCAL
     // create publisher
     m_publisher = std::make_shared<tcp_pubsub::Publisher>(g_tcp_writer_executor, GetPreferredAnyAddress(), ANY_PORT);
     m_port      = m_publisher->getPort();
+
+    // coalescing of small samples (only used with v2 frames)
+    if (m_attributes.coalescing_max_delay_us > 0)
+    {
+      const std::shared_ptr<tcp_pubsub::Publisher> publisher = m_publisher;
+      auto flush_callback = [publisher](const std::vector<char>& batch_)
+        {
+          const std::vector<std::pair<const char* const, const size_t>> send_vec = { { batch_.data(), batch_.size() } };
+          publisher->send(send_vec);
+        };
+      m_coalescer = std::make_unique<CSampleCoalescer>(m_attributes.coalescing_max_size, std::chrono::microseconds(m_attributes.coalescing_max_delay_us), flush_callback);
+    }
   }
 
   SWriterInfo CDataWriterTCP::GetInfo()
@@ -89,10 +103,121 @@ namespace eCAL
     return info_;
   }
 
+  void CDataWriterTCP::ApplySubscription(const std::string& /*host_name_*/, const int32_t /*process_id_*/, const EntityIdT& topic_id_, const Registration::ConnectionPar& conn_par_)
+  {
+    const std::lock_guard<std::mutex> lock(m_subscription_mtx);
+    m_subscription_frame_version[topic_id_] = conn_par_.layer_par_tcp.frame_version;
+    UpdateFrameVersion();
+  }
+
+  void CDataWriterTCP::RemoveSubscription(const std::string& /*host_name_*/, const int32_t /*process_id_*/, const EntityIdT& topic_id_)
+  {
+    const std::lock_guard<std::mutex> lock(m_subscription_mtx);
+    m_subscription_frame_version.erase(topic_id_);
+    UpdateFrameVersion();
+  }
+
+  void CDataWriterTCP::UpdateFrameVersion()
+  {
+    // v2 frames are only sent if every known subscriber is able to read them,
+    // subscribers of older eCAL versions do not announce a frame version at all
+    bool use_frame_v2 = !m_subscription_frame_version.empty();
+    for (const auto& subscription : m_subscription_frame_version)
+    {
+      use_frame_v2 = use_frame_v2 && (subscription.second >= TCP::frame_version_v2);
+    }
+    m_use_frame_v2 = use_frame_v2;
+  }
+
   bool CDataWriterTCP::Write(const void* const buf_, const SWriterAttr& attr_)
   {
     if (!m_publisher) return false;
 
+    if (m_use_frame_v2)
+    {
+      SerializeFrameHeaderV2(attr_);
+
+      // small samples are packed into one tcp message if coalescing is enabled
+      if (m_coalescer && m_coalescer->Add(m_header_buffer.data(), m_header_buffer.size(), static_cast<const char*>(buf_), attr_.len))
+      {
+        return true;
+      }
+    }
+    else
+    {
+      SerializeFrameHeaderV1(attr_);
+    }
+
+    // keep the sample order, pending packed samples go first
+    if (m_coalescer) m_coalescer->Flush();
+
+    // create tcp send buffer
+    std::vector<std::pair<const char* const, const size_t>> send_vec;
+    send_vec.reserve(2);
+
+    // push header data
+    send_vec.emplace_back(m_header_buffer.data(), m_header_buffer.size());
+    // push payload data
+    send_vec.emplace_back(static_cast<const char*>(buf_), attr_.len);
+
+    // send it
+    const bool success = m_publisher->send(send_vec);
+
+    // return success
+    return success;
+  }
+
+  bool CDataWriterTCP::WriteBatch(const std::vector<SWriterBatchSample>& samples_)
+  {
+    // readers of v1 frames do not understand batches
+    if (!m_publisher || !m_use_frame_v2 || (samples_.size() < 2)) return CDataWriterBase::WriteBatch(samples_);
+
+    // keep the sample order, pending packed samples go first
+    if (m_coalescer) m_coalescer->Flush();
+
+    // pack the samples into as few tcp messages as possible
+    bool written(false);
+    CSampleBatchBuilder batch(m_attributes.coalescing_max_size);
+    auto send_batch = [&]()
+      {
+        if (batch.Empty()) return;
+        const std::vector<std::pair<const char* const, const size_t>> send_vec = { { batch.Get().data(), batch.Get().size() } };
+        written |= m_publisher->send(send_vec);
+        batch.Clear();
+      };
+
+    for (const auto& sample : samples_)
+    {
+      SerializeFrameHeaderV2(sample.attr);
+      if (batch.Add(m_header_buffer.data(), m_header_buffer.size(), sample.buf, sample.attr.len)) continue;
+
+      send_batch();
+      if (batch.Add(m_header_buffer.data(), m_header_buffer.size(), sample.buf, sample.attr.len)) continue;
+
+      // too large to be packed
+      const std::vector<std::pair<const char* const, const size_t>> send_vec = { { m_header_buffer.data(), m_header_buffer.size() }, { sample.buf, sample.attr.len } };
+      written |= m_publisher->send(send_vec);
+    }
+    send_batch();
+
+    return written;
+  }
+
+  void CDataWriterTCP::SerializeFrameHeaderV2(const SWriterAttr& attr_)
+  {
+    TCP::SFrameHeader frame_header;
+    frame_header.topic_id     = m_attributes.topic_id;
+    frame_header.process_id   = m_attributes.process_id;
+    frame_header.id           = attr_.id;
+    frame_header.clock        = attr_.clock;
+    frame_header.time         = attr_.time;
+    frame_header.hash         = static_cast<int64_t>(attr_.hash);
+    frame_header.payload_size = attr_.len;
+    TCP::SerializeFrameHeaderV2(frame_header, m_header_buffer);
+  }
+
+  void CDataWriterTCP::SerializeFrameHeaderV1(const SWriterAttr& attr_)
+  {
     // create new payload sample (header information only, no payload)
     Payload::Sample proto_header;
     auto& proto_header_topic = proto_header.topic_info;
@@ -150,27 +275,15 @@ namespace eCAL
 
     // copy serialized proto header right after sample size field
     memcpy((void*)(m_header_buffer.data() + ecal_magic_size + sizeof(uint16_t)), serialized_proto_header.data(), serialized_proto_header.size());
-
-    // create tcp send buffer
-    std::vector<std::pair<const char* const, const size_t>> send_vec;
-    send_vec.reserve(2);
-
-    // push header data
-    send_vec.emplace_back(m_header_buffer.data(), m_header_buffer.size());
-    // push payload data
-    send_vec.emplace_back(static_cast<const char*>(buf_), attr_.len);
-
-    // send it
-    const bool success = m_publisher->send(send_vec);
-
-    // return success
-    return success;
   }
 
   Registration::LayerParTcp CDataWriterTCP::GetConnectionParameter()
   {
     Registration::LayerParTcp connection_par;
     connection_par.port = m_port;
+
+    // reported for monitoring only, the session send queues are owned by tcp_pubsub
+    connection_par.connection_count = static_cast<int32_t>(m_publisher->getSubscriberCount());
     return connection_par;
   }
 }
@@ -25,11 +25,15 @@
 
 #include "config/attributes/data_writer_tcp_attributes.h"
 
+#include "readwrite/ecal_sample_batch.h"
 #include "readwrite/ecal_writer_base.h"
 
 #include <tcp_pubsub/executor.h>
 #include <tcp_pubsub/publisher.h>
 
+#include <atomic>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -44,19 +48,33 @@ namespace eCAL
 
     SWriterInfo GetInfo() override;
 
+    void ApplySubscription(const std::string& host_name_, int32_t process_id_, const EntityIdT& topic_id_, const Registration::ConnectionPar& conn_par_) override;
+    void RemoveSubscription(const std::string& host_name_, int32_t process_id_, const EntityIdT& topic_id_) override;
+
     bool Write(const void* buf_, const SWriterAttr& attr_) override;
+    bool WriteBatch(const std::vector<SWriterBatchSample>& samples_) override;
 
     Registration::LayerParTcp GetConnectionParameter() override;
 
   private:
+    void UpdateFrameVersion();
+    void SerializeFrameHeaderV1(const SWriterAttr& attr_);
+    void SerializeFrameHeaderV2(const SWriterAttr& attr_);
+
     eCAL::eCALWriter::TCP::SAttributes           m_attributes;
 
     std::vector<char>                            m_header_buffer;
 
+    std::mutex                                   m_subscription_mtx;
+    std::map<EntityIdT, int32_t>                 m_subscription_frame_version;
+    std::atomic<bool>                            m_use_frame_v2{ false };
+
     static std::mutex                            g_tcp_writer_executor_mtx;
     static std::shared_ptr<tcp_pubsub::Executor> g_tcp_writer_executor;
 
     std::shared_ptr<tcp_pubsub::Publisher>       m_publisher;
     uint16_t                                     m_port = 0;
+
+    std::unique_ptr<CSampleCoalescer>            m_coalescer;
   };
 }
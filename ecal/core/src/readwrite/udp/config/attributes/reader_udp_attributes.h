@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace eCAL
@@ -34,6 +35,7 @@ namespace eCAL
         bool        broadcast;
         bool        loopback;
         int         receive_buffer;
+        size_t      max_sample_size;
       };
     }
   }
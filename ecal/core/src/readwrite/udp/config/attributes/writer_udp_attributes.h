@@ -38,6 +38,21 @@ namespace eCAL
         int         send_buffer;
         int         max_datagram_size;
 
+        bool         fec_enable;
+        unsigned int fec_block_size;
+        unsigned int fec_parity_count;
+
+        bool         reliable_enable;
+        unsigned int reliable_window_size;
+
+        unsigned int pacing_rate;
+        unsigned int pacing_burst;
+        unsigned int process_pacing_rate;
+        unsigned int process_pacing_burst;
+
+        unsigned int coalescing_max_delay_us;
+        unsigned int coalescing_max_size;
+
         std::string host_name;
         std::string topic_name;
         uint64_t    topic_id;
@@ -34,6 +34,7 @@ namespace eCAL
         receiver_attr.rcvbuf    = attr_.receive_buffer;
         receiver_attr.port      = attr_.port;
         receiver_attr.address   = attr_.address;
+        receiver_attr.max_sample_size = attr_.max_sample_size;
 
         return receiver_attr;
       }
@@ -56,6 +57,18 @@ namespace eCAL
         sender_attr.address   = attr_.address;
         sender_attr.ttl       = attr_.ttl;
 
+        sender_attr.fec_enable       = attr_.fec_enable;
+        sender_attr.fec_block_size   = static_cast<int>(attr_.fec_block_size);
+        sender_attr.fec_parity_count = static_cast<int>(attr_.fec_parity_count);
+
+        sender_attr.reliable_enable      = attr_.reliable_enable;
+        sender_attr.reliable_window_size = static_cast<int>(attr_.reliable_window_size);
+
+        sender_attr.pacing_rate          = attr_.pacing_rate;
+        sender_attr.pacing_burst         = attr_.pacing_burst;
+        sender_attr.process_pacing_rate  = attr_.process_pacing_rate;
+        sender_attr.process_pacing_burst = attr_.process_pacing_burst;
+
         return sender_attr;
       }
     }
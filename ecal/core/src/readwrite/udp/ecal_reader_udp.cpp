@@ -31,6 +31,7 @@
 #include "io/udp/ecal_udp_configurations.h"
 #include "pubsub/ecal_subgate.h"
 #include "config/builder/udp_attribute_builder.h"
+#include "util/entity_id_generator.h"
 
 #include <functional>
 #include <memory>
@@ -44,6 +45,7 @@ namespace eCAL
   ////////////////
   CUDPReaderLayer::CUDPReaderLayer(std::shared_ptr<eCAL::CSubGate> subgate_) 
     : m_started(false)
+    , m_nack_id(eCAL::Util::GenerateUniqueEntityId())
     , m_subgate(std::move(subgate_))
   {}
 
@@ -57,8 +59,10 @@ namespace eCAL
     if (!m_started)
     {      
       // start payload sample receiver
+      UDP::SReceiverAttr receiver_attr = eCALReader::UDP::ConvertToIOUDPReceiverAttributes(m_attributes);
+      receiver_attr.nack_id = m_nack_id;
       m_payload_receiver = std::make_shared<UDP::CSampleReceiver>(
-        eCALReader::UDP::ConvertToIOUDPReceiverAttributes(m_attributes), 
+        receiver_attr, 
         std::bind(&CUDPReaderLayer::HasSample, this, std::placeholders::_1), 
         std::bind(&CUDPReaderLayer::ApplySample, this, std::placeholders::_1, std::placeholders::_2)
       );
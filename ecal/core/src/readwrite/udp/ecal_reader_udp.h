@@ -29,6 +29,7 @@
 #include "config/attributes/reader_udp_attributes.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -52,11 +53,15 @@ namespace eCAL
 
     void SetConnectionParameter(SReaderLayerPar& /*par_*/) override {}
 
+    // announced by the subscribers, reliable writers only answer nacks of known ids
+    uint64_t GetNackId() const { return m_nack_id; }
+
   private:
     bool HasSample(const std::string& sample_name_);
     bool ApplySample(const char* serialized_sample_data_, size_t serialized_sample_size_);
 
     bool                                   m_started;
+    uint64_t                               m_nack_id;
     std::shared_ptr<UDP::CSampleReceiver>  m_payload_receiver;
     std::map<std::string, int>             m_topic_name_mcast_map;
 
@@ -29,7 +29,10 @@
 
 #include "config/builder/udp_attribute_builder.h"
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <set>
 
 namespace eCAL
 {
@@ -60,7 +63,140 @@ namespace eCAL
     return info_;
   }
 
+  Registration::LayerParUdpMC CDataWriterUdpMC::GetConnectionParameter()
+  {
+    Registration::LayerParUdpMC connection_par;
+
+    // pacing statistics of both sample senders
+    for (const auto& sample_sender : { m_sample_sender_loopback, m_sample_sender_no_loopback })
+    {
+      if (!sample_sender) continue;
+      const UDP::SPacingStatistics statistics = sample_sender->GetPacingStatistics();
+      connection_par.pacing_rate               = statistics.rate;
+      connection_par.pacing_delayed_datagrams += statistics.delayed_datagrams;
+      connection_par.pacing_delay_us          += statistics.delay_us;
+    }
+
+    return connection_par;
+  }
+
   bool CDataWriterUdpMC::Write(const void* const buf_, const SWriterAttr& attr_)
+  {
+    // send it (only the header is serialized, the payload is gathered directly from the user buffer)
+    size_t sent = 0;
+    if (SerializeSampleHeader(buf_, attr_))
+    {
+      const char* payload_addr  = static_cast<const char*>(buf_);
+      const auto& sample_sender = attr_.loopback ? m_sample_sender_loopback : m_sample_sender_no_loopback;
+      if (sample_sender)
+      {
+        // small samples are packed if coalescing is enabled and all subscribers accept sample batches
+        CSampleCoalescer* coalescer = GetCoalescer(attr_.loopback);
+        if ((coalescer != nullptr) && m_sample_batch_supported && coalescer->Add(m_header_buffer.data(), m_header_buffer.size(), payload_addr, attr_.len))
+        {
+          sent = m_header_buffer.size() + attr_.len;
+        }
+        else
+        {
+          // keep the sample order, pending packed samples go first
+          if (coalescer != nullptr) coalescer->Flush();
+          sent = sample_sender->Send(m_attributes.topic_name, m_header_buffer, payload_addr, attr_.len);
+        }
+      }
+    }
+
+    // log it
+    if (sent == 0)
+    {
+      Logging::Log(Logging::log_level_fatal, "CDataWriterUDP::Send failed to send message !");
+    }
+
+    return(sent > 0);
+  }
+
+  bool CDataWriterUdpMC::WriteBatch(const std::vector<SWriterBatchSample>& samples_)
+  {
+    if (samples_.empty()) return false;
+
+    const bool  loopback      = samples_.front().attr.loopback;
+    const auto& sample_sender = loopback ? m_sample_sender_loopback : m_sample_sender_no_loopback;
+    if (!sample_sender) return false;
+
+    // keep the sample order, pending packed samples go first
+    CSampleCoalescer* coalescer = GetCoalescer(loopback);
+    if (coalescer != nullptr) coalescer->Flush();
+
+    // subscribers without sample batch support get one datagram per sample
+    if ((samples_.size() < 2) || !m_sample_batch_supported) return CDataWriterBase::WriteBatch(samples_);
+
+    // pack the samples into as few datagrams as possible
+    size_t sent = 0;
+    CSampleBatchBuilder batch(m_attributes.coalescing_max_size);
+    auto send_batch = [&]()
+      {
+        if (batch.Empty()) return;
+        sent += sample_sender->Send(m_attributes.topic_name, batch.Get());
+        batch.Clear();
+      };
+
+    for (const auto& sample : samples_)
+    {
+      if (!SerializeSampleHeader(sample.buf, sample.attr)) continue;
+      if (batch.Add(m_header_buffer.data(), m_header_buffer.size(), sample.buf, sample.attr.len)) continue;
+
+      send_batch();
+      if (batch.Add(m_header_buffer.data(), m_header_buffer.size(), sample.buf, sample.attr.len)) continue;
+
+      // too large to be packed
+      sent += sample_sender->Send(m_attributes.topic_name, m_header_buffer, sample.buf, sample.attr.len);
+    }
+    send_batch();
+
+    // log it
+    if (sent == 0)
+    {
+      Logging::Log(Logging::log_level_fatal, "CDataWriterUDP::WriteBatch failed to send messages !");
+    }
+
+    return(sent > 0);
+  }
+
+  void CDataWriterUdpMC::ApplySubscription(const std::string& /*host_name_*/, const int32_t /*process_id_*/, const EntityIdT& topic_id_, const Registration::ConnectionPar& conn_par_)
+  {
+    const std::lock_guard<std::mutex> lock(m_subscription_sync);
+    m_subscription_layer_par[topic_id_] = conn_par_.layer_par_udpmc;
+    UpdateSubscriptionSupport();
+  }
+
+  void CDataWriterUdpMC::RemoveSubscription(const std::string& /*host_name_*/, const int32_t /*process_id_*/, const EntityIdT& topic_id_)
+  {
+    const std::lock_guard<std::mutex> lock(m_subscription_sync);
+    m_subscription_layer_par.erase(topic_id_);
+    UpdateSubscriptionSupport();
+  }
+
+  void CDataWriterUdpMC::UpdateSubscriptionSupport()
+  {
+    bool sample_batch_supported  = !m_subscription_layer_par.empty();
+    bool fec_fragments_supported = !m_subscription_layer_par.empty();
+    std::set<uint64_t> nack_ids;
+    for (const auto& subscription : m_subscription_layer_par)
+    {
+      sample_batch_supported  = sample_batch_supported  && subscription.second.sample_batch;
+      fec_fragments_supported = fec_fragments_supported && subscription.second.fec_fragments;
+      if (subscription.second.nack_id != 0) nack_ids.insert(subscription.second.nack_id);
+    }
+    m_sample_batch_supported = sample_batch_supported;
+
+    for (const auto& sample_sender : { m_sample_sender_loopback, m_sample_sender_no_loopback })
+    {
+      if (!sample_sender) continue;
+      sample_sender->SetPacingFragmentation(fec_fragments_supported);
+      sample_sender->SetNackIds(nack_ids);
+    }
+  }
+
+  bool CDataWriterUdpMC::SerializeSampleHeader(const void* const buf_, const SWriterAttr& attr_)
   {
     // create new sample
     Payload::Sample ecal_sample;
@@ -82,32 +218,25 @@ namespace eCAL
     ecal_sample_content.payload.raw_addr = static_cast<const char*>(buf_);
     ecal_sample_content.payload.raw_size = attr_.len;
 
-    // send it
-    size_t sent = 0;
-    if (SerializeToBuffer(ecal_sample, m_sample_buffer))
-    {
-      if (attr_.loopback)
-      {
-        if (m_sample_sender_loopback)
-        {
-          sent = m_sample_sender_loopback->Send(ecal_sample.topic_info.topic_name, m_sample_buffer);
-        }
-      }
-      else
-      {
-        if (m_sample_sender_no_loopback)
-        {
-          sent = m_sample_sender_no_loopback->Send(ecal_sample.topic_info.topic_name, m_sample_buffer);
-        }
-      }
-    }
+    // serialize the header only, the payload is gathered directly from the user buffer
+    return SerializeHeaderToBuffer(ecal_sample, m_header_buffer);
+  }
 
-    // log it
-    if (sent == 0)
+  CSampleCoalescer* CDataWriterUdpMC::GetCoalescer(bool loopback_)
+  {
+    if (m_attributes.coalescing_max_delay_us == 0) return nullptr;
+
+    auto& coalescer = loopback_ ? m_coalescer_loopback : m_coalescer_no_loopback;
+    if (!coalescer)
     {
-      Logging::Log(Logging::log_level_fatal, "CDataWriterUDP::Send failed to send message !");
+      const std::shared_ptr<UDP::CSampleSender> sample_sender = loopback_ ? m_sample_sender_loopback : m_sample_sender_no_loopback;
+      const std::string                         topic_name    = m_attributes.topic_name;
+      auto flush_callback = [sample_sender, topic_name](const std::vector<char>& batch_)
+        {
+          sample_sender->Send(topic_name, batch_);
+        };
+      coalescer = std::make_unique<CSampleCoalescer>(m_attributes.coalescing_max_size, std::chrono::microseconds(m_attributes.coalescing_max_delay_us), flush_callback);
     }
-
-    return(sent > 0);
+    return coalescer.get();
   }
 }
@@ -24,10 +24,14 @@
 #pragma once
 
 #include "io/udp/ecal_udp_sample_sender.h"
+#include "readwrite/ecal_sample_batch.h"
 #include "readwrite/ecal_writer_base.h"
 #include "config/attributes/writer_udp_attributes.h"
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -40,13 +44,32 @@ namespace eCAL
 
     SWriterInfo GetInfo() override;
 
+    Registration::LayerParUdpMC GetConnectionParameter() override;
+
     bool Write(const void* buf_, const SWriterAttr& attr_) override;
+    bool WriteBatch(const std::vector<SWriterBatchSample>& samples_) override;
+
+    void ApplySubscription(const std::string& host_name_, int32_t process_id_, const EntityIdT& topic_id_, const Registration::ConnectionPar& conn_par_) override;
+    void RemoveSubscription(const std::string& host_name_, int32_t process_id_, const EntityIdT& topic_id_) override;
 
   protected:
-    std::vector<char>                   m_sample_buffer;
+    bool SerializeSampleHeader(const void* buf_, const SWriterAttr& attr_);
+    CSampleCoalescer* GetCoalescer(bool loopback_);
+    void UpdateSubscriptionSupport();
+
+    std::vector<char>                   m_header_buffer;
     std::shared_ptr<UDP::CSampleSender> m_sample_sender_loopback;
     std::shared_ptr<UDP::CSampleSender> m_sample_sender_no_loopback;
 
+    // samples are packed (fragmented for the pacing) only if all subscribers accept sample batches (fec fragments)
+    std::mutex                                       m_subscription_sync;
+    std::map<EntityIdT, Registration::LayerParUdpMC> m_subscription_layer_par;
+    std::atomic<bool>                                m_sample_batch_supported{ false };
+
+    // destroyed before the sample senders, pending samples are flushed on destruction
+    std::unique_ptr<CSampleCoalescer>   m_coalescer_loopback;
+    std::unique_ptr<CSampleCoalescer>   m_coalescer_no_loopback;
+
     eCALWriter::UDP::SAttributes        m_attributes;
   };
 }
@@ -0,0 +1,251 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  unix domain socket data reader
+**/
+
+#include "ecal_reader_uds.h"
+#include "ecal_uds_socket.h"
+
+#include "pubsub/ecal_subgate.h"
+
+#include <ecal/log.h>
+
+#include <array>
+#include <string>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace eCAL
+{
+  ////////////////
+  // READER
+  ////////////////
+  CDataReaderUDS::CDataReaderUDS(const std::string& topic_name_, std::shared_ptr<eCAL::CSubGate> subgate_, const eCAL::eCALReader::UDSLayer::SAttributes& attr_)
+    : m_topic_name(topic_name_)
+    , m_subgate(std::move(subgate_))
+    , m_attributes(attr_)
+  {}
+
+  CDataReaderUDS::~CDataReaderUDS()
+  {
+    Destroy();
+  }
+
+  bool CDataReaderUDS::Destroy()
+  {
+    const std::lock_guard<std::mutex> lock(m_connection_mtx);
+    if (m_connection_map.empty()) return false;
+
+    for (auto& connection : m_connection_map)
+    {
+      CloseConnection(*connection.second);
+    }
+    m_connection_map.clear();
+    return true;
+  }
+
+  bool CDataReaderUDS::AddConnectionIfNecessary(const std::string& host_name_, int32_t process_id_, uint64_t topic_id_, const std::string& path_)
+  {
+    if (path_.empty()) return false;
+
+    const std::lock_guard<std::mutex> lock(m_connection_mtx);
+
+    // release the connections closed by their writer or by a protocol error together with their threads,
+    // a writer restarted with the same socket path is connected again below
+    for (auto iter = m_connection_map.begin(); iter != m_connection_map.end();)
+    {
+      if (iter->second->closed)
+      {
+        CloseConnection(*iter->second);
+        iter = m_connection_map.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+
+    // keep a running connection
+    if (m_connection_map.find(path_) != m_connection_map.end()) return true;
+
+    const int connection_socket = UDS::Connect(path_);
+    if (connection_socket < 0) return false;
+
+    auto connection = std::make_unique<SConnection>();
+    connection->socket     = connection_socket;
+    connection->host_name  = host_name_;
+    connection->process_id = process_id_;
+    connection->topic_id   = topic_id_;
+    connection->thread     = std::thread(&CDataReaderUDS::ReceiveFrames, this, std::ref(*connection));
+
+    m_connection_map.emplace(path_, std::move(connection));
+    return true;
+  }
+
+  void CDataReaderUDS::ReceiveFrames(SConnection& connection_)
+  {
+    std::vector<char> buffer;
+    while (ReceiveFrame(connection_, buffer)) {}
+
+    // let the writer see the closed connection, the socket is released with the next registration
+    UDS::Shutdown(connection_.socket);
+    connection_.closed = true;
+  }
+
+  bool CDataReaderUDS::ReceiveFrame(SConnection& connection_, std::vector<char>& buffer_)
+  {
+    std::array<char, UDS::frame_header_size> header_buffer{};
+    int memfd(-1);
+    if (!UDS::Receive(connection_.socket, header_buffer.data(), header_buffer.size(), memfd)) return false;
+
+    UDS::SFrameHeader header;
+    if (!UDS::DeserializeFrameHeader(header_buffer.data(), header))
+    {
+      // the stream is out of sync, there is no way to find the next frame
+      UDS::Close(memfd);
+      return false;
+    }
+
+    // a streamed payload is received into memory completely, a corrupt or hostile size closes the connection
+    // (the size of a memfd payload is checked against the passed file)
+    const bool memfd_frame = (header.flags & UDS::frame_flag_memfd) != 0;
+    if (!memfd_frame && (header.payload_size > m_attributes.max_sample_size))
+    {
+      Logging::Log(Logging::log_level_warning, "CDataReaderUDS: Sample of topic " + m_topic_name + " exceeds the maximum sample size (" + std::to_string(header.payload_size) + " bytes), closing connection");
+      UDS::Close(memfd);
+      return false;
+    }
+
+    const auto payload_size = static_cast<size_t>(header.payload_size);
+
+    if (memfd_frame)
+    {
+      if (memfd < 0) return false;
+
+      struct stat memfd_stat {};
+      if ((fstat(memfd, &memfd_stat) != 0) || (static_cast<uint64_t>(memfd_stat.st_size) < header.payload_size))
+      {
+        UDS::Close(memfd);
+        return false;
+      }
+
+      void* payload = (payload_size > 0) ? mmap(nullptr, payload_size, PROT_READ, MAP_SHARED, memfd, 0) : nullptr;
+      UDS::Close(memfd);
+      if (payload == MAP_FAILED) return true;
+
+      ApplyFrame(connection_, header, static_cast<const char*>(payload));
+      if (payload != nullptr) (void)munmap(payload, payload_size);
+      return true;
+    }
+
+    // a streamed payload never carries a file descriptor
+    UDS::Close(memfd);
+
+    if (buffer_.size() < payload_size) buffer_.resize(payload_size);
+    if (payload_size > 0)
+    {
+      int unexpected_fd(-1);
+      if (!UDS::Receive(connection_.socket, buffer_.data(), payload_size, unexpected_fd)) return false;
+      UDS::Close(unexpected_fd);
+    }
+
+    ApplyFrame(connection_, header, buffer_.data());
+    return true;
+  }
+
+  void CDataReaderUDS::ApplyFrame(const SConnection& connection_, const UDS::SFrameHeader& header_, const char* payload_)
+  {
+    if (!m_subgate) return;
+
+    Payload::TopicInfoView topic_info;
+    topic_info.host_name  = connection_.host_name;
+    topic_info.topic_id   = connection_.topic_id;
+    topic_info.topic_name = m_topic_name;
+    topic_info.process_id = connection_.process_id;
+
+    m_subgate->ApplySample(
+      topic_info,
+      payload_,
+      static_cast<size_t>(header_.payload_size),
+      header_.id,
+      header_.clock,
+      header_.time,
+      static_cast<size_t>(header_.hash),
+      tl_ecal_uds);
+  }
+
+  void CDataReaderUDS::CloseConnection(SConnection& connection_)
+  {
+    // unblock the receive thread, then release the socket
+    UDS::Shutdown(connection_.socket);
+    if (connection_.thread.joinable()) connection_.thread.join();
+    UDS::Close(connection_.socket);
+    connection_.socket = -1;
+  }
+
+  ////////////////
+  // LAYER
+  ////////////////
+  CUDSReaderLayer::CUDSReaderLayer(std::shared_ptr<eCAL::CSubGate> subgate_)
+    : m_subgate(std::move(subgate_))
+  {}
+
+  void CUDSReaderLayer::Initialize(const eCAL::eCALReader::UDSLayer::SAttributes& attr_)
+  {
+    m_attributes = attr_;
+  }
+
+  void CUDSReaderLayer::AddSubscription(const std::string& /*host_name_*/, const std::string& topic_name_, const EntityIdT& /*topic_id_*/)
+  {
+    const std::string& map_key(topic_name_);
+
+    const std::lock_guard<std::mutex> lock(m_datareaderuds_sync);
+    if (m_datareaderuds_map.find(map_key) != m_datareaderuds_map.end()) return;
+
+    m_datareaderuds_map.emplace(map_key, std::make_shared<CDataReaderUDS>(topic_name_, m_subgate, m_attributes));
+  }
+
+  void CUDSReaderLayer::RemSubscription(const std::string& /*host_name_*/, const std::string& topic_name_, const EntityIdT& /*topic_id_*/)
+  {
+    const std::string& map_key(topic_name_);
+
+    const std::lock_guard<std::mutex> lock(m_datareaderuds_sync);
+    const DataReaderUDSMapT::iterator iter = m_datareaderuds_map.find(map_key);
+    if (iter == m_datareaderuds_map.end()) return;
+
+    iter->second->Destroy();
+    m_datareaderuds_map.erase(iter);
+  }
+
+  void CUDSReaderLayer::SetConnectionParameter(SReaderLayerPar& par_)
+  {
+    // the socket is reachable on the writers host or through a shared socket directory (containers
+    // with different host names), so we just try to connect, a failing connect is cheap
+    const std::string map_key(par_.topic_name);
+
+    const std::lock_guard<std::mutex> lock(m_datareaderuds_sync);
+    const DataReaderUDSMapT::iterator iter = m_datareaderuds_map.find(map_key);
+    if (iter == m_datareaderuds_map.end()) return;
+
+    iter->second->AddConnectionIfNecessary(par_.host_name, par_.process_id, par_.topic_id, par_.parameter.layer_par_uds.path);
+  }
+}
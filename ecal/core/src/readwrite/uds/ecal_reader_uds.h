@@ -0,0 +1,110 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  unix domain socket data reader
+**/
+
+#pragma once
+
+#include "readwrite/ecal_reader_layer.h"
+#include "config/attributes/uds_reader_layer_attributes.h"
+
+#include "ecal_uds_frame.h"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace eCAL
+{
+  class CSubGate;
+
+  ////////////////
+  // READER
+  ////////////////
+  class CDataReaderUDS
+  {
+  public:
+    CDataReaderUDS(const std::string& topic_name_, std::shared_ptr<eCAL::CSubGate> subgate_, const eCAL::eCALReader::UDSLayer::SAttributes& attr_);
+    ~CDataReaderUDS();
+
+    CDataReaderUDS(const CDataReaderUDS&) = delete;
+    CDataReaderUDS& operator=(const CDataReaderUDS&) = delete;
+
+    bool Destroy();
+
+    bool AddConnectionIfNecessary(const std::string& host_name_, int32_t process_id_, uint64_t topic_id_, const std::string& path_);
+
+  private:
+    struct SConnection
+    {
+      int               socket     = -1;
+      std::atomic<bool> closed{ false };
+      std::thread       thread;
+
+      std::string       host_name;
+      int32_t           process_id = 0;
+      uint64_t          topic_id   = 0;
+    };
+
+    void ReceiveFrames(SConnection& connection_);
+    bool ReceiveFrame(SConnection& connection_, std::vector<char>& buffer_);
+    void ApplyFrame(const SConnection& connection_, const UDS::SFrameHeader& header_, const char* payload_);
+
+    static void CloseConnection(SConnection& connection_);
+
+    std::string                                         m_topic_name;
+    std::shared_ptr<eCAL::CSubGate>                     m_subgate;
+    eCAL::eCALReader::UDSLayer::SAttributes             m_attributes;
+
+    std::mutex                                          m_connection_mtx;
+    std::map<std::string, std::unique_ptr<SConnection>> m_connection_map;  // key: socket path of the writer
+  };
+
+  ////////////////
+  // LAYER
+  ////////////////
+  class CUDSReaderLayer : public CReaderLayer<CUDSReaderLayer, eCAL::eCALReader::UDSLayer::SAttributes>
+  {
+  public:
+    CUDSReaderLayer(std::shared_ptr<eCAL::CSubGate> subgate_);
+
+    void Initialize(const eCAL::eCALReader::UDSLayer::SAttributes& attr_) override;
+
+    void AddSubscription(const std::string& host_name_, const std::string& topic_name_, const EntityIdT& topic_id_) override;
+    void RemSubscription(const std::string& host_name_, const std::string& topic_name_, const EntityIdT& topic_id_) override;
+
+    void SetConnectionParameter(SReaderLayerPar& par_) override;
+
+  private:
+    using DataReaderUDSMapT = std::unordered_map<std::string, std::shared_ptr<CDataReaderUDS>>;
+    std::mutex                              m_datareaderuds_sync;
+    DataReaderUDSMapT                       m_datareaderuds_map;
+    eCAL::eCALReader::UDSLayer::SAttributes m_attributes;
+
+    std::shared_ptr<eCAL::CSubGate>         m_subgate;
+  };
+}
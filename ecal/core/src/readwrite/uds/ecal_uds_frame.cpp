@@ -0,0 +1,91 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  unix domain socket data layer frame header
+**/
+
+#include "ecal_uds_frame.h"
+
+#include "ecal_utils/portable_endian.h"
+
+#include <cstring>
+
+namespace
+{
+  constexpr size_t version_offset      = 4;
+  constexpr size_t flags_offset        = 5;
+  constexpr size_t id_offset           = 8;
+  constexpr size_t clock_offset        = 16;
+  constexpr size_t time_offset         = 24;
+  constexpr size_t hash_offset         = 32;
+  constexpr size_t payload_size_offset = 40;
+
+  void WriteUInt64(char* target_, uint64_t value_)
+  {
+    value_ = htole64(value_);
+    std::memcpy(target_, &value_, sizeof(value_));
+  }
+
+  uint64_t ReadUInt64(const char* source_)
+  {
+    uint64_t value = 0;
+    std::memcpy(&value, source_, sizeof(value));
+    return le64toh(value);
+  }
+}
+
+namespace eCAL
+{
+  namespace UDS
+  {
+    void SerializeFrameHeader(const SFrameHeader& header_, char* target_)
+    {
+      std::memset(target_, 0, frame_header_size);
+
+      target_[0] = 'E';
+      target_[1] = 'U';
+      target_[2] = 'D';
+      target_[3] = 'S';
+
+      target_[version_offset] = static_cast<char>(frame_version);
+      target_[flags_offset]   = static_cast<char>(header_.flags);
+
+      WriteUInt64(target_ + id_offset,           static_cast<uint64_t>(header_.id));
+      WriteUInt64(target_ + clock_offset,        static_cast<uint64_t>(header_.clock));
+      WriteUInt64(target_ + time_offset,         static_cast<uint64_t>(header_.time));
+      WriteUInt64(target_ + hash_offset,         static_cast<uint64_t>(header_.hash));
+      WriteUInt64(target_ + payload_size_offset, header_.payload_size);
+    }
+
+    bool DeserializeFrameHeader(const char* data_, SFrameHeader& header_)
+    {
+      if (std::memcmp(data_, "EUDS", 4) != 0)                                return false;
+      if (static_cast<uint8_t>(data_[version_offset]) != frame_version)      return false;
+
+      header_.flags        = static_cast<uint8_t>(data_[flags_offset]);
+      header_.id           = static_cast<int64_t>(ReadUInt64(data_ + id_offset));
+      header_.clock        = static_cast<int64_t>(ReadUInt64(data_ + clock_offset));
+      header_.time         = static_cast<int64_t>(ReadUInt64(data_ + time_offset));
+      header_.hash         = static_cast<int64_t>(ReadUInt64(data_ + hash_offset));
+      header_.payload_size = ReadUInt64(data_ + payload_size_offset);
+      return true;
+    }
+  }
+}
@@ -0,0 +1,70 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  unix domain socket data layer frame header
+ *
+ * Every sample on a unix domain socket stream starts with a fixed little endian header:
+ *
+ *   offset  size  field
+ *        0     4  magic 'EUDS'
+ *        4     1  frame version (1)
+ *        5     1  flags (bit 0: payload passed as memfd file descriptor)
+ *        6     2  reserved
+ *        8     8  sample id
+ *       16     8  clock
+ *       24     8  send time
+ *       32     8  hash
+ *       40     8  payload size
+ *
+ * The payload directly follows the header, except for memfd frames. There the
+ * file descriptor is attached to the header (SCM_RIGHTS) and no payload is streamed.
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eCAL
+{
+  namespace UDS
+  {
+    constexpr uint8_t frame_version     = 1;
+    constexpr size_t  frame_header_size = 48;
+
+    constexpr uint8_t frame_flag_memfd  = 0x01;
+
+    struct SFrameHeader
+    {
+      uint8_t  flags        = 0;
+      int64_t  id           = 0;
+      int64_t  clock        = 0;
+      int64_t  time         = 0;
+      int64_t  hash         = 0;
+      uint64_t payload_size = 0;
+    };
+
+    // writes the frame header into target_ (frame_header_size bytes)
+    void SerializeFrameHeader(const SFrameHeader& header_, char* target_);
+
+    // reads a frame header (frame_header_size bytes), false if magic or version do not match
+    bool DeserializeFrameHeader(const char* data_, SFrameHeader& header_);
+  }
+}
@@ -0,0 +1,342 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  unix domain socket helper (stream sockets, file descriptor passing)
+**/
+
+#include "ecal_uds_socket.h"
+
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+#ifdef MSG_NOSIGNAL
+  constexpr int send_flags = MSG_NOSIGNAL | MSG_DONTWAIT;
+#else
+  constexpr int send_flags = MSG_DONTWAIT;
+#endif
+
+#ifdef MSG_CMSG_CLOEXEC
+  constexpr int receive_flags = MSG_CMSG_CLOEXEC;
+#else
+  constexpr int receive_flags = 0;
+#endif
+
+  bool CreateAddress(const std::string& path_, sockaddr_un& address_, socklen_t& address_len_)
+  {
+    std::memset(&address_, 0, sizeof(address_));
+    address_.sun_family = AF_UNIX;
+
+    if (path_.empty() || (path_.size() >= sizeof(address_.sun_path))) return false;
+    std::memcpy(address_.sun_path, path_.data(), path_.size());
+
+    // abstract namespace: leading zero byte instead of '@', no terminating zero
+    if (path_[0] == '@')
+    {
+#if defined(__linux__)
+      address_.sun_path[0] = '\0';
+      address_len_ = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + path_.size());
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    address_len_ = static_cast<socklen_t>(sizeof(address_));
+    return true;
+  }
+
+  void ConfigureSocket(int socket_)
+  {
+    (void)fcntl(socket_, F_SETFD, FD_CLOEXEC);
+#ifdef SO_NOSIGPIPE
+    const int on = 1;
+    (void)setsockopt(socket_, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+  }
+}
+
+namespace eCAL
+{
+  namespace UDS
+  {
+    std::string CreateSocketPath(const std::string& socket_directory_, int32_t process_id_, uint64_t topic_id_)
+    {
+      const std::string socket_name = "ecal_" + std::to_string(process_id_) + "_" + std::to_string(topic_id_) + ".sock";
+      if (!socket_directory_.empty()) return socket_directory_ + "/" + socket_name;
+
+#if defined(__linux__)
+      return "@" + socket_name;
+#else
+      const char* tmp_directory = std::getenv("TMPDIR");
+      std::string directory = ((tmp_directory != nullptr) && (tmp_directory[0] != '\0')) ? tmp_directory : "/tmp";
+      if (directory.back() == '/') directory.pop_back();
+      return directory + "/" + socket_name;
+#endif
+    }
+
+    int Listen(const std::string& path_)
+    {
+      sockaddr_un address{};
+      socklen_t   address_len = 0;
+      if (!CreateAddress(path_, address, address_len)) return -1;
+
+      const int listen_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+      if (listen_socket < 0) return -1;
+      ConfigureSocket(listen_socket);
+
+      // remove a stale socket file of a crashed process with the same process id
+      RemovePath(path_);
+
+      if ((bind(listen_socket, reinterpret_cast<const sockaddr*>(&address), address_len) != 0)
+        || (listen(listen_socket, SOMAXCONN) != 0))
+      {
+        Close(listen_socket);
+        return -1;
+      }
+      return listen_socket;
+    }
+
+    int Connect(const std::string& path_)
+    {
+      sockaddr_un address{};
+      socklen_t   address_len = 0;
+      if (!CreateAddress(path_, address, address_len)) return -1;
+
+      const int connect_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+      if (connect_socket < 0) return -1;
+      ConfigureSocket(connect_socket);
+
+      if (connect(connect_socket, reinterpret_cast<const sockaddr*>(&address), address_len) != 0)
+      {
+        Close(connect_socket);
+        return -1;
+      }
+      return connect_socket;
+    }
+
+    int Accept(int listen_socket_)
+    {
+      const int connection = accept(listen_socket_, nullptr, nullptr);
+      if (connection < 0) return -1;
+      ConfigureSocket(connection);
+      return connection;
+    }
+
+    bool CreateSocketPair(int& first_socket_, int& second_socket_)
+    {
+      int sockets[2] = { -1, -1 };
+      if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0) return false;
+
+      for (const int socket_pair_socket : sockets)
+      {
+        ConfigureSocket(socket_pair_socket);
+        (void)fcntl(socket_pair_socket, F_SETFL, fcntl(socket_pair_socket, F_GETFL) | O_NONBLOCK);
+      }
+      first_socket_  = sockets[0];
+      second_socket_ = sockets[1];
+      return true;
+    }
+
+    void Poll(std::vector<SPollSocket>& sockets_, int timeout_ms_)
+    {
+      std::vector<pollfd> poll_fds(sockets_.size());
+      for (size_t i = 0; i < sockets_.size(); ++i)
+      {
+        poll_fds[i].fd     = sockets_[i].socket;
+        poll_fds[i].events = static_cast<short>(POLLIN | (sockets_[i].wait_writable ? POLLOUT : 0));
+      }
+
+      const int ready = poll(poll_fds.data(), static_cast<nfds_t>(poll_fds.size()), timeout_ms_);
+      for (size_t i = 0; i < sockets_.size(); ++i)
+      {
+        const short revents = (ready > 0) ? poll_fds[i].revents : static_cast<short>(0);
+        sockets_[i].readable = (revents & POLLIN) != 0;
+        sockets_[i].writable = (revents & POLLOUT) != 0;
+        sockets_[i].closed   = (revents & (POLLHUP | POLLERR | POLLNVAL)) != 0;
+      }
+    }
+
+    void Drain(int socket_)
+    {
+      std::array<char, 256> buffer{};
+      while (recv(socket_, buffer.data(), buffer.size(), MSG_DONTWAIT) > 0) {}
+    }
+
+    void Close(int socket_)
+    {
+      if (socket_ >= 0) (void)close(socket_);
+    }
+
+    void Shutdown(int socket_)
+    {
+      if (socket_ >= 0) (void)shutdown(socket_, SHUT_RDWR);
+    }
+
+    void RemovePath(const std::string& path_)
+    {
+      if (!path_.empty() && (path_[0] != '@')) (void)unlink(path_.c_str());
+    }
+
+    bool Send(int socket_, const char* header_, size_t header_size_, const char* payload_, size_t payload_size_, int fd_, size_t& sent_)
+    {
+      sent_ = 0;
+
+      iovec iov[2];
+      iov[0].iov_base = const_cast<char*>(header_);
+      iov[0].iov_len  = header_size_;
+      iov[1].iov_base = const_cast<char*>(payload_);
+      iov[1].iov_len  = payload_size_;
+
+      size_t       iov_index = 0;
+      const size_t iov_count = (payload_size_ > 0) ? 2 : 1;
+      bool         attach_fd = (fd_ >= 0);
+
+      alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+      while (iov_index < iov_count)
+      {
+        msghdr msg{};
+        msg.msg_iov    = &iov[iov_index];
+        msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(iov_count - iov_index);
+        if (attach_fd)
+        {
+          std::memset(control, 0, sizeof(control));
+          msg.msg_control    = control;
+          msg.msg_controllen = sizeof(control);
+          cmsghdr* cmsg      = CMSG_FIRSTHDR(&msg);
+          cmsg->cmsg_level   = SOL_SOCKET;
+          cmsg->cmsg_type    = SCM_RIGHTS;
+          cmsg->cmsg_len     = CMSG_LEN(sizeof(int));
+          std::memcpy(CMSG_DATA(cmsg), &fd_, sizeof(int));
+        }
+
+        const ssize_t sent = sendmsg(socket_, &msg, send_flags);
+        if (sent < 0)
+        {
+          if (errno == EINTR) continue;
+          // the socket buffer is full, the caller decides about the rest
+          if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) return true;
+          return false;
+        }
+        attach_fd = false;
+        sent_ += static_cast<size_t>(sent);
+
+        // skip the completely sent buffers, advance within a partially sent one
+        auto rest = static_cast<size_t>(sent);
+        while ((rest > 0) && (iov_index < iov_count))
+        {
+          if (rest >= iov[iov_index].iov_len)
+          {
+            rest -= iov[iov_index].iov_len;
+            ++iov_index;
+          }
+          else
+          {
+            iov[iov_index].iov_base = static_cast<char*>(iov[iov_index].iov_base) + rest;
+            iov[iov_index].iov_len -= rest;
+            rest = 0;
+          }
+        }
+      }
+      return true;
+    }
+
+    bool Receive(int socket_, char* buf_, size_t size_, int& fd_)
+    {
+      fd_ = -1;
+
+      size_t received = 0;
+      alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+      while (received < size_)
+      {
+        iovec iov{};
+        iov.iov_base = buf_ + received;
+        iov.iov_len  = size_ - received;
+
+        msghdr msg{};
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = control;
+        msg.msg_controllen = sizeof(control);
+
+        const ssize_t read = recvmsg(socket_, &msg, receive_flags);
+        if ((read < 0) && (errno == EINTR)) continue;
+        if (read <= 0)
+        {
+          Close(fd_);
+          fd_ = -1;
+          return false;
+        }
+
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+          if ((cmsg->cmsg_level != SOL_SOCKET) || (cmsg->cmsg_type != SCM_RIGHTS)) continue;
+          int fd(-1);
+          std::memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+          if (fd_ < 0) fd_ = fd;
+          else         Close(fd);
+        }
+        received += static_cast<size_t>(read);
+      }
+      return true;
+    }
+
+    int CreateMemfd(const char* buf_, size_t size_)
+    {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+      const int fd = memfd_create("ecal_uds", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+      if (fd < 0) return -1;
+
+      if (ftruncate(fd, static_cast<off_t>(size_)) != 0)
+      {
+        Close(fd);
+        return -1;
+      }
+
+      void* addr = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      if (addr == MAP_FAILED)
+      {
+        Close(fd);
+        return -1;
+      }
+      std::memcpy(addr, buf_, size_);
+      (void)munmap(addr, size_);
+
+      // the readers map the file, it must not change under their feet
+      (void)fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL);
+      return fd;
+#else
+      (void)buf_;
+      (void)size_;
+      return -1;
+#endif
+    }
+  }
+}
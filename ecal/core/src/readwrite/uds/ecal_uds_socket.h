@@ -0,0 +1,77 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  unix domain socket helper (stream sockets, file descriptor passing)
+**/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace eCAL
+{
+  namespace UDS
+  {
+    // socket path of a writer, a leading '@' marks the linux abstract namespace
+    std::string CreateSocketPath(const std::string& socket_directory_, int32_t process_id_, uint64_t topic_id_);
+
+    // create a listening / connected stream socket, -1 on error
+    int  Listen(const std::string& path_);
+    int  Connect(const std::string& path_);
+
+    // accept a pending connection of a listening socket, -1 on error
+    int  Accept(int listen_socket_);
+
+    // connected pair of non blocking sockets (e.g. to wake up a thread waiting in Poll)
+    bool CreateSocketPair(int& first_socket_, int& second_socket_);
+
+    struct SPollSocket
+    {
+      int  socket        = -1;
+      bool wait_writable = false;  // wait for writability in addition to readability
+      bool readable      = false;
+      bool writable      = false;
+      bool closed        = false;  // hung up by the peer or socket error
+    };
+
+    // wait until one of the sockets is ready (or the timeout expired)
+    void Poll(std::vector<SPollSocket>& sockets_, int timeout_ms_);
+
+    // read and discard all bytes that are available without blocking
+    void Drain(int socket_);
+
+    void Close(int socket_);
+    void Shutdown(int socket_);
+    void RemovePath(const std::string& path_);
+
+    // send header and payload without blocking, fd_ (if >= 0) is attached to the first byte,
+    // sent_ returns the number of bytes written until the socket buffer was full, false on a broken connection
+    bool Send(int socket_, const char* header_, size_t header_size_, const char* payload_, size_t payload_size_, int fd_, size_t& sent_);
+
+    // receive exactly size_ bytes, an attached file descriptor is returned in fd_ (-1 if none)
+    bool Receive(int socket_, char* buf_, size_t size_, int& fd_);
+
+    // create a sealed memfd holding a copy of buf_ (linux only, -1 if not supported or on error)
+    int  CreateMemfd(const char* buf_, size_t size_);
+  }
+}
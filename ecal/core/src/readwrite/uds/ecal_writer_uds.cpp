@@ -0,0 +1,257 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  unix domain socket data writer
+**/
+
+#include "ecal_writer_uds.h"
+#include "ecal_uds_frame.h"
+#include "ecal_uds_socket.h"
+
+#include <ecal/log.h>
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+  constexpr int accept_poll_timeout_ms = 200;
+}
+
+namespace eCAL
+{
+  CDataWriterUDS::CDataWriterUDS(const eCAL::eCALWriter::UDS::SAttributes& attr_) :
+    m_attributes(attr_),
+    m_path(UDS::CreateSocketPath(attr_.socket_directory, attr_.process_id, attr_.topic_id))
+  {
+    m_listen_socket = UDS::Listen(m_path);
+    if ((m_listen_socket < 0) || !UDS::CreateSocketPair(m_wakeup_send_socket, m_wakeup_receive_socket))
+    {
+      Logging::Log(Logging::log_level_error, "CDataWriterUDS: Could not listen on socket " + m_path + " for topic " + m_attributes.topic_name);
+      UDS::Close(m_listen_socket);
+      m_listen_socket = -1;
+      return;
+    }
+
+    m_accept_thread = std::thread(&CDataWriterUDS::AcceptConnections, this);
+  }
+
+  CDataWriterUDS::~CDataWriterUDS()
+  {
+    m_stop = true;
+    if (m_accept_thread.joinable()) m_accept_thread.join();
+
+    if (m_listen_socket >= 0)
+    {
+      UDS::Close(m_listen_socket);
+      UDS::RemovePath(m_path);
+    }
+    UDS::Close(m_wakeup_send_socket);
+    UDS::Close(m_wakeup_receive_socket);
+
+    const std::lock_guard<std::mutex> lock(m_connections_mtx);
+    for (const auto& connection : m_connections)
+    {
+      UDS::Close(connection.socket);
+    }
+    m_connections.clear();
+  }
+
+  SWriterInfo CDataWriterUDS::GetInfo()
+  {
+    SWriterInfo info_;
+
+    info_.name           = "uds";
+    info_.description    = "unix domain socket data writer";
+
+    info_.has_mode_local = true;
+    info_.has_mode_cloud = false;
+
+    info_.send_size_max  = -1;
+
+    return info_;
+  }
+
+  bool CDataWriterUDS::Write(const void* buf_, const SWriterAttr& attr_)
+  {
+    const std::lock_guard<std::mutex> lock(m_connections_mtx);
+    if (m_connections.empty()) return false;
+
+    UDS::SFrameHeader header;
+    header.id           = attr_.id;
+    header.clock        = attr_.clock;
+    header.time         = attr_.time;
+    header.hash         = static_cast<int64_t>(attr_.hash);
+    header.payload_size = attr_.len;
+
+    // large payloads are passed as memfd, one copy for all readers
+    int memfd(-1);
+    if ((m_attributes.memfd_min_size > 0) && (attr_.len >= m_attributes.memfd_min_size))
+    {
+      memfd = UDS::CreateMemfd(static_cast<const char*>(buf_), attr_.len);
+      if (memfd >= 0) header.flags |= UDS::frame_flag_memfd;
+    }
+
+    std::array<char, UDS::frame_header_size> header_buffer{};
+    UDS::SerializeFrameHeader(header, header_buffer.data());
+
+    const char*  payload      = (memfd >= 0) ? nullptr : static_cast<const char*>(buf_);
+    const size_t payload_size = (memfd >= 0) ? 0       : attr_.len;
+
+    bool sent(false);
+    for (auto iter = m_connections.begin(); iter != m_connections.end();)
+    {
+      bool connection_sent(false);
+      if (SendFrame(*iter, header_buffer.data(), payload, payload_size, memfd, connection_sent))
+      {
+        sent |= connection_sent;
+        ++iter;
+      }
+      else
+      {
+        // the reader is gone
+        UDS::Close(iter->socket);
+        iter = m_connections.erase(iter);
+      }
+    }
+
+    // every reader owns its own duplicate of the descriptor now
+    UDS::Close(memfd);
+
+    return sent;
+  }
+
+  Registration::LayerParUds CDataWriterUDS::GetConnectionParameter()
+  {
+    Registration::LayerParUds connection_par;
+    if (m_listen_socket >= 0) connection_par.path = m_path;
+    return connection_par;
+  }
+
+  bool CDataWriterUDS::SendFrame(SConnection& connection_, const char* header_, const char* payload_, size_t payload_size_, int memfd_, bool& sent_)
+  {
+    sent_ = false;
+
+    // the stream must stay in sync, a reader still stalled on its previous frame misses this one
+    if (!FlushPendingFrame(connection_)) return false;
+    if (!connection_.pending_frame.empty()) return true;
+
+    size_t sent(0);
+    if (!UDS::Send(connection_.socket, header_, UDS::frame_header_size, payload_, payload_size_, memfd_, sent)) return false;
+    if (sent == 0) return true;
+    sent_ = true;
+
+    // keep the rest of the frame, the accept thread completes it as soon as the reader catches up
+    const size_t frame_size = UDS::frame_header_size + payload_size_;
+    if (sent < frame_size)
+    {
+      connection_.pending_frame.clear();
+      connection_.pending_frame.reserve(frame_size - sent);
+      if (sent < UDS::frame_header_size)
+      {
+        connection_.pending_frame.insert(connection_.pending_frame.end(), header_ + sent, header_ + UDS::frame_header_size);
+        connection_.pending_frame.insert(connection_.pending_frame.end(), payload_, payload_ + payload_size_);
+      }
+      else
+      {
+        connection_.pending_frame.insert(connection_.pending_frame.end(), payload_ + (sent - UDS::frame_header_size), payload_ + payload_size_);
+      }
+      connection_.pending_offset = 0;
+      WakeUpAcceptThread();
+    }
+    return true;
+  }
+
+  bool CDataWriterUDS::FlushPendingFrame(SConnection& connection_)
+  {
+    if (connection_.pending_frame.empty()) return true;
+
+    size_t sent(0);
+    const char*  pending_data = connection_.pending_frame.data() + connection_.pending_offset;
+    const size_t pending_size = connection_.pending_frame.size() - connection_.pending_offset;
+    if (!UDS::Send(connection_.socket, pending_data, pending_size, nullptr, 0, -1, sent)) return false;
+
+    connection_.pending_offset += sent;
+    if (connection_.pending_offset == connection_.pending_frame.size())
+    {
+      connection_.pending_frame.clear();
+      connection_.pending_offset = 0;
+    }
+    return true;
+  }
+
+  void CDataWriterUDS::WakeUpAcceptThread()
+  {
+    const char wakeup(0);
+    size_t     sent(0);
+    (void)UDS::Send(m_wakeup_send_socket, &wakeup, sizeof(wakeup), nullptr, 0, -1, sent);
+  }
+
+  void CDataWriterUDS::AcceptConnections()
+  {
+    std::vector<UDS::SPollSocket> poll_sockets;
+    while (!m_stop)
+    {
+      // wait for new readers, for closed readers and for readers that can take the rest of a pending frame
+      poll_sockets.resize(2);
+      poll_sockets[0] = UDS::SPollSocket();
+      poll_sockets[0].socket = m_listen_socket;
+      poll_sockets[1] = UDS::SPollSocket();
+      poll_sockets[1].socket = m_wakeup_receive_socket;
+      {
+        const std::lock_guard<std::mutex> lock(m_connections_mtx);
+        for (const auto& connection : m_connections)
+        {
+          UDS::SPollSocket poll_socket;
+          poll_socket.socket        = connection.socket;
+          poll_socket.wait_writable = !connection.pending_frame.empty();
+          poll_sockets.push_back(poll_socket);
+        }
+      }
+
+      UDS::Poll(poll_sockets, accept_poll_timeout_ms);
+      if (poll_sockets[1].readable) UDS::Drain(m_wakeup_receive_socket);
+
+      const std::lock_guard<std::mutex> lock(m_connections_mtx);
+      for (size_t i = 2; i < poll_sockets.size(); ++i)
+      {
+        const UDS::SPollSocket& poll_socket = poll_sockets[i];
+        auto iter = std::find_if(m_connections.begin(), m_connections.end(), [&poll_socket](const SConnection& connection_) { return connection_.socket == poll_socket.socket; });
+        if (iter == m_connections.end()) continue;
+
+        // readers never send, a readable connection was closed by its reader
+        bool keep = !poll_socket.closed && !poll_socket.readable;
+        if (keep && poll_socket.writable) keep = FlushPendingFrame(*iter);
+        if (!keep)
+        {
+          UDS::Close(iter->socket);
+          m_connections.erase(iter);
+        }
+      }
+
+      if (poll_sockets[0].readable)
+      {
+        SConnection connection;
+        connection.socket = UDS::Accept(m_listen_socket);
+        if (connection.socket >= 0) m_connections.push_back(std::move(connection));
+      }
+    }
+  }
+}
@@ -0,0 +1,87 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief  unix domain socket data writer
+ *
+ * The writer listens on a stream socket (linux abstract namespace or socket file) and
+ * streams every sample as frame header + payload to all connected readers. On linux
+ * large payloads are copied once into a sealed memfd that is passed as file descriptor,
+ * the readers map it instead of streaming the payload through the socket.
+ *
+ * Sends never block: a reader whose socket buffer is full misses the sample, the rest of
+ * a partially sent frame is kept per connection and completed before its next frame.
+**/
+
+#pragma once
+
+#include "config/attributes/data_writer_uds_attributes.h"
+
+#include "readwrite/ecal_writer_base.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  class CDataWriterUDS : public CDataWriterBase<Registration::LayerParUds>
+  {
+  public:
+    CDataWriterUDS(const eCAL::eCALWriter::UDS::SAttributes& attr_);
+    ~CDataWriterUDS() override;
+
+    CDataWriterUDS(const CDataWriterUDS&) = delete;
+    CDataWriterUDS& operator=(const CDataWriterUDS&) = delete;
+
+    SWriterInfo GetInfo() override;
+
+    bool Write(const void* buf_, const SWriterAttr& attr_) override;
+
+    Registration::LayerParUds GetConnectionParameter() override;
+
+  private:
+    struct SConnection
+    {
+      int               socket = -1;
+      std::vector<char> pending_frame;       // rest of a partially sent frame
+      size_t            pending_offset = 0;
+    };
+
+    bool SendFrame(SConnection& connection_, const char* header_, const char* payload_, size_t payload_size_, int memfd_, bool& sent_);
+    bool FlushPendingFrame(SConnection& connection_);
+    void WakeUpAcceptThread();
+    void AcceptConnections();
+
+    eCAL::eCALWriter::UDS::SAttributes m_attributes;
+
+    std::string                        m_path;
+    int                                m_listen_socket = -1;
+    int                                m_wakeup_send_socket    = -1;
+    int                                m_wakeup_receive_socket = -1;
+
+    std::atomic<bool>                  m_stop{ false };
+    std::thread                        m_accept_thread;
+
+    std::mutex                         m_connections_mtx;
+    std::vector<SConnection>           m_connections;
+  };
+}
@@ -148,8 +148,108 @@ namespace{
     writer_.add_enum(+eCAL::pb::TransportLayer::optional_enum_type, static_cast<int>(source_sample_.type));
     writer_.add_int32(+eCAL::pb::TransportLayer::optional_int32_version, source_sample_.version);
     writer_.add_bool(+eCAL::pb::TransportLayer::optional_bool_active, source_sample_.active);
+    if (source_sample_.type == eCAL::Monitoring::eTransportLayerType::udp_mc)
+    {
+      Writer parameter_writer{ writer_, +eCAL::pb::TransportLayer::optional_message_par_layer };
+      Writer udp_writer{ parameter_writer, +eCAL::pb::ConnectionPar::optional_message_layer_par_udpmc };
+      udp_writer.add_int64(+eCAL::pb::LayerParUdpMC::optional_int64_pacing_rate, source_sample_.pacing_rate);
+      udp_writer.add_int64(+eCAL::pb::LayerParUdpMC::optional_int64_pacing_delayed_datagrams, source_sample_.pacing_delayed_datagrams);
+      udp_writer.add_int64(+eCAL::pb::LayerParUdpMC::optional_int64_pacing_delay_us, source_sample_.pacing_delay_us);
+    }
+    if (source_sample_.type == eCAL::Monitoring::eTransportLayerType::tcp)
+    {
+      Writer parameter_writer{ writer_, +eCAL::pb::TransportLayer::optional_message_par_layer };
+      Writer tcp_writer{ parameter_writer, +eCAL::pb::ConnectionPar::optional_message_layer_par_tcp };
+      tcp_writer.add_int32(+eCAL::pb::LayerParTcp::optional_int32_connection_count, source_sample_.connection_count);
+    }
+    for (const auto& statistics : source_sample_.statistics)
+    {
+      Writer statistics_writer{ writer_, +eCAL::pb::TransportLayer::repeated_message_statistics };
+      statistics_writer.add_int32(+eCAL::pb::LayerStatistics::optional_int32_size_class, statistics.size_class);
+      statistics_writer.add_int64(+eCAL::pb::LayerStatistics::optional_int64_samples, statistics.samples);
+      statistics_writer.add_double(+eCAL::pb::LayerStatistics::optional_double_cost_us, statistics.cost_us);
+      statistics_writer.add_bool(+eCAL::pb::LayerStatistics::optional_bool_selected, statistics.selected);
+    }
   } 
 
+  void DeserializeLayerStatistics(protozero::pbf_reader& reader_, eCAL::Monitoring::SLayerStatistics& target_sample_)
+  {
+    while (reader_.next())
+    {
+      switch (reader_.tag())
+      {
+      case +eCAL::pb::LayerStatistics::optional_int32_size_class:
+        target_sample_.size_class = reader_.get_int32();
+        break;
+      case +eCAL::pb::LayerStatistics::optional_int64_samples:
+        target_sample_.samples = reader_.get_int64();
+        break;
+      case +eCAL::pb::LayerStatistics::optional_double_cost_us:
+        target_sample_.cost_us = reader_.get_double();
+        break;
+      case +eCAL::pb::LayerStatistics::optional_bool_selected:
+        target_sample_.selected = reader_.get_bool();
+        break;
+      default:
+        reader_.skip();
+      }
+    }
+  }
+
+  void DeserializeTransportLayerParUdp(protozero::pbf_reader& reader_, eCAL::Monitoring::STransportLayer& target_sample_)
+  {
+    while (reader_.next())
+    {
+      switch (reader_.tag())
+      {
+      case +eCAL::pb::LayerParUdpMC::optional_int64_pacing_rate:
+        target_sample_.pacing_rate = reader_.get_int64();
+        break;
+      case +eCAL::pb::LayerParUdpMC::optional_int64_pacing_delayed_datagrams:
+        target_sample_.pacing_delayed_datagrams = reader_.get_int64();
+        break;
+      case +eCAL::pb::LayerParUdpMC::optional_int64_pacing_delay_us:
+        target_sample_.pacing_delay_us = reader_.get_int64();
+        break;
+      default:
+        reader_.skip();
+      }
+    }
+  }
+
+  void DeserializeTransportLayerParTcp(protozero::pbf_reader& reader_, eCAL::Monitoring::STransportLayer& target_sample_)
+  {
+    while (reader_.next())
+    {
+      switch (reader_.tag())
+      {
+      case +eCAL::pb::LayerParTcp::optional_int32_connection_count:
+        target_sample_.connection_count = reader_.get_int32();
+        break;
+      default:
+        reader_.skip();
+      }
+    }
+  }
+
+  void DeserializeTransportLayerPar(protozero::pbf_reader& reader_, eCAL::Monitoring::STransportLayer& target_sample_)
+  {
+    while (reader_.next())
+    {
+      switch (reader_.tag())
+      {
+      case +eCAL::pb::ConnectionPar::optional_message_layer_par_udpmc:
+        AssignMessage(reader_, target_sample_, DeserializeTransportLayerParUdp);
+        break;
+      case +eCAL::pb::ConnectionPar::optional_message_layer_par_tcp:
+        AssignMessage(reader_, target_sample_, DeserializeTransportLayerParTcp);
+        break;
+      default:
+        reader_.skip();
+      }
+    }
+  }
+
   void DeserializeTransportLayer(protozero::pbf_reader& reader_, eCAL::Monitoring::STransportLayer& target_sample_)
   {
     while (reader_.next())
@@ -165,6 +265,12 @@ namespace{
       case +eCAL::pb::TransportLayer::optional_bool_active:
         target_sample_.active = reader_.get_bool();
         break;
+      case +eCAL::pb::TransportLayer::optional_message_par_layer:
+        AssignMessage(reader_, target_sample_, DeserializeTransportLayerPar);
+        break;
+      case +eCAL::pb::TransportLayer::repeated_message_statistics:
+        AddRepeatedMessage(reader_, target_sample_.statistics, DeserializeLayerStatistics);
+        break;
       default:
         reader_.skip();
       }
@@ -244,6 +350,11 @@ namespace{
       Writer latency_writer{ writer_, +eCAL::pb::Topic::optional_message_data_latency_us };
       SerializeStatistics(latency_writer, source_sample_.data_latency_us);
     }
+    writer_.add_int32(+eCAL::pb::Topic::optional_int32_receive_queue_depth, source_sample_.receive_queue_depth);
+    writer_.add_int32(+eCAL::pb::Topic::optional_int32_receive_queue_size, source_sample_.receive_queue_size);
+    writer_.add_int32(+eCAL::pb::Topic::optional_int32_receive_queue_high_water_mark, source_sample_.receive_queue_high_water_mark);
+    writer_.add_int32(+eCAL::pb::Topic::optional_int32_receive_queue_drops, source_sample_.receive_queue_drops);
+    writer_.add_int32(+eCAL::pb::Topic::optional_int32_max_frequency, source_sample_.max_frequency);
   }
 
   void DeserializeTopic(protozero::pbf_reader& reader_, eCAL::Monitoring::STopic& target_sample_)
@@ -309,6 +420,21 @@ namespace{
       case +eCAL::pb::Topic::optional_message_data_latency_us:
         AssignMessage(reader_, target_sample_.data_latency_us, DeserializeStatistics);
         break;
+      case +eCAL::pb::Topic::optional_int32_receive_queue_depth:
+        target_sample_.receive_queue_depth = reader_.get_int32();
+        break;
+      case +eCAL::pb::Topic::optional_int32_receive_queue_size:
+        target_sample_.receive_queue_size = reader_.get_int32();
+        break;
+      case +eCAL::pb::Topic::optional_int32_receive_queue_high_water_mark:
+        target_sample_.receive_queue_high_water_mark = reader_.get_int32();
+        break;
+      case +eCAL::pb::Topic::optional_int32_receive_queue_drops:
+        target_sample_.receive_queue_drops = reader_.get_int32();
+        break;
+      case +eCAL::pb::Topic::optional_int32_max_frequency:
+        target_sample_.max_frequency = reader_.get_int32();
+        break;
       default:
         reader_.skip();
       }
@@ -26,9 +26,14 @@
 #include "ecal_serialize_common.h"
 #include "ecal_struct_sample_payload.h"
 
+#include <charconv>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <ecal/core/pb/ecal.pbftags.h>
@@ -37,6 +42,7 @@
 #include <protozero/pbf_writer.hpp>
 #include <protozero/buffer_vector.hpp>
 #include <protozero/pbf_reader.hpp>
+#include <protozero/varint.hpp>
 #include <protozero/ecal_helper.h>
 
 namespace
@@ -90,6 +96,63 @@ namespace
     writer.add_bytes(+eCAL::pb::Sample::optional_bytes_padding, sample.padding.data(), sample.padding.size());
   }
 
+  size_t GetPayloadSize(const ::eCAL::Payload::Payload& payload)
+  {
+    switch (payload.type)
+    {
+    case eCAL::Payload::pl_raw:
+      return (payload.raw_addr != nullptr) ? payload.raw_size : 0;
+    case eCAL::Payload::pl_vec:
+      return payload.vec.size();
+    default:
+      return 0;
+    }
+  }
+
+  void AddLengthDelimitedKey(std::vector<char>& buffer, ::protozero::pbf_tag_type tag, size_t length)
+  {
+    const uint32_t key = (static_cast<uint32_t>(tag) << 3U) | static_cast<uint32_t>(::protozero::pbf_wire_type::length_delimited);
+    ::protozero::write_varint(std::back_inserter(buffer), key);
+    ::protozero::write_varint(std::back_inserter(buffer), length);
+  }
+
+  void SerializePayloadSampleHeader(std::vector<char>& buffer, const ::eCAL::Payload::Sample& sample)
+  {
+    {
+      ::protozero::basic_pbf_writer<std::vector<char>> writer{ buffer };
+      writer.add_enum(+eCAL::pb::Sample::optional_enum_cmd_type, sample.cmd_type);
+      {
+        ::protozero::basic_pbf_writer<std::vector<char>> topic_writer{ writer, +eCAL::pb::Sample::optional_message_topic };
+        topic_writer.add_string(+eCAL::pb::Topic::optional_string_topic_name, sample.topic_info.topic_name);
+        topic_writer.add_string(+eCAL::pb::Topic::optional_string_topic_id, std::to_string(sample.topic_info.topic_id));
+        topic_writer.add_int32(+eCAL::pb::Topic::optional_int32_process_id, sample.topic_info.process_id);
+        topic_writer.add_string(+eCAL::pb::Topic::optional_string_host_name, sample.topic_info.host_name);
+      }
+      writer.add_bytes(+eCAL::pb::Sample::optional_bytes_padding, sample.padding.data(), sample.padding.size());
+    }
+
+    // the content message embeds the payload, so its length has to be known before writing its fields
+    // the payload field is written last (protobuf field order is irrelevant for the reader)
+    static thread_local std::vector<char> content_fields;
+    content_fields.clear();
+    {
+      ::protozero::basic_pbf_writer<std::vector<char>> content_writer{ content_fields };
+      content_writer.add_int64(+eCAL::pb::Content::optional_int64_id,    sample.content.id);
+      content_writer.add_int64(+eCAL::pb::Content::optional_int64_clock, sample.content.clock);
+      content_writer.add_int64(+eCAL::pb::Content::optional_int64_time,  sample.content.time);
+      content_writer.add_int32(+eCAL::pb::Content::optional_int32_size,  sample.content.size);
+      content_writer.add_int64(+eCAL::pb::Content::optional_int64_hash,  sample.content.hash);
+    }
+    const size_t payload_size = GetPayloadSize(sample.content.payload);
+    if (payload_size > 0)
+    {
+      AddLengthDelimitedKey(content_fields, +eCAL::pb::Content::optional_bytes_payload, payload_size);
+    }
+
+    AddLengthDelimitedKey(buffer, +eCAL::pb::Sample::optional_message_content, content_fields.size() + payload_size);
+    buffer.insert(buffer.end(), content_fields.begin(), content_fields.end());
+  }
+
   void DeserializeTopicInfo(protozero::pbf_reader& reader, ::eCAL::Payload::TopicInfo& topic_info)
   {
     while (reader.next())
@@ -153,6 +216,99 @@ namespace
     }
   }
 
+  std::string_view GetStringView(::protozero::pbf_reader& reader)
+  {
+    const ::protozero::data_view view = reader.get_view();
+    return std::string_view(view.data(), view.size());
+  }
+
+  void DeserializeTopicInfoView(::protozero::pbf_reader& reader, ::eCAL::Payload::TopicInfoView& topic_info)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::Topic::optional_string_topic_name:
+        topic_info.topic_name = GetStringView(reader);
+        break;
+      case +eCAL::pb::Topic::optional_string_topic_id:
+        {
+          const std::string_view topic_id_string = GetStringView(reader);
+          const auto result = std::from_chars(topic_id_string.data(), topic_id_string.data() + topic_id_string.size(), topic_info.topic_id);
+          if (result.ec != std::errc()) throw std::invalid_argument("invalid topic id");
+        }
+        break;
+      case +eCAL::pb::Topic::optional_int32_process_id:
+        topic_info.process_id = reader.get_int32();
+        break;
+      case +eCAL::pb::Topic::optional_string_host_name:
+        topic_info.host_name = GetStringView(reader);
+        break;
+      default:
+        reader.skip();
+        break;
+      }
+    }
+  }
+
+  void DeserializeContentView(::protozero::pbf_reader& reader, ::eCAL::Payload::ContentView& content)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::Content::optional_int64_id:
+        content.id = reader.get_int64();
+        break;
+      case +eCAL::pb::Content::optional_int64_clock:
+        content.clock = reader.get_int64();
+        break;
+      case +eCAL::pb::Content::optional_int64_time:
+        content.time = reader.get_int64();
+        break;
+      case +eCAL::pb::Content::optional_int32_size:
+        content.size = reader.get_int32();
+        break;
+      case +eCAL::pb::Content::optional_bytes_payload:
+        {
+          const ::protozero::data_view payload = reader.get_view();
+          content.payload_addr = payload.data();
+          content.payload_size = payload.size();
+        }
+        break;
+      case +eCAL::pb::Content::optional_int64_hash:
+        content.hash = reader.get_int64();
+        break;
+      default:
+        reader.skip();
+        break;
+      }
+    }
+  }
+
+  void DeserializePayloadSampleView(::protozero::pbf_reader& reader, ::eCAL::Payload::SampleView& sample)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::Sample::optional_enum_cmd_type:
+        sample.cmd_type = static_cast<eCAL::eCmdType>(reader.get_enum());
+        break;
+      case +eCAL::pb::Sample::optional_message_topic:
+        AssignMessage(reader, sample.topic_info, DeserializeTopicInfoView);
+        break;
+      case +eCAL::pb::Sample::optional_message_content:
+        AssignMessage(reader, sample.content, DeserializeContentView);
+        break;
+      default:
+        // padding is only needed for the payload alignment on sender side
+        reader.skip();
+        break;
+      }
+    }
+  }
+
   void DeserializePayloadSample(::protozero::pbf_reader& reader, ::eCAL::Payload::Sample& sample)
   {
     while (reader.next())
@@ -199,6 +355,13 @@ namespace eCAL
       return true;
     }
   
+    bool SerializeHeaderToBuffer(const Payload::Sample& source_sample_, std::vector<char>& target_buffer_)
+    {
+      target_buffer_.clear();
+      SerializePayloadSampleHeader(target_buffer_, source_sample_);
+      return true;
+    }
+
     bool DeserializeFromBuffer(const char* data_, size_t size_, Payload::Sample& target_sample_)
     {
       try
@@ -215,5 +378,21 @@ namespace eCAL
         return false;
       }
     }
+
+    bool DeserializeFromBuffer(const char* data_, size_t size_, Payload::SampleView& target_sample_)
+    {
+      try
+      {
+        target_sample_ = Payload::SampleView();
+        ::protozero::pbf_reader message{ data_, size_ };
+        DeserializePayloadSampleView(message, target_sample_);
+        return true;
+      }
+      catch (const std::exception& exception)
+      {
+        LogDeserializationException(exception, "eCAL::Payload::SampleView");
+        return false;
+      }
+    }
   }
 }
@@ -39,5 +39,12 @@ namespace eCAL
     bool SerializeToBuffer     (const Payload::Sample& source_sample_, std::vector<char>& target_buffer_);
     bool SerializeToBuffer     (const Payload::Sample& source_sample_, std::string& target_buffer_);
     bool DeserializeFromBuffer (const char* data_, size_t size_, Payload::Sample& target_sample_);   
+
+    // payload sample - deserialize into a view on data_ (no allocations, the view is valid as long as data_ is)
+    bool DeserializeFromBuffer (const char* data_, size_t size_, Payload::SampleView& target_sample_);
+
+    // payload sample header - serialize everything except the payload bytes
+    // the buffer ends with the payload field tag and length, so [header][payload] is a complete sample
+    bool SerializeHeaderToBuffer(const Payload::Sample& source_sample_, std::vector<char>& target_buffer_);
   }
 }
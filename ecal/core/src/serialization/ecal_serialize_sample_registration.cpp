@@ -47,11 +47,55 @@ namespace
 {
 
   //using namespace eCAL::protozero;
+  template <typename Writer>
+  void SerializeParamUDP(Writer& writer, const eCAL::Registration::LayerParUdpMC& layer)
+  {
+    writer.add_int64(+eCAL::pb::LayerParUdpMC::optional_int64_pacing_rate, layer.pacing_rate);
+    writer.add_int64(+eCAL::pb::LayerParUdpMC::optional_int64_pacing_delayed_datagrams, layer.pacing_delayed_datagrams);
+    writer.add_int64(+eCAL::pb::LayerParUdpMC::optional_int64_pacing_delay_us, layer.pacing_delay_us);
+    writer.add_bool(+eCAL::pb::LayerParUdpMC::optional_bool_sample_batch, layer.sample_batch);
+    writer.add_bool(+eCAL::pb::LayerParUdpMC::optional_bool_fec_fragments, layer.fec_fragments);
+    writer.add_uint64(+eCAL::pb::LayerParUdpMC::optional_uint64_nack_id, layer.nack_id);
+  }
+
+  void DeserializeParamUDP(::protozero::pbf_reader& reader, eCAL::Registration::LayerParUdpMC& layer)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::LayerParUdpMC::optional_int64_pacing_rate:
+        layer.pacing_rate = reader.get_int64();
+        break;
+      case +eCAL::pb::LayerParUdpMC::optional_int64_pacing_delayed_datagrams:
+        layer.pacing_delayed_datagrams = reader.get_int64();
+        break;
+      case +eCAL::pb::LayerParUdpMC::optional_int64_pacing_delay_us:
+        layer.pacing_delay_us = reader.get_int64();
+        break;
+      case +eCAL::pb::LayerParUdpMC::optional_bool_sample_batch:
+        layer.sample_batch = reader.get_bool();
+        break;
+      case +eCAL::pb::LayerParUdpMC::optional_bool_fec_fragments:
+        layer.fec_fragments = reader.get_bool();
+        break;
+      case +eCAL::pb::LayerParUdpMC::optional_uint64_nack_id:
+        layer.nack_id = reader.get_uint64();
+        break;
+      default:
+        reader.skip();
+        break;
+      }
+    }
+  }
+
   template <typename Writer>
   void SerializeParamTCP(Writer& writer, const eCAL::Registration::LayerParTcp& layer)
   {
     // Serialize TCP-specific parameters
     writer.add_int32(+eCAL::pb::LayerParTcp::optional_int32_port, layer.port);
+    writer.add_int32(+eCAL::pb::LayerParTcp::optional_int32_frame_version, layer.frame_version);
+    writer.add_int32(+eCAL::pb::LayerParTcp::optional_int32_connection_count, layer.connection_count);
   }
 
   void DeserializeParamTCP(::protozero::pbf_reader& reader, eCAL::Registration::LayerParTcp& layer)
@@ -63,6 +107,34 @@ namespace
       case +eCAL::pb::LayerParTcp::optional_int32_port:
         layer.port = reader.get_int32();
         break;
+      case +eCAL::pb::LayerParTcp::optional_int32_frame_version:
+        layer.frame_version = reader.get_int32();
+        break;
+      case +eCAL::pb::LayerParTcp::optional_int32_connection_count:
+        layer.connection_count = reader.get_int32();
+        break;
+      default:
+        reader.skip();
+        break;
+      }
+    }
+  }
+
+  template <typename Writer>
+  void SerializeParamUDS(Writer& writer, const eCAL::Registration::LayerParUds& layer)
+  {
+    writer.add_string(+eCAL::pb::LayerParUds::optional_string_path, layer.path);
+  }
+
+  void DeserializeParamUDS(::protozero::pbf_reader& reader, eCAL::Registration::LayerParUds& layer)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::LayerParUds::optional_string_path:
+        AssignString(reader, layer.path);
+        break;
       default:
         reader.skip();
         break;
@@ -77,6 +149,7 @@ namespace
     {
       writer.add_string(+eCAL::pb::LayerParShm::repeated_string_memory_file_list, memory_file);
     }
+    writer.add_bool(+eCAL::pb::LayerParShm::optional_bool_sample_batch, layer.sample_batch);
   }
 
   void DeserializeParamSHM(::protozero::pbf_reader& reader, eCAL::Registration::LayerParShm& layer)
@@ -91,6 +164,9 @@ namespace
           AssignString(reader, memory_file_string);
         }
         break;
+      case +eCAL::pb::LayerParShm::optional_bool_sample_batch:
+        layer.sample_batch = reader.get_bool();
+        break;
       default:
         reader.skip();
         break;
@@ -105,8 +181,7 @@ namespace
       switch (reader.tag())
       {
       case +eCAL::pb::ConnectionPar::optional_message_layer_par_udpmc:
-        // we cannot do anything as the message is empty
-        reader.skip();
+        AssignMessage(reader, connection_par.layer_par_udpmc, DeserializeParamUDP);
         break;
       case +eCAL::pb::ConnectionPar::optional_message_layer_par_tcp:
         AssignMessage(reader, connection_par.layer_par_tcp, DeserializeParamTCP);
@@ -114,6 +189,9 @@ namespace
       case +eCAL::pb::ConnectionPar::optional_message_layer_par_shm:
         AssignMessage(reader, connection_par.layer_par_shm, DeserializeParamSHM);
         break;
+      case +eCAL::pb::ConnectionPar::optional_message_layer_par_uds:
+        AssignMessage(reader, connection_par.layer_par_uds, DeserializeParamUDS);
+        break;
       default:
         reader.skip();
         break;
@@ -121,6 +199,48 @@ namespace
     }
   } // namespace
 
+  template <typename Writer>
+  void SerializeLayerStatistics(Writer& writer, const eCAL::Registration::LayerStatistics& statistics)
+  {
+    writer.add_uint64(+eCAL::pb::LayerStatistics::optional_uint64_publisher_id, statistics.publisher_id);
+    writer.add_int32(+eCAL::pb::LayerStatistics::optional_int32_size_class, statistics.size_class);
+    writer.add_int64(+eCAL::pb::LayerStatistics::optional_int64_samples, statistics.samples);
+    writer.add_int64(+eCAL::pb::LayerStatistics::optional_int64_latency_us_sum, statistics.latency_us_sum);
+    writer.add_double(+eCAL::pb::LayerStatistics::optional_double_cost_us, statistics.cost_us);
+    writer.add_bool(+eCAL::pb::LayerStatistics::optional_bool_selected, statistics.selected);
+  }
+
+  void DeserializeLayerStatistics(::protozero::pbf_reader& reader, eCAL::Registration::LayerStatistics& statistics)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::LayerStatistics::optional_uint64_publisher_id:
+        statistics.publisher_id = reader.get_uint64();
+        break;
+      case +eCAL::pb::LayerStatistics::optional_int32_size_class:
+        statistics.size_class = reader.get_int32();
+        break;
+      case +eCAL::pb::LayerStatistics::optional_int64_samples:
+        statistics.samples = reader.get_int64();
+        break;
+      case +eCAL::pb::LayerStatistics::optional_int64_latency_us_sum:
+        statistics.latency_us_sum = reader.get_int64();
+        break;
+      case +eCAL::pb::LayerStatistics::optional_double_cost_us:
+        statistics.cost_us = reader.get_double();
+        break;
+      case +eCAL::pb::LayerStatistics::optional_bool_selected:
+        statistics.selected = reader.get_bool();
+        break;
+      default:
+        reader.skip();
+        break;
+      }
+    }
+  }
+
   template <typename Writer>
   void SerializeTransportLayer(Writer& writer, const eCAL::Registration::TLayer& layer)
   {
@@ -128,6 +248,8 @@ namespace
       && static_cast<int>(eCAL::eTLayerType::tl_ecal_shm) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_ecal_shm)
       && static_cast<int>(eCAL::eTLayerType::tl_ecal_udp) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_ecal_udp_mc)
       && static_cast<int>(eCAL::eTLayerType::tl_ecal_tcp) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_ecal_tcp)
+      && static_cast<int>(eCAL::eTLayerType::tl_ecal_uds) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_ecal_uds)
+      && static_cast<int>(eCAL::eTLayerType::tl_ecal_inproc) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_ecal_inproc)
       && static_cast<int>(eCAL::eTLayerType::tl_all) == static_cast<int>(eCAL::pb::eTransportLayerType::tl_all)
       , "Enum values of eCAL::Registration::TLayer and eCAL::pb::TransportLayer do not match!");
 
@@ -147,20 +269,34 @@ namespace
       }
       break;
       case eCAL::eTLayerType::tl_ecal_udp:
-        // UDP has no Layer parameters, we do not serialize anything here
-        break;
+      {
+        Writer udp_writer{ parameter_writer, +eCAL::pb::ConnectionPar::optional_message_layer_par_udpmc };
+        SerializeParamUDP(udp_writer, layer.par_layer.layer_par_udpmc);
+      }
+      break;
       case eCAL::eTLayerType::tl_ecal_tcp:
       {
         Writer tcp_writer{ parameter_writer, +eCAL::pb::ConnectionPar::optional_message_layer_par_tcp };
         SerializeParamTCP(tcp_writer, layer.par_layer.layer_par_tcp);
       }
       break;
+      case eCAL::eTLayerType::tl_ecal_uds:
+      {
+        Writer uds_writer{ parameter_writer, +eCAL::pb::ConnectionPar::optional_message_layer_par_uds };
+        SerializeParamUDS(uds_writer, layer.par_layer.layer_par_uds);
+      }
+      break;
       case eCAL::eTLayerType::tl_none:
       case eCAL::eTLayerType::tl_all:
       default:
         break;
       }
     }
+    for (const auto& statistics : layer.statistics)
+    {
+      Writer statistics_writer{ writer, +eCAL::pb::TransportLayer::repeated_message_statistics };
+      SerializeLayerStatistics(statistics_writer, statistics);
+    }
   }
 
   void DeserializeTransportLayer(::protozero::pbf_reader& reader, eCAL::Registration::TLayer& layer)
@@ -186,6 +322,9 @@ namespace
         AssignMessage(reader, layer.par_layer, DeserializeConnectionPar);
       }
       break;
+      case +eCAL::pb::TransportLayer::repeated_message_statistics:
+        AddRepeatedMessage(reader, layer.statistics, DeserializeLayerStatistics);
+        break;
       default:
         reader.skip();
         break;
@@ -235,6 +374,32 @@ namespace
     }
   }
 
+  template <typename Writer>
+  void SerializeContentIdRange(Writer& writer, const eCAL::Registration::ContentIdRange& content_id_range)
+  {
+    writer.add_int64(+eCAL::pb::ContentIdRange::optional_int64_min_id, content_id_range.min_id);
+    writer.add_int64(+eCAL::pb::ContentIdRange::optional_int64_max_id, content_id_range.max_id);
+  }
+
+  void DeserializeContentIdRange(::protozero::pbf_reader& reader, eCAL::Registration::ContentIdRange& content_id_range)
+  {
+    while (reader.next())
+    {
+      switch (reader.tag())
+      {
+      case +eCAL::pb::ContentIdRange::optional_int64_min_id:
+        content_id_range.min_id = reader.get_int64();
+        break;
+      case +eCAL::pb::ContentIdRange::optional_int64_max_id:
+        content_id_range.max_id = reader.get_int64();
+        break;
+      default:
+        reader.skip();
+        break;
+      }
+    }
+  }
+
   template <typename Writer>
   void SerializeTopicSample(Writer& writer, const eCAL::Registration::Sample& sample)
   {
@@ -285,6 +450,17 @@ namespace
         Writer latency_writer{ topic_writer, +eCAL::pb::Topic::optional_message_data_latency_us };
         SerializeTopicStatistics(latency_writer, sample.topic.latency_us);
       }
+      topic_writer.add_int32(+eCAL::pb::Topic::optional_int32_receive_queue_depth, sample.topic.receive_queue_depth);
+      topic_writer.add_int32(+eCAL::pb::Topic::optional_int32_receive_queue_size, sample.topic.receive_queue_size);
+      topic_writer.add_int32(+eCAL::pb::Topic::optional_int32_receive_queue_high_water_mark, sample.topic.receive_queue_high_water_mark);
+      topic_writer.add_int32(+eCAL::pb::Topic::optional_int32_receive_queue_drops, sample.topic.receive_queue_drops);
+      for (const auto& content_id_range : sample.topic.content_id_filter)
+      {
+        Writer range_writer{ topic_writer, +eCAL::pb::Topic::repeated_message_content_id_filter };
+        SerializeContentIdRange(range_writer, content_id_range);
+      }
+      topic_writer.add_int32(+eCAL::pb::Topic::optional_int32_max_frequency, sample.topic.max_frequency);
+      topic_writer.add_bool(+eCAL::pb::Topic::optional_bool_history_replay, sample.topic.history_replay);
     }
   }
 
@@ -357,6 +533,27 @@ namespace
       case +eCAL::pb::Topic::optional_message_data_latency_us:
         AssignMessage(reader, sample.topic.latency_us, DeserializeTopicStatistics);
         break;
+      case +eCAL::pb::Topic::optional_int32_receive_queue_depth:
+        sample.topic.receive_queue_depth = reader.get_int32();
+        break;
+      case +eCAL::pb::Topic::optional_int32_receive_queue_size:
+        sample.topic.receive_queue_size = reader.get_int32();
+        break;
+      case +eCAL::pb::Topic::optional_int32_receive_queue_high_water_mark:
+        sample.topic.receive_queue_high_water_mark = reader.get_int32();
+        break;
+      case +eCAL::pb::Topic::optional_int32_receive_queue_drops:
+        sample.topic.receive_queue_drops = reader.get_int32();
+        break;
+      case +eCAL::pb::Topic::repeated_message_content_id_filter:
+        AddRepeatedMessage(reader, sample.topic.content_id_filter, DeserializeContentIdRange);
+        break;
+      case +eCAL::pb::Topic::optional_int32_max_frequency:
+        sample.topic.max_frequency = reader.get_int32();
+        break;
+      case +eCAL::pb::Topic::optional_bool_history_replay:
+        sample.topic.history_replay = reader.get_bool();
+        break;
       default:
         reader.skip();
       }
@@ -48,6 +48,8 @@ namespace eCAL
     tl_ecal_udp = 1,
     tl_ecal_shm = 4,
     tl_ecal_tcp = 5,
+    tl_ecal_uds = 6,
+    tl_ecal_inproc = 42,
     tl_all      = 255,
   };
 }
@@ -30,6 +30,7 @@
 #include <cstdint>
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace eCAL
@@ -80,5 +81,35 @@ namespace eCAL
       Content                             content;                      // topic content
       std::vector<char>                   padding;                      // padding to artificially increase the size of the message. This is a workaround for TCP topics, to get the actual user-payload 8-byte-aligned. REMOVE ME IN ECAL6
     };
+
+    // Payload sample views
+    //
+    // All members refer to the serialized sample buffer, they are only valid
+    // as long as this buffer is alive. Deserializing into a view does not allocate.
+    struct TopicInfoView
+    {
+      std::string_view                    host_name;                        // host name
+      uint64_t                            topic_id   = 0;                   // topic id
+      std::string_view                    topic_name;                       // topic name
+      int32_t                             process_id = 0;                   // process id
+    };
+
+    struct ContentView
+    {
+      int64_t                             id           = 0;                 // payload id
+      int64_t                             clock        = 0;                 // internal used clock
+      int64_t                             time         = 0;                 // time the content was updated
+      int64_t                             hash         = 0;                 // unique hash for that payload
+      int32_t                             size         = 0;                 // size (additional for none payload "header only samples")
+      const char*                         payload_addr = nullptr;           // payload inside the serialized sample
+      size_t                              payload_size = 0;                 //   and its size
+    };
+
+    struct SampleView
+    {
+      eCmdType                            cmd_type = bct_none;              // payload command type
+      TopicInfoView                       topic_info;                       // topic information
+      ContentView                         content;                          // topic content
+    };
   }
 }
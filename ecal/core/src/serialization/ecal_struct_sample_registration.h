@@ -106,27 +106,66 @@ namespace eCAL
     // Transport layer parameters for ecal udp multicast
     struct LayerParUdpMC
     {
-      bool operator==(const LayerParUdpMC& /*other*/) const {
-        // Assuming there are no member variables to compare
-        return true;
+      int64_t                             pacing_rate = 0;              // send rate limit in bytes per second (0 = unlimited)
+      int64_t                             pacing_delayed_datagrams = 0; // number of datagrams delayed by the send rate pacing
+      int64_t                             pacing_delay_us = 0;          // accumulated send rate pacing delay in microseconds
+      bool                                sample_batch = false;         // reader accepts sample batches in a datagram
+      bool                                fec_fragments = false;        // reader reassembles fec fragments (paced writers fragment large samples)
+      uint64_t                            nack_id = 0;                  // id sent with the nacks of the readers process (reliable writers ignore unknown ids)
+
+      bool operator==(const LayerParUdpMC& other) const {
+        return pacing_rate == other.pacing_rate &&
+          pacing_delayed_datagrams == other.pacing_delayed_datagrams &&
+          pacing_delay_us == other.pacing_delay_us &&
+          sample_batch == other.sample_batch &&
+          fec_fragments == other.fec_fragments &&
+          nack_id == other.nack_id;
       }
 
       void clear()
-      {}
+      {
+        pacing_rate = 0;
+        pacing_delayed_datagrams = 0;
+        pacing_delay_us = 0;
+        sample_batch = false;
+        fec_fragments = false;
+        nack_id = 0;
+      }
     };
 
     // Transport layer parameters for ecal tcp
     struct LayerParTcp
     {
       int32_t                             port = 0;                     // tcp writers port number
+      int32_t                             frame_version = 0;            // highest tcp frame version a reader supports (0 = v1 only)
+      int32_t                             connection_count = 0;         // number of connected subscriber sessions of the writer
 
+      // connection_count is a statistic, a changed count is no new connection parameter
       bool operator==(const LayerParTcp& other) const {
-        return port == other.port;
+        return port == other.port &&
+          frame_version == other.frame_version;
       }
 
       void clear()
       {
         port = 0;
+        frame_version = 0;
+        connection_count = 0;
+      }
+    };
+
+    // Transport layer parameters for ecal unix domain socket
+    struct LayerParUds
+    {
+      std::string                         path;                         // unix domain socket path of the writer ('@' prefix = abstract namespace)
+
+      bool operator==(const LayerParUds& other) const {
+        return path == other.path;
+      }
+
+      void clear()
+      {
+        path.clear();
       }
     };
 
@@ -134,14 +173,17 @@ namespace eCAL
     struct LayerParShm
     {
       Util::CExpandingVector<std::string> memory_file_list;             // list of memory file names
+      bool                                sample_batch = false;         // reader accepts sample batches in a memory file
 
       bool operator==(const LayerParShm& other) const {
-        return memory_file_list == other.memory_file_list;
+        return memory_file_list == other.memory_file_list &&
+          sample_batch == other.sample_batch;
       }
 
       void clear()
       {
         memory_file_list.clear();
+        sample_batch = false;
       }
     };
 
@@ -151,11 +193,13 @@ namespace eCAL
       LayerParUdpMC                       layer_par_udpmc;              // parameter for ecal udp multicast
       LayerParTcp                         layer_par_tcp;                // parameter for ecal tcp
       LayerParShm                         layer_par_shm;                // parameter for ecal shm
+      LayerParUds                         layer_par_uds;                // parameter for ecal unix domain socket
 
       bool operator==(const ConnectionPar& other) const {
         return layer_par_udpmc == other.layer_par_udpmc &&
           layer_par_tcp == other.layer_par_tcp &&
-          layer_par_shm == other.layer_par_shm;
+          layer_par_shm == other.layer_par_shm &&
+          layer_par_uds == other.layer_par_uds;
       }
 
       void clear()
@@ -163,6 +207,37 @@ namespace eCAL
         layer_par_udpmc.clear();
         layer_par_tcp.clear();
         layer_par_shm.clear();
+        layer_par_uds.clear();
+      }
+    };
+
+    // Adaptive layer selection statistics of one payload size class
+    struct LayerStatistics
+    {
+      uint64_t                            publisher_id = 0;             // reader: entity id of the publication the statistics belong to
+      int32_t                             size_class = 0;               // payload size class (0 = below 2 kB, n = below 2^(n+1) kB)
+      int64_t                             samples = 0;                  // reader: received samples, writer: sent samples
+      int64_t                             latency_us_sum = 0;           // reader: accumulated delivery latency in microseconds
+      double                              cost_us = 0.0;                // writer: estimated delivery cost per sample in microseconds
+      bool                                selected = false;             // writer: layer is currently selected for this size class
+
+      bool operator==(const LayerStatistics& other) const {
+        return publisher_id == other.publisher_id &&
+          size_class == other.size_class &&
+          samples == other.samples &&
+          latency_us_sum == other.latency_us_sum &&
+          cost_us == other.cost_us &&
+          selected == other.selected;
+      }
+
+      void clear()
+      {
+        publisher_id = 0;
+        size_class = 0;
+        samples = 0;
+        latency_us_sum = 0;
+        cost_us = 0.0;
+        selected = false;
       }
     };
 
@@ -174,13 +249,15 @@ namespace eCAL
       bool                                enabled = false;              // transport layer enabled ?
       bool                                active = false;               // transport layer in use ?
       ConnectionPar                       par_layer;                    // transport layer parameter
+      Util::CExpandingVector<LayerStatistics> statistics;               // adaptive layer selection statistics
 
       bool operator==(const TLayer& other) const {
         return type == other.type &&
           version == other.version &&
           enabled == other.enabled &&
           active == other.active &&
-          par_layer == other.par_layer;
+          par_layer == other.par_layer &&
+          statistics == other.statistics;
       }
 
       void clear()
@@ -190,6 +267,7 @@ namespace eCAL
         enabled = false;
         active = false;
         par_layer.clear();
+        statistics.clear();
       }
     };
 
@@ -271,6 +349,24 @@ namespace eCAL
       }
     };
 
+    // Range of content ids a subscriber wants to receive (publisher side content filter)
+    struct ContentIdRange
+    {
+      int64_t                             min_id = 0;                   // first content id of the range
+      int64_t                             max_id = 0;                   // last content id of the range (inclusive)
+
+      bool operator==(const ContentIdRange& other) const {
+        return min_id == other.min_id &&
+          max_id == other.max_id;
+      }
+
+      void clear()
+      {
+        min_id = 0;
+        max_id = 0;
+      }
+    };
+
     // eCAL topic information
     struct Topic
     {
@@ -294,6 +390,15 @@ namespace eCAL
       int32_t                             data_frequency  = 0;                   // data frequency (send / receive registrations per second) [mHz]
       Statistics                          latency_us;                   // latency statistics for receiving data in microseconds
 
+      int32_t                             receive_queue_depth = 0;           // subscriber receive queue depth (0 = no receive queue)
+      int32_t                             receive_queue_size = 0;            // samples currently waiting in the receive queue
+      int32_t                             receive_queue_high_water_mark = 0; // maximum number of samples waiting in the receive queue
+      int32_t                             receive_queue_drops = 0;           // samples dropped because of a full receive queue
+
+      Util::CExpandingVector<ContentIdRange> content_id_filter;         // subscriber content filter, content ids the subscriber wants to receive (empty = all)
+      int32_t                             max_frequency = 0;            // subscriber rate limit, maximum number of samples per second the subscriber wants to receive [mHz] (0 = unlimited)
+      bool                                history_replay = false;       // subscriber wants the publisher sample history replayed on connect
+
       bool operator==(const Topic& other) const {
         return registration_clock == other.registration_clock &&
           shm_transport_domain == other.shm_transport_domain &&
@@ -310,7 +415,14 @@ namespace eCAL
           data_id == other.data_id &&
           data_clock == other.data_clock &&
           data_frequency == other.data_frequency &&
-          latency_us == other.latency_us;
+          latency_us == other.latency_us &&
+          receive_queue_depth == other.receive_queue_depth &&
+          receive_queue_size == other.receive_queue_size &&
+          receive_queue_high_water_mark == other.receive_queue_high_water_mark &&
+          receive_queue_drops == other.receive_queue_drops &&
+          content_id_filter == other.content_id_filter &&
+          max_frequency == other.max_frequency &&
+          history_replay == other.history_replay;
       }
 
       void clear()
@@ -335,6 +447,15 @@ namespace eCAL
         data_frequency = 0;
 
         latency_us.clear();
+
+        receive_queue_depth = 0;
+        receive_queue_size = 0;
+        receive_queue_high_water_mark = 0;
+        receive_queue_drops = 0;
+
+        content_id_filter.clear();
+        max_frequency = 0;
+        history_replay = false;
       }
     };
 
@@ -8,6 +8,12 @@
 
 namespace eCAL { namespace pb { 
 enum class LayerParUdpMC : ::protozero::pbf_tag_type {
+    optional_int64_pacing_rate = 1,
+    optional_int64_pacing_delayed_datagrams = 2,
+    optional_int64_pacing_delay_us = 3,
+    optional_bool_sample_batch = 4,
+    optional_bool_fec_fragments = 5,
+    optional_uint64_nack_id = 6
 };
 
 inline constexpr uint32_t operator+(LayerParUdpMC e) {
@@ -15,7 +21,8 @@ inline constexpr uint32_t operator+(LayerParUdpMC e) {
 }
 
 enum class LayerParShm : ::protozero::pbf_tag_type {
-    repeated_string_memory_file_list = 1
+    repeated_string_memory_file_list = 1,
+    optional_bool_sample_batch = 2
 };
 
 inline constexpr uint32_t operator+(LayerParShm e) {
@@ -23,29 +30,54 @@ inline constexpr uint32_t operator+(LayerParShm e) {
 }
 
 enum class LayerParTcp : ::protozero::pbf_tag_type {
-    optional_int32_port = 1
+    optional_int32_port = 1,
+    optional_int32_frame_version = 2,
+    optional_int32_connection_count = 4
 };
 
 inline constexpr uint32_t operator+(LayerParTcp e) {
     return static_cast<uint32_t>(e);
 }
 
+enum class LayerParUds : ::protozero::pbf_tag_type {
+    optional_string_path = 1
+};
+
+inline constexpr uint32_t operator+(LayerParUds e) {
+    return static_cast<uint32_t>(e);
+}
+
 enum class ConnectionPar : ::protozero::pbf_tag_type {
     optional_message_layer_par_udpmc = 1,
     optional_message_layer_par_shm = 2,
-    optional_message_layer_par_tcp = 4
+    optional_message_layer_par_tcp = 4,
+    optional_message_layer_par_uds = 5
 };
 
 inline constexpr uint32_t operator+(ConnectionPar e) {
     return static_cast<uint32_t>(e);
 }
 
+enum class LayerStatistics : ::protozero::pbf_tag_type {
+    optional_uint64_publisher_id = 1,
+    optional_int32_size_class = 2,
+    optional_int64_samples = 3,
+    optional_int64_latency_us_sum = 4,
+    optional_double_cost_us = 5,
+    optional_bool_selected = 6
+};
+
+inline constexpr uint32_t operator+(LayerStatistics e) {
+    return static_cast<uint32_t>(e);
+}
+
 enum class TransportLayer : ::protozero::pbf_tag_type {
     optional_enum_type = 1,
     optional_int32_version = 2,
     optional_bool_enabled = 6,
     optional_bool_active = 3,
-    optional_message_par_layer = 5
+    optional_message_par_layer = 5,
+    repeated_message_statistics = 7
 };
 
 inline constexpr uint32_t operator+(TransportLayer e) {
@@ -57,6 +89,8 @@ enum class eTransportLayerType : std::int32_t {
     tl_ecal_udp_mc = 1,
     tl_ecal_shm = 4,
     tl_ecal_tcp = 5,
+    tl_ecal_uds = 6,
+    tl_ecal_inproc = 42,
     tl_all = 255
 };
 
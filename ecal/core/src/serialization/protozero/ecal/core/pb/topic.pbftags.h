@@ -20,6 +20,15 @@ inline constexpr uint32_t operator+(Statistics e) {
     return static_cast<uint32_t>(e);
 }
 
+enum class ContentIdRange : ::protozero::pbf_tag_type {
+    optional_int64_min_id = 1,
+    optional_int64_max_id = 2
+};
+
+inline constexpr uint32_t operator+(ContentIdRange e) {
+    return static_cast<uint32_t>(e);
+}
+
 enum class Topic : ::protozero::pbf_tag_type {
     optional_int32_registration_clock = 1,
     optional_string_host_name = 2,
@@ -39,7 +48,14 @@ enum class Topic : ::protozero::pbf_tag_type {
     optional_int64_data_id = 19,
     optional_int64_data_clock = 20,
     optional_int32_data_frequency = 21,
-    optional_message_data_latency_us = 31
+    optional_message_data_latency_us = 31,
+    optional_int32_receive_queue_depth = 32,
+    optional_int32_receive_queue_size = 33,
+    optional_int32_receive_queue_high_water_mark = 34,
+    optional_int32_receive_queue_drops = 35,
+    repeated_message_content_id_filter = 36,
+    optional_int32_max_frequency = 37,
+    optional_bool_history_replay = 38
 };
 
 inline constexpr uint32_t operator+(Topic e) {
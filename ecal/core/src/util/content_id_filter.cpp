@@ -0,0 +1,84 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "content_id_filter.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace eCAL
+{
+  CContentIdFilter::CContentIdFilter(std::vector<RangeT> ranges_) :
+    m_ranges(std::move(ranges_))
+  {
+    Normalize();
+  }
+
+  bool CContentIdFilter::Accepts(int64_t content_id_) const
+  {
+    if (m_ranges.empty()) return true;
+
+    // the last range starting at or before the content id
+    auto iter = std::upper_bound(m_ranges.begin(), m_ranges.end(), content_id_,
+      [](int64_t content_id, const RangeT& range) { return content_id < range.first; });
+    if (iter == m_ranges.begin()) return false;
+    --iter;
+    return content_id_ <= iter->second;
+  }
+
+  void CContentIdFilter::Merge(const CContentIdFilter& other_)
+  {
+    // one of the filters accepts everything, so does the merged one
+    if (AcceptsAll()) return;
+    if (other_.AcceptsAll())
+    {
+      m_ranges.clear();
+      return;
+    }
+
+    m_ranges.insert(m_ranges.end(), other_.m_ranges.begin(), other_.m_ranges.end());
+    Normalize();
+  }
+
+  void CContentIdFilter::Normalize()
+  {
+    for (auto& range : m_ranges)
+    {
+      if (range.first > range.second) std::swap(range.first, range.second);
+    }
+    std::sort(m_ranges.begin(), m_ranges.end());
+
+    // merge overlapping and adjacent ranges
+    std::vector<RangeT> merged;
+    merged.reserve(m_ranges.size());
+    for (const auto& range : m_ranges)
+    {
+      if (!merged.empty()
+        && ((merged.back().second == std::numeric_limits<int64_t>::max()) || (range.first <= merged.back().second + 1)))
+      {
+        merged.back().second = std::max(merged.back().second, range.second);
+      }
+      else
+      {
+        merged.push_back(range);
+      }
+    }
+    m_ranges.swap(merged);
+  }
+}
@@ -0,0 +1,63 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace eCAL
+{
+  /// \brief Content ids a subscriber wants to receive (publisher side content filter).
+  ///
+  /// The filter is a set of inclusive content id ranges, an empty filter accepts every
+  /// content id. The ranges are kept sorted and merged, so a content id is checked with
+  /// a binary search.
+  ///
+  /// Not thread-safe
+  class CContentIdFilter
+  {
+  public:
+    using RangeT = std::pair<int64_t, int64_t>;   ///< first and last content id of a range (inclusive)
+
+    CContentIdFilter() = default;
+    explicit CContentIdFilter(std::vector<RangeT> ranges_);
+
+    /// \brief True if the filter accepts every content id.
+    bool AcceptsAll() const { return m_ranges.empty(); }
+
+    /// \brief True if a sample with the given content id passes the filter.
+    bool Accepts(int64_t content_id_) const;
+
+    /// \brief Extend the filter by the content ids accepted by another filter.
+    void Merge(const CContentIdFilter& other_);
+
+    /// \brief The sorted and merged content id ranges.
+    const std::vector<RangeT>& GetRanges() const { return m_ranges; }
+
+    bool operator==(const CContentIdFilter& other_) const { return m_ranges == other_.m_ranges; }
+    bool operator!=(const CContentIdFilter& other_) const { return m_ranges != other_.m_ranges; }
+
+  private:
+    void Normalize();
+
+    std::vector<RangeT> m_ranges;
+  };
+}
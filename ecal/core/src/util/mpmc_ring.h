@@ -0,0 +1,155 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief This file provides a bounded multi producer / multi consumer ring.
+ *        Any number of threads may push and pop concurrently, both sides are lock free.
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace eCAL
+{
+  // The slots are created once and reused. Producer and consumer work on the slots in place
+  // (e.g. by assigning or swapping buffers), so buffers keep their capacity and a ring in
+  // steady state does not allocate. Every slot carries a sequence number that tells whether
+  // it is free for the push or filled for the pop at a position: a push or pop claims its
+  // position by a compare and swap and publishes the slot with the sequence number afterwards.
+  template <class T>
+  class MpmcRing
+  {
+  public:
+    explicit MpmcRing(size_t capacity_)
+      : m_slots(capacity_ > 0 ? capacity_ : 1)
+    {
+      for (size_t index = 0; index < m_slots.size(); ++index)
+      {
+        m_slots[index].sequence.store(index, std::memory_order_relaxed);
+      }
+    }
+
+    MpmcRing(const MpmcRing&) = delete;
+    MpmcRing& operator=(const MpmcRing&) = delete;
+
+    size_t Capacity() const { return m_slots.size(); }
+
+    // true if the oldest element is not (completely) pushed yet
+    bool Empty() const
+    {
+      const size_t pos = m_head.load(std::memory_order_acquire);
+      return m_slots[pos % m_slots.size()].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    // number of claimed elements, includes elements that are still being pushed or popped
+    size_t Size() const
+    {
+      const size_t h = m_head.load(std::memory_order_acquire);
+      const size_t t = m_tail.load(std::memory_order_acquire);
+      return (t > h) ? (t - h) : 0;
+    }
+
+    // producer: fill_(T&) writes the new element into the free slot, returns false if the ring is full
+    template <class FillT>
+    bool Push(FillT&& fill_)
+    {
+      size_t pos  = m_tail.load(std::memory_order_relaxed);
+      SSlot* slot = nullptr;
+      for (;;)
+      {
+        slot = &m_slots[pos % m_slots.size()];
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == pos)
+        {
+          if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if (sequence < pos)
+        {
+          // the slot still holds the element of the previous round
+          return false;
+        }
+        else
+        {
+          pos = m_tail.load(std::memory_order_relaxed);
+        }
+      }
+
+      fill_(slot->value);
+      slot->sequence.store(pos + 1, std::memory_order_release);
+      return true;
+    }
+
+    // consumer: take_(T&) reads the oldest element, returns false if the ring is empty
+    template <class TakeT>
+    bool Pop(TakeT&& take_)
+    {
+      size_t pos  = m_head.load(std::memory_order_relaxed);
+      SSlot* slot = nullptr;
+      for (;;)
+      {
+        slot = &m_slots[pos % m_slots.size()];
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == pos + 1)
+        {
+          if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        }
+        else if (sequence < pos + 1)
+        {
+          // the element of this position is not pushed (completely) yet
+          return false;
+        }
+        else
+        {
+          pos = m_head.load(std::memory_order_relaxed);
+        }
+      }
+
+      take_(slot->value);
+      slot->sequence.store(pos + m_slots.size(), std::memory_order_release);
+      return true;
+    }
+
+    // consumer: take_(T&) reads up to max_count_ elements in order (concurrent consumers may
+    // take elements in between), returns the number of taken elements
+    template <class TakeT>
+    size_t PopBatch(TakeT&& take_, size_t max_count_)
+    {
+      size_t count(0);
+      while ((count < max_count_) && Pop(take_))
+      {
+        count++;
+      }
+      return count;
+    }
+
+  private:
+    struct SSlot
+    {
+      std::atomic<size_t> sequence{ 0 };
+      T                   value{};
+    };
+
+    std::vector<SSlot>              m_slots;
+    alignas(64) std::atomic<size_t> m_head{ 0 };   // position of the next pop
+    alignas(64) std::atomic<size_t> m_tail{ 0 };   // position of the next push
+  };
+}
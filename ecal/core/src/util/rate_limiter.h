@@ -0,0 +1,74 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+/**
+ * @brief This file provides a class to limit the rate of samples.
+ *        This class is NOT threadsafe!
+**/
+
+#pragma once
+
+#include <chrono>
+
+namespace eCAL
+{
+  // Lets samples pass with a maximum frequency. The due times follow a fixed schedule, so a sample
+  // passing late does not delay the following ones. The tolerance lets samples pass up to the given
+  // fraction of a period early (receiving side of samples that were already limited by the sender).
+  template <class T>
+  class RateLimiter
+  {
+  public:
+    using time_point = std::chrono::time_point<T>;
+    using duration   = typename T::duration;
+
+    explicit RateLimiter(double max_frequency_hz_ = 0.0, double tolerance_ = 0.0)
+      : max_frequency_hz(max_frequency_hz_ > 0.0 ? max_frequency_hz_ : 0.0)
+    {
+      if (max_frequency_hz > 0.0)
+      {
+        period = std::chrono::duration_cast<duration>(std::chrono::duration<double>(1.0 / max_frequency_hz));
+        early  = std::chrono::duration_cast<duration>(std::chrono::duration<double>(tolerance_ / max_frequency_hz));
+      }
+    }
+
+    bool IsLimited() const { return max_frequency_hz > 0.0; }
+    double GetMaxFrequency() const { return max_frequency_hz; }
+
+    bool Pass(const time_point& now_)
+    {
+      if (!IsLimited()) return true;
+      if (started && (now_ + early < next_due)) return false;
+
+      next_due = started ? next_due + period : now_ + period;
+      started  = true;
+
+      // resynchronize after a pause, the missed due times must not pass in a burst
+      if (next_due <= now_) next_due = now_ + period;
+      return true;
+    }
+
+  private:
+    double     max_frequency_hz;
+    duration   period{ 0 };
+    duration   early{ 0 };
+    bool       started = false;
+    time_point next_due;
+  };
+}
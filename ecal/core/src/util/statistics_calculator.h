@@ -44,6 +44,29 @@ namespace eCAL
       statistics_.variance += delta * delta2;
     }
 
+    // adds the statistics of an independent set of values (pairwise update by Chan et al.),
+    // the latest value is taken from the added statistics
+    void Merge(const Registration::Statistics& other)
+    {
+      if (other.count == 0) return;
+      if (statistics_.count == 0)
+      {
+        statistics_ = other;
+        return;
+      }
+
+      const double count       = static_cast<double>(statistics_.count);
+      const double other_count = static_cast<double>(other.count);
+      const double delta       = other.mean - statistics_.mean;
+
+      statistics_.mean     += delta * other_count / (count + other_count);
+      statistics_.variance += other.variance + delta * delta * count * other_count / (count + other_count);
+      statistics_.count    += other.count;
+      statistics_.latest    = other.latest;
+      statistics_.min       = std::min(statistics_.min, other.min);
+      statistics_.max       = std::max(statistics_.max, other.max);
+    }
+
     Registration::Statistics GetStatistics() const
     {
       return statistics_;
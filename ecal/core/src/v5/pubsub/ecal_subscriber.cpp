@@ -172,6 +172,9 @@ namespace eCAL
         global_context.udp_layer = globals->udp_reader_layer();
         global_context.shm_layer = globals->shm_reader_layer();
         global_context.tcp_layer = globals->tcp_reader_layer();
+#if ECAL_CORE_TRANSPORT_UDS
+        global_context.uds_layer = globals->uds_reader_layer();
+#endif
         global_context.registration_provider = globals->registration_provider();
       }
 
@@ -242,6 +245,12 @@ namespace eCAL
       return(m_subscriber_impl->Read(buf_, time_, rcv_timeout_));
     }
 
+    size_t CSubscriber::ReceiveBuffers(std::vector<std::string>& bufs_, std::vector<long long>* times_ /* = nullptr */, int rcv_timeout_ /* = 0 */) const
+    {
+      if (m_subscriber_impl == nullptr) return(0);
+      return(m_subscriber_impl->ReadBatch(bufs_, times_, rcv_timeout_));
+    }
+
     bool CSubscriber::AddReceiveCallback(ReceiveCallbackT callback_)
     {
       auto v6_callback = [callback_](const STopicId& topic_id_, const SDataTypeInformation&, const eCAL::SReceiveCallbackData& v6_callback_data)
@@ -34,3 +34,5 @@ option(ECAL_CORE_REGISTRATION_SHM                        "Enables the eCAL regis
 option(ECAL_CORE_TRANSPORT_UDP                           "Enables the eCAL to transport payload via UDP multicast"                                               ON)
 option(ECAL_CORE_TRANSPORT_TCP                           "Enables the eCAL to transport payload via TCP"                                                         ON)
 option(ECAL_CORE_TRANSPORT_SHM                           "Enables the eCAL to transport payload via local shared memory"                                         ON)
+option(ECAL_CORE_TRANSPORT_INPROC                        "Enables the eCAL to transport payload directly between publishers and subscribers of one process"      ON)
+option(ECAL_CORE_TRANSPORT_UDS                           "Enables the eCAL to transport payload via local unix domain sockets (POSIX only)"                      ON)
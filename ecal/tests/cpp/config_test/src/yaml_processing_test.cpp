@@ -59,8 +59,11 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.transport_layer.udp.send_buffer = 6242880;
     config.transport_layer.udp.receive_buffer = 6242881;
     config.transport_layer.udp.max_datagram_size = 60000;
+    config.transport_layer.udp.max_sample_size = 1000000;
     config.transport_layer.udp.join_all_interfaces = true;
     config.transport_layer.udp.npcap_enabled = true;
+    config.transport_layer.udp.pacing_rate_bytes_per_second = 100000000;
+    config.transport_layer.udp.pacing_burst_bytes = 500000;
     config.transport_layer.udp.local.group = "129.255.255.254";
     config.transport_layer.udp.local.ttl = 7;
     config.transport_layer.udp.network.group = "238.1.2.3";
@@ -68,6 +71,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.transport_layer.tcp.number_executor_reader = 9;
     config.transport_layer.tcp.number_executor_writer = 10;
     config.transport_layer.tcp.max_reconnections = 11;
+    config.transport_layer.uds.socket_directory = "/var/run/ecal";
+    config.transport_layer.uds.max_sample_size = 2000000;
 
     config.publisher.layer.shm.enable = false;
     config.publisher.layer.shm.zero_copy_mode = true;
@@ -76,14 +81,42 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     config.publisher.layer.shm.memfile_min_size_bytes = 8192;
     config.publisher.layer.shm.memfile_reserve_percent = 14;
     config.publisher.layer.udp.enable = false;
+    config.publisher.layer.udp.fec_enable = true;
+    config.publisher.layer.udp.fec_block_size = 32;
+    config.publisher.layer.udp.fec_parity_count = 4;
+    config.publisher.layer.udp.reliable_enable = true;
+    config.publisher.layer.udp.reliable_window_size = 8;
+    config.publisher.layer.udp.pacing_rate_bytes_per_second = 10000000;
+    config.publisher.layer.udp.pacing_burst_bytes = 20000;
+    config.publisher.layer.udp.coalescing_max_delay_us = 250;
+    config.publisher.layer.udp.coalescing_max_size_bytes = 1200;
     config.publisher.layer.tcp.enable = false;
-    config.publisher.layer_priority_local = {eCAL::TransportLayer::eType::tcp, eCAL::TransportLayer::eType::shm, eCAL::TransportLayer::eType::udp_mc};
+    config.publisher.layer.tcp.coalescing_max_delay_us = 500;
+    config.publisher.layer.tcp.coalescing_max_size_bytes = 32768;
+    config.publisher.layer.inproc.enable = true;
+    config.publisher.layer.uds.enable = true;
+    config.publisher.layer.uds.memfd_min_size_bytes = 4096;
+    config.publisher.layer_priority_local = {eCAL::TransportLayer::eType::tcp, eCAL::TransportLayer::eType::uds, eCAL::TransportLayer::eType::shm, eCAL::TransportLayer::eType::udp_mc};
     config.publisher.layer_priority_remote = {eCAL::TransportLayer::eType::tcp, eCAL::TransportLayer::eType::udp_mc};
+    config.publisher.adaptive_layer_selection.enable = true;
+    config.publisher.adaptive_layer_selection.hysteresis_percent = 35;
+    config.publisher.adaptive_layer_selection.probe_interval = 50;
+    config.publisher.adaptive_layer_selection.min_samples = 5;
+    config.publisher.concurrent_send = true;
+    config.publisher.history_depth = 3;
 
     config.subscriber.layer.shm.enable = false;
     config.subscriber.layer.udp.enable = false;
     config.subscriber.layer.tcp.enable = true;
+    config.subscriber.layer.inproc.enable = true;
+    config.subscriber.layer.uds.enable = true;
     config.subscriber.drop_out_of_order_messages = false;
+    config.subscriber.max_frequency_hz = 2.5;
+    config.subscriber.receive_history = false;
+    config.subscriber.read_buffer_depth = 16;
+    config.subscriber.receive_queue.depth = 64;
+    config.subscriber.receive_queue.overflow_policy = eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::block;
+    config.subscriber.receive_queue.executor = eCAL::Subscriber::ReceiveQueue::eExecutor::shared_pool;
 
     config.timesync.timesync_module_replay = "my_replay";
     config.timesync.timesync_module_rt = "my_rt";
@@ -124,8 +157,11 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.transport_layer.udp.send_buffer, config_from_yaml.transport_layer.udp.send_buffer);
     EXPECT_EQ(config.transport_layer.udp.receive_buffer, config_from_yaml.transport_layer.udp.receive_buffer);
     EXPECT_EQ(config.transport_layer.udp.max_datagram_size, config_from_yaml.transport_layer.udp.max_datagram_size);
+    EXPECT_EQ(config.transport_layer.udp.max_sample_size, config_from_yaml.transport_layer.udp.max_sample_size);
     EXPECT_EQ(config.transport_layer.udp.join_all_interfaces, config_from_yaml.transport_layer.udp.join_all_interfaces);
     EXPECT_EQ(config.transport_layer.udp.npcap_enabled, config_from_yaml.transport_layer.udp.npcap_enabled);
+    EXPECT_EQ(config.transport_layer.udp.pacing_rate_bytes_per_second, config_from_yaml.transport_layer.udp.pacing_rate_bytes_per_second);
+    EXPECT_EQ(config.transport_layer.udp.pacing_burst_bytes, config_from_yaml.transport_layer.udp.pacing_burst_bytes);
     EXPECT_EQ(config.transport_layer.udp.local.group, config_from_yaml.transport_layer.udp.local.group);
     EXPECT_EQ(config.transport_layer.udp.local.ttl, config_from_yaml.transport_layer.udp.local.ttl);
     EXPECT_EQ(config.transport_layer.udp.network.group, config_from_yaml.transport_layer.udp.network.group);
@@ -133,6 +169,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.transport_layer.tcp.number_executor_reader, config_from_yaml.transport_layer.tcp.number_executor_reader);
     EXPECT_EQ(config.transport_layer.tcp.number_executor_writer, config_from_yaml.transport_layer.tcp.number_executor_writer);
     EXPECT_EQ(config.transport_layer.tcp.max_reconnections, config_from_yaml.transport_layer.tcp.max_reconnections);
+    EXPECT_EQ(config.transport_layer.uds.socket_directory, config_from_yaml.transport_layer.uds.socket_directory);
+    EXPECT_EQ(config.transport_layer.uds.max_sample_size, config_from_yaml.transport_layer.uds.max_sample_size);
     EXPECT_EQ(config.publisher.layer.shm.enable, config_from_yaml.publisher.layer.shm.enable);
     EXPECT_EQ(config.publisher.layer.shm.zero_copy_mode, config_from_yaml.publisher.layer.shm.zero_copy_mode);
     EXPECT_EQ(config.publisher.layer.shm.acknowledge_timeout_ms, config_from_yaml.publisher.layer.shm.acknowledge_timeout_ms);
@@ -140,13 +178,41 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.publisher.layer.shm.memfile_min_size_bytes, config_from_yaml.publisher.layer.shm.memfile_min_size_bytes);
     EXPECT_EQ(config.publisher.layer.shm.memfile_reserve_percent, config_from_yaml.publisher.layer.shm.memfile_reserve_percent);
     EXPECT_EQ(config.publisher.layer.udp.enable, config_from_yaml.publisher.layer.udp.enable);
+    EXPECT_EQ(config.publisher.layer.udp.fec_enable, config_from_yaml.publisher.layer.udp.fec_enable);
+    EXPECT_EQ(config.publisher.layer.udp.fec_block_size, config_from_yaml.publisher.layer.udp.fec_block_size);
+    EXPECT_EQ(config.publisher.layer.udp.fec_parity_count, config_from_yaml.publisher.layer.udp.fec_parity_count);
+    EXPECT_EQ(config.publisher.layer.udp.reliable_enable, config_from_yaml.publisher.layer.udp.reliable_enable);
+    EXPECT_EQ(config.publisher.layer.udp.reliable_window_size, config_from_yaml.publisher.layer.udp.reliable_window_size);
+    EXPECT_EQ(config.publisher.layer.udp.pacing_rate_bytes_per_second, config_from_yaml.publisher.layer.udp.pacing_rate_bytes_per_second);
+    EXPECT_EQ(config.publisher.layer.udp.pacing_burst_bytes, config_from_yaml.publisher.layer.udp.pacing_burst_bytes);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_max_delay_us, config_from_yaml.publisher.layer.udp.coalescing_max_delay_us);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_max_size_bytes, config_from_yaml.publisher.layer.udp.coalescing_max_size_bytes);
     EXPECT_EQ(config.publisher.layer.tcp.enable, config_from_yaml.publisher.layer.tcp.enable);
+    EXPECT_EQ(config.publisher.layer.inproc.enable, config_from_yaml.publisher.layer.inproc.enable);
+    EXPECT_EQ(config.publisher.layer.uds.enable, config_from_yaml.publisher.layer.uds.enable);
+    EXPECT_EQ(config.publisher.layer.uds.memfd_min_size_bytes, config_from_yaml.publisher.layer.uds.memfd_min_size_bytes);
+    EXPECT_EQ(config.publisher.layer.tcp.coalescing_max_delay_us, config_from_yaml.publisher.layer.tcp.coalescing_max_delay_us);
+    EXPECT_EQ(config.publisher.layer.tcp.coalescing_max_size_bytes, config_from_yaml.publisher.layer.tcp.coalescing_max_size_bytes);
     EXPECT_EQ(config.publisher.layer_priority_local, config_from_yaml.publisher.layer_priority_local);
     EXPECT_EQ(config.publisher.layer_priority_remote, config_from_yaml.publisher.layer_priority_remote);
+    EXPECT_EQ(config.publisher.adaptive_layer_selection.enable, config_from_yaml.publisher.adaptive_layer_selection.enable);
+    EXPECT_EQ(config.publisher.adaptive_layer_selection.hysteresis_percent, config_from_yaml.publisher.adaptive_layer_selection.hysteresis_percent);
+    EXPECT_EQ(config.publisher.adaptive_layer_selection.probe_interval, config_from_yaml.publisher.adaptive_layer_selection.probe_interval);
+    EXPECT_EQ(config.publisher.adaptive_layer_selection.min_samples, config_from_yaml.publisher.adaptive_layer_selection.min_samples);
+    EXPECT_EQ(config.publisher.concurrent_send, config_from_yaml.publisher.concurrent_send);
+    EXPECT_EQ(config.publisher.history_depth, config_from_yaml.publisher.history_depth);
     EXPECT_EQ(config.subscriber.layer.shm.enable, config_from_yaml.subscriber.layer.shm.enable);
     EXPECT_EQ(config.subscriber.layer.udp.enable, config_from_yaml.subscriber.layer.udp.enable);
     EXPECT_EQ(config.subscriber.layer.tcp.enable, config_from_yaml.subscriber.layer.tcp.enable);
+    EXPECT_EQ(config.subscriber.layer.inproc.enable, config_from_yaml.subscriber.layer.inproc.enable);
+    EXPECT_EQ(config.subscriber.layer.uds.enable, config_from_yaml.subscriber.layer.uds.enable);
     EXPECT_EQ(config.subscriber.drop_out_of_order_messages, config_from_yaml.subscriber.drop_out_of_order_messages);
+    EXPECT_EQ(config.subscriber.max_frequency_hz, config_from_yaml.subscriber.max_frequency_hz);
+    EXPECT_EQ(config.subscriber.receive_history, config_from_yaml.subscriber.receive_history);
+    EXPECT_EQ(config.subscriber.read_buffer_depth, config_from_yaml.subscriber.read_buffer_depth);
+    EXPECT_EQ(config.subscriber.receive_queue.depth, config_from_yaml.subscriber.receive_queue.depth);
+    EXPECT_EQ(config.subscriber.receive_queue.overflow_policy, config_from_yaml.subscriber.receive_queue.overflow_policy);
+    EXPECT_EQ(config.subscriber.receive_queue.executor, config_from_yaml.subscriber.receive_queue.executor);
     EXPECT_EQ(config.timesync.timesync_module_replay, config_from_yaml.timesync.timesync_module_replay);
     EXPECT_EQ(config.timesync.timesync_module_rt, config_from_yaml.timesync.timesync_module_rt);
     EXPECT_EQ(config.application.startup.terminal_emulator, config_from_yaml.application.startup.terminal_emulator);
@@ -183,8 +249,11 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.transport_layer.udp.send_buffer, config_from_yaml_config.transport_layer.udp.send_buffer);
     EXPECT_EQ(config.transport_layer.udp.receive_buffer, config_from_yaml_config.transport_layer.udp.receive_buffer);
     EXPECT_EQ(config.transport_layer.udp.max_datagram_size, config_from_yaml_config.transport_layer.udp.max_datagram_size);
+    EXPECT_EQ(config.transport_layer.udp.max_sample_size, config_from_yaml_config.transport_layer.udp.max_sample_size);
     EXPECT_EQ(config.transport_layer.udp.join_all_interfaces, config_from_yaml_config.transport_layer.udp.join_all_interfaces);
     EXPECT_EQ(config.transport_layer.udp.npcap_enabled, config_from_yaml_config.transport_layer.udp.npcap_enabled);
+    EXPECT_EQ(config.transport_layer.udp.pacing_rate_bytes_per_second, config_from_yaml_config.transport_layer.udp.pacing_rate_bytes_per_second);
+    EXPECT_EQ(config.transport_layer.udp.pacing_burst_bytes, config_from_yaml_config.transport_layer.udp.pacing_burst_bytes);
     EXPECT_EQ(config.transport_layer.udp.local.group, config_from_yaml_config.transport_layer.udp.local.group);
     EXPECT_EQ(config.transport_layer.udp.local.ttl, config_from_yaml_config.transport_layer.udp.local.ttl);
     EXPECT_EQ(config.transport_layer.udp.network.group, config_from_yaml_config.transport_layer.udp.network.group);
@@ -192,6 +261,8 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.transport_layer.tcp.number_executor_reader, config_from_yaml_config.transport_layer.tcp.number_executor_reader);
     EXPECT_EQ(config.transport_layer.tcp.number_executor_writer, config_from_yaml_config.transport_layer.tcp.number_executor_writer);
     EXPECT_EQ(config.transport_layer.tcp.max_reconnections, config_from_yaml_config.transport_layer.tcp.max_reconnections);
+    EXPECT_EQ(config.transport_layer.uds.socket_directory, config_from_yaml_config.transport_layer.uds.socket_directory);
+    EXPECT_EQ(config.transport_layer.uds.max_sample_size, config_from_yaml_config.transport_layer.uds.max_sample_size);
     EXPECT_EQ(config.publisher.layer.shm.enable, config_from_yaml_config.publisher.layer.shm.enable);
     EXPECT_EQ(config.publisher.layer.shm.zero_copy_mode, config_from_yaml_config.publisher.layer.shm.zero_copy_mode);
     EXPECT_EQ(config.publisher.layer.shm.acknowledge_timeout_ms, config_from_yaml_config.publisher.layer.shm.acknowledge_timeout_ms);
@@ -199,13 +270,41 @@ TEST(core_cpp_config_yaml /*unused*/, yaml_processing_comparison /*unused*/)
     EXPECT_EQ(config.publisher.layer.shm.memfile_min_size_bytes, config_from_yaml_config.publisher.layer.shm.memfile_min_size_bytes);
     EXPECT_EQ(config.publisher.layer.shm.memfile_reserve_percent, config_from_yaml_config.publisher.layer.shm.memfile_reserve_percent);
     EXPECT_EQ(config.publisher.layer.udp.enable, config_from_yaml_config.publisher.layer.udp.enable);
+    EXPECT_EQ(config.publisher.layer.udp.fec_enable, config_from_yaml_config.publisher.layer.udp.fec_enable);
+    EXPECT_EQ(config.publisher.layer.udp.fec_block_size, config_from_yaml_config.publisher.layer.udp.fec_block_size);
+    EXPECT_EQ(config.publisher.layer.udp.fec_parity_count, config_from_yaml_config.publisher.layer.udp.fec_parity_count);
+    EXPECT_EQ(config.publisher.layer.udp.reliable_enable, config_from_yaml_config.publisher.layer.udp.reliable_enable);
+    EXPECT_EQ(config.publisher.layer.udp.reliable_window_size, config_from_yaml_config.publisher.layer.udp.reliable_window_size);
+    EXPECT_EQ(config.publisher.layer.udp.pacing_rate_bytes_per_second, config_from_yaml_config.publisher.layer.udp.pacing_rate_bytes_per_second);
+    EXPECT_EQ(config.publisher.layer.udp.pacing_burst_bytes, config_from_yaml_config.publisher.layer.udp.pacing_burst_bytes);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_max_delay_us, config_from_yaml_config.publisher.layer.udp.coalescing_max_delay_us);
+    EXPECT_EQ(config.publisher.layer.udp.coalescing_max_size_bytes, config_from_yaml_config.publisher.layer.udp.coalescing_max_size_bytes);
     EXPECT_EQ(config.publisher.layer.tcp.enable, config_from_yaml_config.publisher.layer.tcp.enable);
+    EXPECT_EQ(config.publisher.layer.inproc.enable, config_from_yaml_config.publisher.layer.inproc.enable);
+    EXPECT_EQ(config.publisher.layer.uds.enable, config_from_yaml_config.publisher.layer.uds.enable);
+    EXPECT_EQ(config.publisher.layer.uds.memfd_min_size_bytes, config_from_yaml_config.publisher.layer.uds.memfd_min_size_bytes);
+    EXPECT_EQ(config.publisher.layer.tcp.coalescing_max_delay_us, config_from_yaml_config.publisher.layer.tcp.coalescing_max_delay_us);
+    EXPECT_EQ(config.publisher.layer.tcp.coalescing_max_size_bytes, config_from_yaml_config.publisher.layer.tcp.coalescing_max_size_bytes);
     EXPECT_EQ(config.publisher.layer_priority_local, config_from_yaml_config.publisher.layer_priority_local);
     EXPECT_EQ(config.publisher.layer_priority_remote, config_from_yaml_config.publisher.layer_priority_remote);
+    EXPECT_EQ(config.publisher.adaptive_layer_selection.enable, config_from_yaml_config.publisher.adaptive_layer_selection.enable);
+    EXPECT_EQ(config.publisher.adaptive_layer_selection.hysteresis_percent, config_from_yaml_config.publisher.adaptive_layer_selection.hysteresis_percent);
+    EXPECT_EQ(config.publisher.adaptive_layer_selection.probe_interval, config_from_yaml_config.publisher.adaptive_layer_selection.probe_interval);
+    EXPECT_EQ(config.publisher.adaptive_layer_selection.min_samples, config_from_yaml_config.publisher.adaptive_layer_selection.min_samples);
+    EXPECT_EQ(config.publisher.concurrent_send, config_from_yaml_config.publisher.concurrent_send);
+    EXPECT_EQ(config.publisher.history_depth, config_from_yaml_config.publisher.history_depth);
     EXPECT_EQ(config.subscriber.layer.shm.enable, config_from_yaml_config.subscriber.layer.shm.enable);
     EXPECT_EQ(config.subscriber.layer.udp.enable, config_from_yaml_config.subscriber.layer.udp.enable);
     EXPECT_EQ(config.subscriber.layer.tcp.enable, config_from_yaml_config.subscriber.layer.tcp.enable);
+    EXPECT_EQ(config.subscriber.layer.inproc.enable, config_from_yaml_config.subscriber.layer.inproc.enable);
+    EXPECT_EQ(config.subscriber.layer.uds.enable, config_from_yaml_config.subscriber.layer.uds.enable);
     EXPECT_EQ(config.subscriber.drop_out_of_order_messages, config_from_yaml_config.subscriber.drop_out_of_order_messages);
+    EXPECT_EQ(config.subscriber.max_frequency_hz, config_from_yaml_config.subscriber.max_frequency_hz);
+    EXPECT_EQ(config.subscriber.receive_history, config_from_yaml_config.subscriber.receive_history);
+    EXPECT_EQ(config.subscriber.read_buffer_depth, config_from_yaml_config.subscriber.read_buffer_depth);
+    EXPECT_EQ(config.subscriber.receive_queue.depth, config_from_yaml_config.subscriber.receive_queue.depth);
+    EXPECT_EQ(config.subscriber.receive_queue.overflow_policy, config_from_yaml_config.subscriber.receive_queue.overflow_policy);
+    EXPECT_EQ(config.subscriber.receive_queue.executor, config_from_yaml_config.subscriber.receive_queue.executor);
     EXPECT_EQ(config.timesync.timesync_module_replay, config_from_yaml_config.timesync.timesync_module_replay);
     EXPECT_EQ(config.timesync.timesync_module_rt, config_from_yaml_config.timesync.timesync_module_rt);
     EXPECT_EQ(config.application.startup.terminal_emulator, config_from_yaml_config.application.startup.terminal_emulator);
@@ -0,0 +1,438 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/udp/ecal_udp_fec.h"
+#include "io/udp/ecal_udp_reliable.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+  std::vector<char> GenerateBuffer(size_t size_, unsigned int seed_)
+  {
+    std::mt19937 gen(seed_);
+    std::uniform_int_distribution<int> dis(0, 255);
+    std::vector<char> buffer(size_);
+    for (char& element : buffer)
+    {
+      element = static_cast<char>(dis(gen));
+    }
+    return buffer;
+  }
+
+  // "loopback" between encoder and decoder with an injected drop function
+  struct SFecLoopback
+  {
+    std::vector<std::vector<char>> received_samples;
+    eCAL::UDP::CFecDecoder         decoder{ [this](const char* data_, size_t size_) { received_samples.emplace_back(data_, data_ + size_); } };
+
+    template <typename DropFunction>
+    size_t Send(eCAL::UDP::CFecEncoder& encoder_, size_t fragment_size_, const std::vector<char>& header_, const std::vector<char>& payload_, DropFunction&& drop_)
+    {
+      size_t datagram_idx(0);
+      return encoder_.Encode(fragment_size_, { header_.data(), header_.size() }, { payload_.data(), payload_.size() },
+        [&](const eCAL::UDP::SFecHeader& header, const std::array<eCAL::UDP::SFecBuffer, 2>& parts)
+        {
+          std::vector<char> datagram(sizeof(header));
+          std::memcpy(datagram.data(), &header, sizeof(header));
+          for (const auto& part : parts)
+          {
+            datagram.insert(datagram.end(), part.data, part.data + part.size);
+          }
+          if (!drop_(datagram_idx++, header))
+          {
+            EXPECT_TRUE(decoder.ApplyFragment(datagram.data(), datagram.size()));
+          }
+          return datagram.size();
+        });
+    }
+  };
+
+  constexpr uint16_t nack_port = 4711;
+  constexpr uint64_t nack_id   = 0x0815;
+
+  // reliable sender (encoder + retransmit window) and receiver (decoder) connected by a lossy "loopback"
+  struct SReliableLoopback
+  {
+    eCAL::UDP::CFecEncoder         encoder{ 16, 0, nack_port };
+    eCAL::UDP::CRetransmitWindow   window{ 4 };
+
+    std::vector<std::vector<char>> received_samples;
+    std::vector<std::vector<char>> nacks;
+    eCAL::UDP::CFecDecoder         decoder{ [this](const char* data_, size_t size_) { received_samples.emplace_back(data_, data_ + size_); },
+                                            [this](const std::string& address_, uint16_t port_, uint64_t message_id_, const std::vector<uint32_t>& fragments_)
+                                            {
+                                              EXPECT_EQ(address_, "127.0.0.1");
+                                              EXPECT_EQ(port_, nack_port);
+                                              std::vector<char> nack;
+                                              eCAL::UDP::SerializeNack(nack_id, message_id_, fragments_, nack);
+                                              nacks.emplace_back(std::move(nack));
+                                            } };
+
+    void Apply(const eCAL::UDP::SFecHeader& header_, const std::array<eCAL::UDP::SFecBuffer, 2>& parts_)
+    {
+      std::vector<char> datagram(sizeof(header_));
+      std::memcpy(datagram.data(), &header_, sizeof(header_));
+      for (const auto& part : parts_)
+      {
+        datagram.insert(datagram.end(), part.data, part.data + part.size);
+      }
+      EXPECT_TRUE(decoder.ApplyFragment(datagram.data(), datagram.size(), "127.0.0.1"));
+    }
+
+    template <typename DropFunction>
+    void Send(size_t fragment_size_, const std::vector<char>& header_, const std::vector<char>& payload_, DropFunction&& drop_)
+    {
+      const eCAL::UDP::SFecBuffer header { header_.data(), header_.size() };
+      const eCAL::UDP::SFecBuffer payload{ payload_.data(), payload_.size() };
+      eCAL::UDP::SFecHeader message_header;
+      encoder.Encode(fragment_size_, header, payload,
+        [&](const eCAL::UDP::SFecHeader& fec_header_, const std::array<eCAL::UDP::SFecBuffer, 2>& parts_)
+        {
+          message_header = fec_header_;
+          if (!drop_(fec_header_)) Apply(fec_header_, parts_);
+          return sizeof(fec_header_) + parts_[0].size + parts_[1].size;
+        });
+      window.Add("sample", message_header, header, payload);
+    }
+
+    // let the decoder send its nacks and answer them with repairs
+    void Repair(const std::chrono::steady_clock::time_point& now_)
+    {
+      nacks.clear();
+      decoder.ProcessNacks(now_);
+      for (const auto& nack : nacks)
+      {
+        uint64_t              id(0);
+        uint64_t              message_id(0);
+        std::vector<uint32_t> fragments;
+        ASSERT_TRUE(eCAL::UDP::DeserializeNack(nack.data(), nack.size(), id, message_id, fragments));
+        EXPECT_EQ(id, nack_id);
+        for (const auto& fragment : window.GetRepairFragments(message_id, fragments))
+        {
+          Apply(fragment.header, { { eCAL::UDP::SFecBuffer{ fragment.data.data(), fragment.data.size() }, eCAL::UDP::SFecBuffer{} } });
+        }
+      }
+    }
+  };
+
+  std::vector<char> Concat(const std::vector<char>& header_, const std::vector<char>& payload_)
+  {
+    std::vector<char> sample(header_);
+    sample.insert(sample.end(), payload_.begin(), payload_.end());
+    return sample;
+  }
+}
+
+TEST(core_cpp_io_udp_fec, FecNameprefix)
+{
+  const std::string topic_name("my_topic");
+  EXPECT_EQ(eCAL::UDP::StripFecSampleNamePrefix(eCAL::UDP::GetFecSampleNamePrefix() + topic_name), topic_name);
+  EXPECT_EQ(eCAL::UDP::StripFecSampleNamePrefix(topic_name), topic_name);
+}
+
+TEST(core_cpp_io_udp_fec, FecNoLoss)
+{
+  eCAL::UDP::CFecEncoder encoder(4, 2);
+  SFecLoopback loopback;
+  const size_t fragment_size(100);
+
+  const std::vector<size_t> payload_sizes{ 0, 1, 57, 100, 399, 400, 1000, 12345 };
+  for (const auto payload_size : payload_sizes)
+  {
+    const auto header  = GenerateBuffer(43, 1);
+    const auto payload = GenerateBuffer(payload_size, static_cast<unsigned int>(payload_size));
+    EXPECT_GT(loopback.Send(encoder, fragment_size, header, payload, [](size_t, const eCAL::UDP::SFecHeader&) { return false; }), 0u);
+  }
+
+  ASSERT_EQ(loopback.received_samples.size(), payload_sizes.size());
+  for (size_t i = 0; i < payload_sizes.size(); ++i)
+  {
+    EXPECT_EQ(loopback.received_samples[i], Concat(GenerateBuffer(43, 1), GenerateBuffer(payload_sizes[i], static_cast<unsigned int>(payload_sizes[i]))));
+  }
+  EXPECT_EQ(loopback.decoder.GetRecoveredCount(), 0u);
+}
+
+TEST(core_cpp_io_udp_fec, FecRecoverOneLossPerGroup)
+{
+  // 16 data fragments in 2 blocks of 8, 2 parity fragments per block
+  eCAL::UDP::CFecEncoder encoder(8, 2);
+  SFecLoopback loopback;
+  const size_t fragment_size(64);
+
+  const auto header  = GenerateBuffer(20, 2);
+  const auto payload = GenerateBuffer(16 * 64 - 20, 3);
+
+  // drop data fragments 0 and 3 (block 0, groups 0 and 1) and 14 (block 1, group 0)
+  loopback.Send(encoder, fragment_size, header, payload,
+    [](size_t, const eCAL::UDP::SFecHeader& header_)
+    {
+      return (header_.type == 0) && ((header_.fragment_index == 0) || (header_.fragment_index == 3) || (header_.fragment_index == 14));
+    });
+
+  ASSERT_EQ(loopback.received_samples.size(), 1u);
+  EXPECT_EQ(loopback.received_samples[0], Concat(header, payload));
+  EXPECT_EQ(loopback.decoder.GetRecoveredCount(), 1u);
+}
+
+TEST(core_cpp_io_udp_fec, FecTooManyLosses)
+{
+  eCAL::UDP::CFecEncoder encoder(8, 1);
+  SFecLoopback loopback;
+  const size_t fragment_size(64);
+
+  const auto header  = GenerateBuffer(20, 4);
+  const auto payload = GenerateBuffer(1000, 5);
+
+  // two lost fragments in the same parity group can not be restored
+  loopback.Send(encoder, fragment_size, header, payload,
+    [](size_t, const eCAL::UDP::SFecHeader& header_)
+    {
+      return (header_.type == 0) && ((header_.fragment_index == 1) || (header_.fragment_index == 2));
+    });
+
+  EXPECT_TRUE(loopback.received_samples.empty());
+}
+
+TEST(core_cpp_io_udp_fec, FecInjectedDropRate)
+{
+  // large samples with a 2 % datagram drop rate
+  const size_t       sample_count   = 50;
+  const size_t       fragment_size  = 1400;
+  const double       drop_rate      = 0.02;
+
+  std::mt19937 gen(42);
+  std::bernoulli_distribution drop(drop_rate);
+
+  const auto header  = GenerateBuffer(60, 6);
+  const auto payload = GenerateBuffer(200 * fragment_size, 7);
+
+  size_t received_without_fec(0);
+  {
+    // without redundancy every lost fragment loses its sample
+    eCAL::UDP::CFecEncoder encoder(0xFFFF, 1);
+    SFecLoopback loopback;
+    for (size_t i = 0; i < sample_count; ++i)
+    {
+      loopback.Send(encoder, fragment_size, header, payload, [&](size_t, const eCAL::UDP::SFecHeader& header_) { return (header_.type == 1) || drop(gen); });
+    }
+    received_without_fec = loopback.received_samples.size();
+  }
+
+  size_t received_with_fec(0);
+  {
+    eCAL::UDP::CFecEncoder encoder(16, 4);
+    SFecLoopback loopback;
+    for (size_t i = 0; i < sample_count; ++i)
+    {
+      loopback.Send(encoder, fragment_size, header, payload, [&](size_t, const eCAL::UDP::SFecHeader&) { return drop(gen); });
+    }
+    received_with_fec = loopback.received_samples.size();
+    for (const auto& sample : loopback.received_samples)
+    {
+      EXPECT_EQ(sample, Concat(header, payload));
+    }
+    EXPECT_GT(loopback.decoder.GetRecoveredCount(), 0u);
+  }
+
+  EXPECT_GT(received_with_fec, received_without_fec);
+  EXPECT_GE(received_with_fec, sample_count / 2);
+}
+
+TEST(core_cpp_io_udp_fec, FecIgnoreNonFecData)
+{
+  eCAL::UDP::CFecDecoder decoder([](const char*, size_t) { FAIL(); });
+
+  const std::vector<char> sample{ 0x08, 0x01, 0x12, 0x00 };
+  EXPECT_FALSE(eCAL::UDP::CFecDecoder::IsFecFragment(sample.data(), sample.size()));
+  EXPECT_FALSE(decoder.ApplyFragment(sample.data(), sample.size()));
+}
+
+TEST(core_cpp_io_udp_fec, FecCollectCompletedSamples)
+{
+  const std::vector<char> header  = GenerateBuffer(40, 1);
+  const std::vector<char> payload = GenerateBuffer(5000, 2);
+
+  // without apply sample callback the completed samples are collected for the caller
+  eCAL::UDP::CFecEncoder encoder(4, 1);
+  eCAL::UDP::CFecDecoder decoder(nullptr);
+  for (int i = 0; i < 2; ++i)
+  {
+    encoder.Encode(1000, { header.data(), header.size() }, { payload.data(), payload.size() },
+      [&decoder](const eCAL::UDP::SFecHeader& fec_header_, const std::array<eCAL::UDP::SFecBuffer, 2>& parts_)
+      {
+        std::vector<char> datagram(sizeof(fec_header_));
+        std::memcpy(datagram.data(), &fec_header_, sizeof(fec_header_));
+        for (const auto& part : parts_)
+        {
+          datagram.insert(datagram.end(), part.data, part.data + part.size);
+        }
+        EXPECT_TRUE(decoder.ApplyFragment(datagram.data(), datagram.size()));
+        return datagram.size();
+      });
+  }
+
+  std::vector<std::vector<char>> samples;
+  decoder.TakeCompletedSamples(samples);
+  ASSERT_EQ(samples.size(), 2u);
+  EXPECT_EQ(samples[0], Concat(header, payload));
+  EXPECT_EQ(samples[1], Concat(header, payload));
+
+  decoder.TakeCompletedSamples(samples);
+  EXPECT_TRUE(samples.empty());
+}
+
+TEST(core_cpp_io_udp_fec, FecRejectOversizedSample)
+{
+  eCAL::UDP::CFecDecoder decoder([](const char*, size_t) { FAIL(); }, nullptr, 1024 * 1024);
+
+  // consistent header of a (forged) huge sample, must not allocate the sample buffer
+  eCAL::UDP::SFecHeader header;
+  header.magic          = { { '\0', 'F', 'E', 'C' } };
+  header.version        = 1;
+  header.block_size     = 16;
+  header.fragment_size  = 1;
+  header.message_size   = 0xFFFFFFFFULL;
+  header.fragment_count = 0xFFFFFFFFU;
+
+  std::vector<char> datagram(sizeof(header) + 1);
+  std::memcpy(datagram.data(), &header, sizeof(header));
+  EXPECT_TRUE(eCAL::UDP::CFecDecoder::IsFecFragment(datagram.data(), datagram.size()));
+  EXPECT_FALSE(decoder.ApplyFragment(datagram.data(), datagram.size()));
+}
+
+TEST(core_cpp_io_udp_fec, NackSerialization)
+{
+  const std::vector<uint32_t> fragments{ 1, 5, 42 };
+  std::vector<char> buffer;
+  eCAL::UDP::SerializeNack(nack_id, 0x1234567800000042ULL, fragments, buffer);
+  EXPECT_EQ(buffer.size(), sizeof(eCAL::UDP::SNackHeader) + fragments.size() * sizeof(uint32_t));
+
+  uint64_t              id(0);
+  uint64_t              message_id(0);
+  std::vector<uint32_t> fragments_read;
+  EXPECT_TRUE(eCAL::UDP::DeserializeNack(buffer.data(), buffer.size(), id, message_id, fragments_read));
+  EXPECT_EQ(id, nack_id);
+  EXPECT_EQ(message_id, 0x1234567800000042ULL);
+  EXPECT_EQ(fragments_read, fragments);
+
+  // truncated nack or fec fragment
+  EXPECT_FALSE(eCAL::UDP::DeserializeNack(buffer.data(), buffer.size() - 1, id, message_id, fragments_read));
+  const eCAL::UDP::SFecHeader fec_header;
+  EXPECT_FALSE(eCAL::UDP::DeserializeNack(reinterpret_cast<const char*>(&fec_header), sizeof(fec_header), id, message_id, fragments_read));
+
+  // the fragments are always listed, a nack never requests a whole sample or more fragments than a decoder does
+  eCAL::UDP::SerializeNack(nack_id, 0x1234567800000042ULL, {}, buffer);
+  EXPECT_FALSE(eCAL::UDP::DeserializeNack(buffer.data(), buffer.size(), id, message_id, fragments_read));
+  eCAL::UDP::SerializeNack(nack_id, 0x1234567800000042ULL, std::vector<uint32_t>(257, 1), buffer);
+  EXPECT_FALSE(eCAL::UDP::DeserializeNack(buffer.data(), buffer.size(), id, message_id, fragments_read));
+}
+
+TEST(core_cpp_io_udp_fec, ReliableRepairLostFragments)
+{
+  const std::vector<char> header  = GenerateBuffer(40, 1);
+  const std::vector<char> payload = GenerateBuffer(20000, 2);
+
+  SReliableLoopback loopback;
+  loopback.Send(1000, header, payload, [](const eCAL::UDP::SFecHeader& header_) { return (header_.fragment_index == 3) || (header_.fragment_index == 20); });
+  EXPECT_TRUE(loopback.received_samples.empty());
+
+  // stalled sample, all missing fragments are requested
+  loopback.Repair(std::chrono::steady_clock::now() + std::chrono::milliseconds(50));
+  ASSERT_EQ(loopback.nacks.size(), 1u);
+  ASSERT_EQ(loopback.received_samples.size(), 1u);
+  EXPECT_EQ(loopback.received_samples[0], Concat(header, payload));
+  EXPECT_EQ(loopback.window.GetRepairCount(), 2u);
+  EXPECT_EQ(loopback.decoder.GetNackCount(), 1u);
+}
+
+TEST(core_cpp_io_udp_fec, ReliableRepairLostSample)
+{
+  const std::vector<char> header  = GenerateBuffer(40, 3);
+  const std::vector<char> payload = GenerateBuffer(5000, 4);
+
+  SReliableLoopback loopback;
+  loopback.Send(1000, header, payload, [](const eCAL::UDP::SFecHeader&) { return false; });
+  loopback.Send(1000, header, payload, [](const eCAL::UDP::SFecHeader&) { return true; });
+  loopback.Send(1000, header, payload, [](const eCAL::UDP::SFecHeader&) { return false; });
+  EXPECT_EQ(loopback.received_samples.size(), 2u);
+
+  // the second sample was lost completely, it is detected by the gap in the sender counter,
+  // its first fragment is requested and then the missing rest
+  loopback.Repair(std::chrono::steady_clock::now() + std::chrono::milliseconds(50));
+  EXPECT_EQ(loopback.window.GetRepairCount(), 1u);
+  loopback.Repair(std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+  ASSERT_EQ(loopback.received_samples.size(), 3u);
+  EXPECT_EQ(loopback.received_samples[2], Concat(header, payload));
+
+  // nothing left to request
+  loopback.Repair(std::chrono::steady_clock::now() + std::chrono::seconds(1));
+  EXPECT_TRUE(loopback.nacks.empty());
+}
+
+TEST(core_cpp_io_udp_fec, ReliableRepairSuppression)
+{
+  const std::vector<char> header  = GenerateBuffer(40, 5);
+  const std::vector<char> payload = GenerateBuffer(5000, 6);
+
+  SReliableLoopback loopback;
+  loopback.Send(1000, header, payload, [](const eCAL::UDP::SFecHeader& header_) { return header_.fragment_index == 1; });
+
+  // two receivers requesting the same fragment at the same time get a single repair
+  uint64_t message_id(0);
+  {
+    loopback.decoder.ProcessNacks(std::chrono::steady_clock::now() + std::chrono::milliseconds(50));
+    ASSERT_EQ(loopback.nacks.size(), 1u);
+    uint64_t              id(0);
+    std::vector<uint32_t> fragments;
+    ASSERT_TRUE(eCAL::UDP::DeserializeNack(loopback.nacks[0].data(), loopback.nacks[0].size(), id, message_id, fragments));
+    EXPECT_EQ(fragments, std::vector<uint32_t>{ 1 });
+  }
+  EXPECT_EQ(loopback.window.GetRepairFragments(message_id, { 1 }).size(), 1u);
+  EXPECT_EQ(loopback.window.GetRepairFragments(message_id, { 1 }).size(), 0u);
+
+  // unknown samples can not be repaired
+  EXPECT_TRUE(loopback.window.GetRepairFragments(message_id + 1, { 0 }).empty());
+}
+
+TEST(core_cpp_io_udp_fec, ReliableRepairBudget)
+{
+  const std::vector<char> header  = GenerateBuffer(40, 7);
+  const std::vector<char> payload = GenerateBuffer(400000, 8);
+
+  SReliableLoopback loopback;
+  uint64_t message_id(0);
+  loopback.Send(1000, header, payload, [&message_id](const eCAL::UDP::SFecHeader& header_) { message_id = header_.message_id; return false; });
+
+  // a single request is answered with at most as many fragments as a fec decoder requests
+  std::vector<uint32_t> fragments(400);
+  for (uint32_t idx = 0; idx < fragments.size(); ++idx) fragments[idx] = idx;
+  EXPECT_EQ(loopback.window.GetRepairFragments(message_id, fragments).size(), 256u);
+
+  // no repairs without a fragment list
+  EXPECT_TRUE(loopback.window.GetRepairFragments(message_id, {}).empty());
+}
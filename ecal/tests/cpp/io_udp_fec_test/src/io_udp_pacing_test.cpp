@@ -0,0 +1,80 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "io/udp/ecal_udp_pacing.h"
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+TEST(core_cpp_io_udp_pacing, Disabled)
+{
+  eCAL::UDP::CTokenBucket bucket(0, 1000);
+  EXPECT_FALSE(bucket.IsEnabled());
+
+  const auto now = std::chrono::steady_clock::now();
+  EXPECT_EQ(bucket.Reserve(1000000, now), std::chrono::steady_clock::duration::zero());
+}
+
+TEST(core_cpp_io_udp_pacing, Burst)
+{
+  // 1 MB/s, 10 kB burst
+  eCAL::UDP::CTokenBucket bucket(1000000, 10000);
+  EXPECT_TRUE(bucket.IsEnabled());
+
+  // the burst is sent without delay
+  const auto now = std::chrono::steady_clock::now();
+  EXPECT_EQ(bucket.Reserve(5000, now), std::chrono::steady_clock::duration::zero());
+  EXPECT_EQ(bucket.Reserve(5000, now), std::chrono::steady_clock::duration::zero());
+
+  // everything above the burst has to wait for the refill
+  const auto wait_1 = std::chrono::duration_cast<std::chrono::microseconds>(bucket.Reserve(1000, now));
+  EXPECT_NEAR(static_cast<double>(wait_1.count()), 1000.0, 1.0);
+
+  // the debt adds up
+  const auto wait_2 = std::chrono::duration_cast<std::chrono::microseconds>(bucket.Reserve(1000, now));
+  EXPECT_NEAR(static_cast<double>(wait_2.count()), 2000.0, 1.0);
+}
+
+TEST(core_cpp_io_udp_pacing, Refill)
+{
+  // 1 MB/s, 10 kB burst
+  eCAL::UDP::CTokenBucket bucket(1000000, 10000);
+
+  const auto now = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+  EXPECT_EQ(bucket.Reserve(10000, now), std::chrono::steady_clock::duration::zero());
+
+  // 5 ms later 5 kB are available again
+  EXPECT_EQ(bucket.Reserve(5000, now + std::chrono::milliseconds(5)), std::chrono::steady_clock::duration::zero());
+  EXPECT_GT(bucket.Reserve(1000, now + std::chrono::milliseconds(5)), std::chrono::steady_clock::duration::zero());
+
+  // the bucket never holds more than the burst size
+  EXPECT_EQ(bucket.Reserve(10000, now + std::chrono::seconds(10)), std::chrono::steady_clock::duration::zero());
+  EXPECT_GT(bucket.Reserve(1000, now + std::chrono::seconds(10)), std::chrono::steady_clock::duration::zero());
+}
+
+TEST(core_cpp_io_udp_pacing, ProcessTokenBucket)
+{
+  auto bucket_1 = eCAL::UDP::GetProcessTokenBucket(1000000, 10000);
+  auto bucket_2 = eCAL::UDP::GetProcessTokenBucket(2000000, 20000);
+
+  // all senders of the process share the same bucket
+  EXPECT_EQ(bucket_1, bucket_2);
+  EXPECT_EQ(bucket_2->GetRate(), 1000000);
+}
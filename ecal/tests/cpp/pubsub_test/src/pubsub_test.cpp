@@ -535,4 +535,56 @@ TEST(core_cpp_pubsub, MoveAssignment)
     EXPECT_STRNE(subscriber_topic_id.topic_name.c_str(), "subscriber_topic_1");
 
   eCAL::Finalize();
-}
\ No newline at end of file
+}
+
+TEST(core_cpp_pubsub, ContentFilter)
+{
+  // default send string
+  const std::string send_s = CreatePayLoad(PAYLOAD_SIZE_BYTE);
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "content_filter" receiving the content ids 10 to 19 only
+  eCAL::CSubscriber sub("content_filter");
+  EXPECT_TRUE(sub.SetContentFilter({ { 10, 19 } }));
+
+  std::atomic<size_t> received_count(0);
+  sub.SetReceiveCallback([&received_count](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/) { received_count++; });
+
+  // create publisher for topic "content_filter"
+  eCAL::CPublisher pub("content_filter");
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // no subscriber accepts the content id, nothing is sent
+  EXPECT_FALSE(pub.Send(send_s, eCAL::CPublisher::DEFAULT_TIME_ARGUMENT, 5));
+  // messages without content id are sent with content id 0
+  EXPECT_FALSE(pub.Send(send_s));
+  // accepted content id
+  EXPECT_TRUE(pub.Send(send_s, eCAL::CPublisher::DEFAULT_TIME_ARGUMENT, 15));
+
+  // let the data flow
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // check callback receive
+  EXPECT_EQ(1, received_count);
+
+  // remove the filter and let the publisher know
+  EXPECT_TRUE(sub.SetContentFilter({}));
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // every content id is accepted again
+  EXPECT_TRUE(pub.Send(send_s, eCAL::CPublisher::DEFAULT_TIME_ARGUMENT, 5));
+  EXPECT_TRUE(pub.Send(send_s));
+
+  // let the data flow
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // check callback receive
+  EXPECT_EQ(3, received_count);
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
@@ -0,0 +1,174 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+#include <ecal/pubsub/publisher.h>
+#include <ecal/pubsub/subscriber.h>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+enum {
+  CMN_REGISTRATION_REFRESH_MS = 1000,
+};
+
+namespace
+{
+  eCAL::Publisher::Configuration InprocPublisherConfiguration()
+  {
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.enable    = true;
+    pub_config.layer.udp.enable    = false;
+    pub_config.layer.tcp.enable    = false;
+    pub_config.layer.inproc.enable = true;
+    return pub_config;
+  }
+
+  eCAL::Subscriber::Configuration InprocSubscriberConfiguration()
+  {
+    eCAL::Subscriber::Configuration sub_config;
+    sub_config.layer.inproc.enable = true;
+    return sub_config;
+  }
+}
+
+TEST(core_cpp_pubsub, MultipleSendsINPROC)
+{
+  // default send string
+  const std::vector<std::string> send_vector{ "this", "is", "a", "", "testtest" };
+  std::string last_received_msg;
+  long long   last_received_timestamp(0);
+  std::thread::id receive_thread_id;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber and publisher for topic "A"
+  eCAL::CSubscriber sub("A", {}, InprocSubscriberConfiguration());
+  eCAL::CPublisher  pub("A", {}, InprocPublisherConfiguration());
+
+  // add callback
+  auto save_data = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    last_received_msg       = std::string{ static_cast<const char*>(data_.buffer), data_.buffer_size };
+    last_received_timestamp = data_.send_timestamp;
+    receive_thread_id       = std::this_thread::get_id();
+  };
+  sub.SetReceiveCallback(save_data);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // the sample is delivered within the send call, no need to wait
+  long long timestamp = 1;
+  for (const auto& elem : send_vector)
+  {
+    EXPECT_TRUE(pub.Send(elem, timestamp));
+    EXPECT_EQ(last_received_msg, elem);
+    EXPECT_EQ(last_received_timestamp, timestamp);
+    EXPECT_EQ(receive_thread_id, std::this_thread::get_id());
+    ++timestamp;
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, MultipleSubscribersINPROC)
+{
+  const std::string send_s("inproc");
+  std::atomic<size_t> received_count(0);
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create two subscribers reading inproc and one that does not
+  eCAL::CSubscriber sub1("A", {}, InprocSubscriberConfiguration());
+  eCAL::CSubscriber sub2("A", {}, InprocSubscriberConfiguration());
+
+  eCAL::CPublisher pub("A", {}, InprocPublisherConfiguration());
+
+  auto count_data = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    if (std::string(static_cast<const char*>(data_.buffer), data_.buffer_size) == send_s) received_count++;
+  };
+  sub1.SetReceiveCallback(count_data);
+  sub2.SetReceiveCallback(count_data);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  EXPECT_TRUE(pub.Send(send_s));
+  EXPECT_EQ(2, received_count);
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, LateJoinerHistoryReentrantSendINPROC)
+{
+  const int history_depth = 3;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher for topic "A" keeping its last samples and send before any subscriber exists
+  eCAL::Publisher::Configuration pub_config = InprocPublisherConfiguration();
+  pub_config.history_depth = history_depth;
+  eCAL::CPublisher pub("A", {}, pub_config);
+  for (int i = 0; i < history_depth; ++i)
+  {
+    pub.Send(std::to_string(i));
+  }
+
+  // create a subscriber receiving the history
+  eCAL::Subscriber::Configuration sub_config = InprocSubscriberConfiguration();
+  sub_config.receive_history = true;
+  eCAL::CSubscriber sub("A", {}, sub_config);
+
+  // the callback answers every sample on the same publisher, within the history replay and within a send call
+  std::atomic<size_t> received_count(0);
+  std::atomic<size_t> echo_count(0);
+  sub.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      if (std::string(static_cast<const char*>(data_.buffer), data_.buffer_size) == "echo")
+      {
+        echo_count++;
+        return;
+      }
+      received_count++;
+      EXPECT_TRUE(pub.Send("echo"));
+    });
+
+  // let's match them, the publisher replays its history on connect
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+  EXPECT_EQ(static_cast<size_t>(history_depth), received_count.load());
+
+  EXPECT_TRUE(pub.Send(std::to_string(history_depth)));
+  EXPECT_EQ(static_cast<size_t>(history_depth + 1), received_count.load());
+  EXPECT_GE(echo_count, static_cast<size_t>(history_depth + 1));
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
@@ -135,3 +135,99 @@ TEST(core_cpp_pubsub_multilayer, MultiLayerNoDuplicateMessages)
   eCAL::Finalize();
 }
 
+
+TEST(core_cpp_pubsub_multilayer, MultiLayerNoDuplicateMessagesContentFilter)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = true;
+  pub_config.layer.tcp.enable = true;
+
+  eCAL::Subscriber::Configuration sub_all_config;
+  sub_all_config.layer.shm.enable = true;
+  sub_all_config.layer.udp.enable = true;
+  sub_all_config.layer.tcp.enable = true;
+
+  // a filtered subscriber gets every sample on all layers as well and has to drop the duplicates
+  eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), pub_config);
+  eCAL::CSubscriber sub_all("A", eCAL::SDataTypeInformation(), sub_all_config);
+  EXPECT_TRUE(sub_all.SetContentFilter({ { 1, 1 } }));
+
+  ReceiveCounter counter_all;
+  sub_all.SetReceiveCallback([&counter_all](auto&&...) {counter_all.OnData(); });
+
+  // let's match them
+  eCAL::Process::SleepMS(3 * CMN_REGISTRATION_REFRESH_MS);
+
+  const int number_messages_sent = 10;
+  for (int i = 0; i < number_messages_sent; ++i)
+  {
+    EXPECT_TRUE(pub.Send(std::string("content"), eCAL::CPublisher::DEFAULT_TIME_ARGUMENT, 1));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  }
+
+  EXPECT_EQ(counter_all.Count(), number_messages_sent);
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub_multilayer, AdaptiveLayerSelectionNoLostOrDuplicateMessages)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher config, all layers are started and selected per payload size at runtime
+  eCAL::Publisher::Configuration pub_config;
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = true;
+  pub_config.layer.tcp.enable = true;
+  pub_config.layer_priority_local = { eCAL::TransportLayer::eType::shm, eCAL::TransportLayer::eType::udp_mc, eCAL::TransportLayer::eType::tcp };
+  pub_config.adaptive_layer_selection.enable         = true;
+  pub_config.adaptive_layer_selection.probe_interval = 3;
+  pub_config.adaptive_layer_selection.min_samples    = 1;
+
+  eCAL::Subscriber::Configuration sub_tcp_config;
+  sub_tcp_config.layer.shm.enable = false;
+  sub_tcp_config.layer.udp.enable = false;
+  sub_tcp_config.layer.tcp.enable = true;
+
+  eCAL::Subscriber::Configuration sub_all_config;
+  sub_all_config.layer.shm.enable = true;
+  sub_all_config.layer.udp.enable = true;
+  sub_all_config.layer.tcp.enable = true;
+
+  eCAL::CPublisher pub("A", eCAL::SDataTypeInformation(), pub_config);
+  eCAL::CSubscriber sub_tcp("A", eCAL::SDataTypeInformation(), sub_tcp_config);
+  eCAL::CSubscriber sub_all("A", eCAL::SDataTypeInformation(), sub_all_config);
+
+  ReceiveCounter counter_tcp;
+  sub_tcp.SetReceiveCallback([&counter_tcp](auto&&...) {counter_tcp.OnData(); });
+  ReceiveCounter counter_all;
+  sub_all.SetReceiveCallback([&counter_all](auto&&...) {counter_all.OnData(); });
+
+  // let's match them
+  eCAL::Process::SleepMS(3 * CMN_REGISTRATION_REFRESH_MS);
+
+  // small and large payloads alternating, over more than one registration cycle
+  // so that the layers are (re)selected while sending
+  const std::string small_payload(1024, 's');
+  const std::string large_payload(1024 * 1024, 'l');
+  const int number_messages_sent = 60;
+  for (int i = 0; i < number_messages_sent; ++i)
+  {
+    EXPECT_TRUE(pub.Send((i % 2 == 0) ? small_payload : large_payload));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  }
+
+  EXPECT_EQ(counter_tcp.Count(), number_messages_sent);
+  EXPECT_EQ(counter_all.Count(), number_messages_sent);
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
@@ -21,10 +21,14 @@
 #include <ecal/ecal.h>
 #include <ecal/pubsub/publisher.h>
 #include <ecal/pubsub/subscriber.h>
+#include <ecal/pubsub/waitset.h>
+#include <ecal/v5/ecal_subscriber.h>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -32,6 +36,10 @@
 #include <gtest/gtest.h>
 #include <vector>
 
+#ifdef __linux__
+#include <poll.h>
+#endif
+
 enum {
   CMN_REGISTRATION_REFRESH_MS = 1000,
   DATA_FLOW_TIME_MS = 50,
@@ -339,4 +347,806 @@ TEST(core_cpp_pubsub, PublisherConfigSHMMemfileMinSizePreventsInitialResize)
   }
 
   eCAL::Finalize();
-}
\ No newline at end of file
+}
+TEST(core_cpp_pubsub, ConcurrentSendSHM)
+{
+  const int thread_count = 8;
+  const int send_count   = 200;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+  // wait for the subscriber to process every sample
+  pub_config.layer.shm.acknowledge_timeout_ms = 500;
+  // allow concurrent send calls
+  pub_config.concurrent_send = true;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // add callback (checks the payload content and the send clock order)
+  std::atomic<size_t> received_count(0);
+  std::atomic<size_t> corrupted_count(0);
+  std::atomic<size_t> out_of_order_count(0);
+  long long last_send_clock(0);
+  auto check_data = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    const std::string payload{ (const char*)data_.buffer, (size_t)data_.buffer_size };
+    if (payload.empty() || payload != std::string(payload.size(), payload[0])) corrupted_count++;
+    if (data_.send_clock <= last_send_clock) out_of_order_count++;
+    last_send_clock = data_.send_clock;
+    received_count++;
+  };
+  sub.SetReceiveCallback(check_data);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send from multiple threads, every thread sends its own character with varying sizes
+  std::vector<std::thread> sender;
+  for (int t = 0; t < thread_count; ++t)
+  {
+    sender.emplace_back([&pub, t]()
+      {
+        for (int i = 0; i < send_count; ++i)
+        {
+          pub.Send(std::string(1 + (i * 97) % 4096, static_cast<char>('a' + t)));
+        }
+      });
+  }
+  for (auto& thread : sender) thread.join();
+
+  // let the data flow
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // check callback receive
+  EXPECT_EQ(static_cast<size_t>(thread_count * send_count), received_count.load());
+  EXPECT_EQ(0, corrupted_count.load());
+  EXPECT_EQ(0, out_of_order_count.load());
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, ReceiveQueueDropOldestSHM)
+{
+  const int send_count  = 50;
+  const int queue_depth = 4;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber config with a small receive queue
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.receive_queue.depth           = queue_depth;
+  sub_config.receive_queue.overflow_policy = eCAL::Subscriber::ReceiveQueue::eOverflowPolicy::drop_oldest;
+  sub_config.receive_queue.executor        = eCAL::Subscriber::ReceiveQueue::eExecutor::dedicated_thread;
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A", {}, sub_config);
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // add a slow callback (the transport thread must not be blocked by it)
+  std::atomic<size_t> received_count(0);
+  long long last_send_clock(0);
+  std::atomic<size_t> out_of_order_count(0);
+  auto slow_callback = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+  {
+    if (data_.send_clock <= last_send_clock) out_of_order_count++;
+    last_send_clock = data_.send_clock;
+    eCAL::Process::SleepMS(20);
+    received_count++;
+  };
+  sub.SetReceiveCallback(slow_callback);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send faster than the callback can process
+  for (int i = 0; i < send_count; ++i)
+  {
+    pub.Send(std::string(64, 'x'));
+    eCAL::Process::SleepMS(1);
+  }
+
+  // let the queue drain
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS + 20 * (queue_depth + 1));
+
+  // the oldest samples have been dropped, the remaining ones are received in order
+  EXPECT_LT(received_count.load(), static_cast<size_t>(send_count));
+  EXPECT_GE(received_count.load(), static_cast<size_t>(queue_depth));
+  EXPECT_EQ(0, out_of_order_count.load());
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, ReceiveQueueCallerExecutorSHM)
+{
+  const int send_count = 10;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber config, the application processes the receive queue
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.receive_queue.depth    = 2 * send_count;
+  sub_config.receive_queue.executor = eCAL::Subscriber::ReceiveQueue::eExecutor::caller;
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A", {}, sub_config);
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // add callback, remember the executing thread
+  std::atomic<size_t> received_count(0);
+  std::atomic<size_t> foreign_thread_count(0);
+  const auto caller_thread_id = std::this_thread::get_id();
+  auto count_callback = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+  {
+    if (std::this_thread::get_id() != caller_thread_id) foreign_thread_count++;
+    received_count++;
+  };
+  sub.SetReceiveCallback(count_callback);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send
+  for (int i = 0; i < send_count; ++i)
+  {
+    pub.Send(std::string(64, 'x'));
+  }
+
+  // let the data flow, nothing is processed without the caller
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  EXPECT_EQ(0, received_count.load());
+
+  // process the queue
+  EXPECT_EQ(static_cast<size_t>(send_count), sub.ProcessReceiveQueue(100));
+  EXPECT_EQ(static_cast<size_t>(send_count), received_count.load());
+  EXPECT_EQ(0, foreign_thread_count.load());
+
+  // queue is empty now
+  EXPECT_EQ(0, sub.ProcessReceiveQueue());
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, ReceiveQueueDestroySubscriberInCallbackSHM)
+{
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber config with a dedicated receive thread
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.receive_queue.executor = eCAL::Subscriber::ReceiveQueue::eExecutor::dedicated_thread;
+
+  // create subscriber for topic "A"
+  std::unique_ptr<eCAL::CSubscriber> sub(new eCAL::CSubscriber("A", {}, sub_config));
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // add callback destroying its own subscriber (must neither join nor wait for itself)
+  std::mutex              destroyed_mtx;
+  std::condition_variable destroyed_cv;
+  bool                    destroyed(false);
+  auto destroy_callback = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+  {
+    sub.reset();
+    const std::lock_guard<std::mutex> lock(destroyed_mtx);
+    destroyed = true;
+    destroyed_cv.notify_one();
+  };
+  sub->SetReceiveCallback(destroy_callback);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send until the subscriber is gone
+  std::unique_lock<std::mutex> lock(destroyed_mtx);
+  for (int i = 0; i < 10 && !destroyed; ++i)
+  {
+    lock.unlock();
+    pub.Send(std::string(64, 'x'));
+    lock.lock();
+    destroyed_cv.wait_for(lock, std::chrono::milliseconds(DATA_FLOW_TIME_MS), [&destroyed]() { return destroyed; });
+  }
+  EXPECT_TRUE(destroyed);
+  lock.unlock();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, WaitSetSHM)
+{
+  const int send_count = 10;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber config, the application processes the receive queues
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.receive_queue.depth    = 2 * send_count;
+  sub_config.receive_queue.executor = eCAL::Subscriber::ReceiveQueue::eExecutor::caller;
+
+  // create subscribers for topic "A" and "B" and a subscriber without receive queue
+  eCAL::CSubscriber sub_a("A", {}, sub_config);
+  eCAL::CSubscriber sub_b("B", {}, sub_config);
+  eCAL::CSubscriber sub_no_queue("C");
+
+  // aggregate them in one wait set
+  eCAL::CWaitSet waitset;
+  EXPECT_TRUE(waitset.Attach(sub_a));
+  EXPECT_TRUE(waitset.Attach(sub_b));
+  EXPECT_FALSE(waitset.Attach(sub_no_queue));
+
+  // a subscriber belongs to one wait set only
+  eCAL::CWaitSet other_waitset;
+  EXPECT_FALSE(other_waitset.Attach(sub_a));
+
+#ifdef __linux__
+  EXPECT_GE(waitset.GetFileDescriptor(), 0);
+#endif
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publishers for topic "A" and "B"
+  eCAL::CPublisher pub_a("A", {}, pub_config);
+  eCAL::CPublisher pub_b("B", {}, pub_config);
+
+  // add callbacks, remember the executing thread
+  std::atomic<size_t> received_a(0);
+  std::atomic<size_t> received_b(0);
+  std::atomic<size_t> foreign_thread_count(0);
+  const auto caller_thread_id = std::this_thread::get_id();
+  sub_a.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+    {
+      if (std::this_thread::get_id() != caller_thread_id) foreign_thread_count++;
+      received_a++;
+    });
+  sub_b.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+    {
+      if (std::this_thread::get_id() != caller_thread_id) foreign_thread_count++;
+      received_b++;
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // nothing queued, the wait set is not signaled
+  EXPECT_FALSE(waitset.Wait(0));
+
+  // send on both topics
+  for (int i = 0; i < send_count; ++i)
+  {
+    pub_a.Send(std::string(64, 'a'));
+    pub_b.Send(std::string(64, 'b'));
+  }
+
+  // the wait set is signaled, on linux its file descriptor is readable
+  EXPECT_TRUE(waitset.Wait(DATA_FLOW_TIME_MS));
+#ifdef __linux__
+  pollfd waitset_poll{ waitset.GetFileDescriptor(), POLLIN, 0 };
+  EXPECT_EQ(1, poll(&waitset_poll, 1, DATA_FLOW_TIME_MS));
+#endif
+
+  // let the data flow and take all samples of both subscribers in this thread
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  EXPECT_EQ(static_cast<size_t>(2 * send_count), waitset.TakeAll());
+  EXPECT_EQ(static_cast<size_t>(send_count), received_a.load());
+  EXPECT_EQ(static_cast<size_t>(send_count), received_b.load());
+  EXPECT_EQ(0, foreign_thread_count.load());
+
+  // drained, the signal is reset
+  EXPECT_FALSE(waitset.Wait(0));
+#ifdef __linux__
+  EXPECT_EQ(0, poll(&waitset_poll, 1, 0));
+#endif
+
+  // detached subscribers do not signal the wait set anymore
+  EXPECT_TRUE(waitset.Detach(sub_b));
+  EXPECT_FALSE(waitset.Detach(sub_b));
+  pub_b.Send(std::string(64, 'b'));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  EXPECT_FALSE(waitset.Wait(0));
+  EXPECT_EQ(1, sub_b.ProcessReceiveQueue());
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, CallbackCallsBackIntoSubscriberSHM)
+{
+  const int send_count = 5;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  eCAL::CSubscriber sub("A");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // the callback queries the subscriber and removes itself (must not deadlock)
+  std::atomic<size_t> received_count(0);
+  std::atomic<size_t> publisher_count(0);
+  auto remove_callback = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+  {
+    publisher_count = sub.GetPublisherCount();
+    sub.RemoveReceiveCallback();
+    received_count++;
+  };
+  sub.SetReceiveCallback(remove_callback);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send
+  for (int i = 0; i < send_count; ++i)
+  {
+    pub.Send(std::string(64, 'x'));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  }
+
+  // the callback was executed once, the following samples are buffered for Read
+  EXPECT_EQ(1, received_count.load());
+  EXPECT_EQ(1, publisher_count.load());
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, MaxFrequencySHM)
+{
+  const int send_count       = 100;
+  const int send_interval_ms = 10;
+  const double max_frequency = 10.0;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber config, the subscriber wants 10 samples per second at most
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.max_frequency_hz = max_frequency;
+
+  // create subscriber for topic "A", the skipped samples must not be reported as drops
+  std::atomic<size_t> dropped_count(0);
+  auto event_callback = [&dropped_count](const eCAL::STopicId& /*topic_id_*/, const eCAL::SSubEventCallbackData& data_)
+  {
+    if (data_.event_type == eCAL::eSubscriberEvent::dropped) dropped_count++;
+  };
+  eCAL::CSubscriber sub("A", {}, event_callback, sub_config);
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  std::atomic<size_t> received_count(0);
+  sub.SetReceiveCallback([&received_count](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/) { received_count++; });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send with 100 Hz
+  size_t sent_count(0);
+  const auto send_start = std::chrono::steady_clock::now();
+  for (int i = 0; i < send_count; ++i)
+  {
+    if (pub.Send(std::string(64, 'x'))) sent_count++;
+    eCAL::Process::SleepMS(send_interval_ms);
+  }
+  const double send_duration_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - send_start).count();
+
+  // let the data flow
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // the publisher skipped the samples above the requested rate, all sent samples were received
+  EXPECT_GE(received_count.load(), 5);
+  EXPECT_LE(received_count.load(), static_cast<size_t>(send_duration_s * max_frequency) + 2);
+  EXPECT_EQ(sent_count, received_count.load());
+
+  // let the registration report message drops
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+  EXPECT_EQ(0, dropped_count.load());
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, SendBatchSHM)
+{
+  const int batch_size  = 50;
+  const int batch_count = 4;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A"
+  std::atomic<size_t> dropped_count(0);
+  auto event_callback = [&dropped_count](const eCAL::STopicId& /*topic_id_*/, const eCAL::SSubEventCallbackData& data_)
+  {
+    if (data_.event_type == eCAL::eSubscriberEvent::dropped) dropped_count++;
+  };
+  eCAL::CSubscriber sub("A", {}, event_callback);
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  std::mutex               received_mutex;
+  std::vector<std::string> received_payloads;
+  std::vector<long long>   received_clocks;
+  std::vector<long long>   received_times;
+  sub.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mutex);
+      received_payloads.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+      received_clocks.push_back(data_.send_clock);
+      received_times.push_back(data_.send_timestamp);
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send the batches, every message has its own payload size and send time
+  std::vector<std::string> sent_payloads;
+  for (int batch = 0; batch < batch_count; ++batch)
+  {
+    std::vector<std::string>         payloads;
+    std::vector<eCAL::SBatchMessage> messages;
+    for (int i = 0; i < batch_size; ++i)
+    {
+      payloads.push_back(std::string(static_cast<size_t>(i + 1), static_cast<char>('a' + i % 26)));
+    }
+    for (int i = 0; i < batch_size; ++i)
+    {
+      messages.push_back({ payloads[i].data(), payloads[i].size(), 1000 * batch + i });
+    }
+    EXPECT_TRUE(pub.SendBatch(messages));
+    sent_payloads.insert(sent_payloads.end(), payloads.begin(), payloads.end());
+
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  }
+
+  // every message is received as an individual sample, in order and with consecutive clocks
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    ASSERT_EQ(sent_payloads.size(), received_payloads.size());
+    EXPECT_EQ(sent_payloads, received_payloads);
+    for (size_t i = 0; i < received_clocks.size(); ++i)
+    {
+      EXPECT_EQ(received_clocks[0] + static_cast<long long>(i), received_clocks[i]);
+      EXPECT_EQ(1000 * static_cast<long long>(i / batch_size) + static_cast<long long>(i % batch_size), received_times[i]);
+    }
+  }
+
+  // let the registration report message drops
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+  EXPECT_EQ(0, dropped_count.load());
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, SendBatchContentFilterSHM)
+{
+  const int batch_size = 50;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber for topic "A" receiving the content ids 10 to 19 only
+  eCAL::CSubscriber sub("A");
+  EXPECT_TRUE(sub.SetContentFilter({ { 10, 19 } }));
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  std::mutex               received_mutex;
+  std::vector<std::string> received_payloads;
+  sub.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mutex);
+      received_payloads.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+    });
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send one batch, the content id of every message is its index
+  std::vector<std::string>         payloads;
+  std::vector<eCAL::SBatchMessage> messages;
+  for (int i = 0; i < batch_size; ++i)
+  {
+    payloads.push_back(std::to_string(i));
+  }
+  for (int i = 0; i < batch_size; ++i)
+  {
+    messages.push_back({ payloads[i].data(), payloads[i].size(), -1, i });
+  }
+  EXPECT_TRUE(pub.SendBatch(messages));
+
+  // let the data flow
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  // only the accepted content ids are received, in order
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    const std::vector<std::string> expected_payloads(payloads.begin() + 10, payloads.begin() + 20);
+    EXPECT_EQ(expected_payloads, received_payloads);
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, LateJoinerHistorySHM)
+{
+  const int history_depth = 3;
+  const int send_count    = 5;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+  // keep the last samples for late joining subscribers
+  pub_config.history_depth = history_depth;
+
+  // create publisher for topic "A" and send before any subscriber exists
+  eCAL::CPublisher pub("A", {}, pub_config);
+  for (int i = 0; i < send_count; ++i)
+  {
+    pub.Send(std::to_string(i));
+  }
+
+  // create a subscriber receiving the history and one that does not want it
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.receive_history = true;
+  eCAL::CSubscriber sub_history("A", {}, sub_config);
+
+  eCAL::Subscriber::Configuration sub_no_history_config;
+  sub_no_history_config.receive_history = false;
+  eCAL::CSubscriber sub_no_history("A", {}, sub_no_history_config);
+
+  std::mutex               received_mutex;
+  std::vector<std::string> received_history;
+  std::vector<std::string> received_no_history;
+  sub_history.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mutex);
+      received_history.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+    });
+  sub_no_history.SetReceiveCallback([&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mutex);
+      received_no_history.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+    });
+
+  // let's match them, the publisher replays its history on connect
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // the late joiner gets the last history_depth samples in send order, the other one nothing
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    const std::vector<std::string> expected_history{ "2", "3", "4" };
+    EXPECT_EQ(expected_history, received_history);
+    EXPECT_TRUE(received_no_history.empty());
+  }
+
+  // live samples reach both subscribers once
+  EXPECT_TRUE(pub.Send("5"));
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  {
+    const std::lock_guard<std::mutex> lock(received_mutex);
+    ASSERT_EQ(history_depth + 1, static_cast<int>(received_history.size()));
+    EXPECT_EQ("5", received_history.back());
+    ASSERT_EQ(1U, received_no_history.size());
+    EXPECT_EQ("5", received_no_history.back());
+  }
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, ReadBufferDepthSHM)
+{
+  const int send_count        = 20;
+  const int read_buffer_depth = 8;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscriber config with a polling read buffer
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.read_buffer_depth = read_buffer_depth;
+
+  // create polling subscriber for topic "A"
+  eCAL::v5::CSubscriber sub("A", sub_config);
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publisher for topic "A"
+  eCAL::CPublisher pub("A", {}, pub_config);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send less samples than the read buffer holds, the late reader gets all of them
+  for (int i = 0; i < read_buffer_depth / 2; ++i)
+  {
+    pub.Send(std::to_string(i));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  }
+
+  std::vector<std::string> bufs;
+  std::vector<long long>   times;
+  EXPECT_EQ(static_cast<size_t>(read_buffer_depth / 2), sub.ReceiveBuffers(bufs, &times));
+  ASSERT_EQ(static_cast<size_t>(read_buffer_depth / 2), bufs.size());
+  ASSERT_EQ(bufs.size(), times.size());
+  for (size_t i = 0; i < bufs.size(); ++i)
+  {
+    EXPECT_EQ(std::to_string(i), bufs[i]);
+  }
+
+  // send more samples than the read buffer holds, the newest samples are dropped
+  for (int i = 0; i < send_count; ++i)
+  {
+    pub.Send(std::to_string(i));
+    eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+  }
+
+  std::string buf;
+  EXPECT_TRUE(sub.ReceiveBuffer(buf));
+  EXPECT_EQ("0", buf);
+  EXPECT_EQ(static_cast<size_t>(read_buffer_depth - 1), sub.ReceiveBuffers(bufs));
+  EXPECT_EQ(0U, sub.ReceiveBuffers(bufs));
+
+  // a waiting receive returns with the next sample
+  std::thread sender([&pub]() { eCAL::Process::SleepMS(DATA_FLOW_TIME_MS); pub.Send("late"); });
+  EXPECT_TRUE(sub.ReceiveBuffer(buf, nullptr, 10 * DATA_FLOW_TIME_MS));
+  EXPECT_EQ("late", buf);
+  sender.join();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
+
+TEST(core_cpp_pubsub, CallbacksReplaceEachOthersCallbackSHM)
+{
+  const int send_count = 100;
+
+  // initialize eCAL API
+  eCAL::Initialize("pubsub_test");
+
+  // create subscribers for topic "A" and "B"
+  eCAL::CSubscriber sub_a("A");
+  eCAL::CSubscriber sub_b("B");
+
+  // create publisher config
+  eCAL::Publisher::Configuration pub_config;
+  // set transport layer
+  pub_config.layer.shm.enable = true;
+  pub_config.layer.udp.enable = false;
+  pub_config.layer.tcp.enable = false;
+
+  // create publishers for topic "A" and "B"
+  eCAL::CPublisher pub_a("A", {}, pub_config);
+  eCAL::CPublisher pub_b("B", {}, pub_config);
+
+  // every callback replaces the callback of the other subscriber (must not deadlock)
+  std::atomic<size_t> received_count(0);
+  eCAL::ReceiveCallbackT callback_a;
+  eCAL::ReceiveCallbackT callback_b;
+  callback_a = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+  {
+    sub_b.SetReceiveCallback(callback_b);
+    received_count++;
+  };
+  callback_b = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& /*data_*/)
+  {
+    sub_a.SetReceiveCallback(callback_a);
+    received_count++;
+  };
+  sub_a.SetReceiveCallback(callback_a);
+  sub_b.SetReceiveCallback(callback_b);
+
+  // let's match them
+  eCAL::Process::SleepMS(2 * CMN_REGISTRATION_REFRESH_MS);
+
+  // send on both topics at the same time
+  std::thread send_b([&pub_b]()
+    {
+      for (int i = 0; i < send_count; ++i) pub_b.Send(std::string(64, 'b'));
+    });
+  for (int i = 0; i < send_count; ++i) pub_a.Send(std::string(64, 'a'));
+  send_b.join();
+  eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+
+  EXPECT_LT(0u, received_count.load());
+
+  // a callback replaced from outside waits for the running ones
+  sub_a.RemoveReceiveCallback();
+  sub_b.RemoveReceiveCallback();
+
+  // finalize eCAL API
+  eCAL::Finalize();
+}
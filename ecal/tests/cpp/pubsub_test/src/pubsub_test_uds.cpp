@@ -0,0 +1,107 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <ecal/ecal.h>
+#include <ecal/pubsub/publisher.h>
+#include <ecal/pubsub/subscriber.h>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+enum {
+  CMN_REGISTRATION_REFRESH_MS = 1000,
+  DATA_FLOW_TIME_MS           = 50,
+};
+
+namespace
+{
+  eCAL::Publisher::Configuration UdsPublisherConfiguration(unsigned int memfd_min_size_bytes_)
+  {
+    eCAL::Publisher::Configuration pub_config;
+    pub_config.layer.shm.enable                = false;
+    pub_config.layer.udp.enable                = false;
+    pub_config.layer.tcp.enable                = false;
+    pub_config.layer.inproc.enable             = false;
+    pub_config.layer.uds.enable                = true;
+    pub_config.layer.uds.memfd_min_size_bytes  = memfd_min_size_bytes_;
+    return pub_config;
+  }
+
+  eCAL::Subscriber::Configuration UdsSubscriberConfiguration()
+  {
+    eCAL::Subscriber::Configuration sub_config;
+    sub_config.layer.uds.enable = true;
+    return sub_config;
+  }
+
+  void SendAndReceive(const std::vector<std::string>& send_vector_, unsigned int memfd_min_size_bytes_)
+  {
+    std::mutex               received_mtx;
+    std::vector<std::string> received;
+
+    // initialize eCAL API
+    eCAL::Initialize("pubsub_test");
+
+    // create subscriber and publisher for topic "A"
+    eCAL::CSubscriber sub("A", {}, UdsSubscriberConfiguration());
+    eCAL::CPublisher  pub("A", {}, UdsPublisherConfiguration(memfd_min_size_bytes_));
+
+    // add callback
+    auto save_data = [&](const eCAL::STopicId& /*topic_id_*/, const eCAL::SDataTypeInformation& /*data_type_info_*/, const eCAL::SReceiveCallbackData& data_)
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      received.emplace_back(static_cast<const char*>(data_.buffer), data_.buffer_size);
+    };
+    sub.SetReceiveCallback(save_data);
+
+    // let's match them (writer start and reader connect need two registration cycles)
+    eCAL::Process::SleepMS(3 * CMN_REGISTRATION_REFRESH_MS);
+
+    for (const auto& elem : send_vector_)
+    {
+      EXPECT_TRUE(pub.Send(elem));
+      eCAL::Process::SleepMS(DATA_FLOW_TIME_MS);
+    }
+
+    {
+      const std::lock_guard<std::mutex> lock(received_mtx);
+      EXPECT_EQ(send_vector_, received);
+    }
+
+    // finalize eCAL API
+    eCAL::Finalize();
+  }
+}
+
+TEST(core_cpp_pubsub, MultipleSendsUDS)
+{
+  // streamed payloads only
+  SendAndReceive({ "this", "is", "a", "", "testtest" }, 0);
+}
+
+TEST(core_cpp_pubsub, LargeSendsUDS)
+{
+  // payloads from 1 kB on are passed as memfd (where supported)
+  SendAndReceive({ std::string(16, 'a'), std::string(1024, 'b'), std::string(4 * 1024 * 1024, 'c') }, 1024);
+}
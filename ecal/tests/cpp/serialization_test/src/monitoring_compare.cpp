@@ -22,11 +22,52 @@
 
 #include <cstddef>
 #include <ecal/types/monitoring.h>
+#include <vector>
 
 namespace eCAL
 {
   namespace Monitoring
   {
+    namespace
+    {
+      bool CompareTransportLayers(const std::vector<STransportLayer>& layers1, const std::vector<STransportLayer>& layers2)
+      {
+        if (layers1.size() != layers2.size())
+        {
+          return false;
+        }
+
+        for (size_t i = 0; i < layers1.size(); ++i)
+        {
+          if (layers1[i].type != layers2[i].type ||
+            layers1[i].version != layers2[i].version ||
+            layers1[i].active != layers2[i].active ||
+            layers1[i].pacing_rate != layers2[i].pacing_rate ||
+            layers1[i].pacing_delayed_datagrams != layers2[i].pacing_delayed_datagrams ||
+            layers1[i].pacing_delay_us != layers2[i].pacing_delay_us ||
+            layers1[i].connection_count != layers2[i].connection_count ||
+            layers1[i].statistics.size() != layers2[i].statistics.size())
+          {
+            return false;
+          }
+
+          for (size_t j = 0; j < layers1[i].statistics.size(); ++j)
+          {
+            const auto& statistics1 = layers1[i].statistics[j];
+            const auto& statistics2 = layers2[i].statistics[j];
+            if (statistics1.size_class != statistics2.size_class ||
+              statistics1.samples != statistics2.samples ||
+              statistics1.cost_us != statistics2.cost_us ||
+              statistics1.selected != statistics2.selected)
+            {
+              return false;
+            }
+          }
+        }
+        return true;
+      }
+    }
+
     // compare two monitoring structs
     bool CompareMonitorings(const SMonitoring& monitoring1, const SMonitoring& monitoring2)
     {
@@ -78,11 +119,16 @@ namespace eCAL
           monitoring1.publishers[i].topic_name != monitoring2.publishers[i].topic_name ||
           monitoring1.publishers[i].direction != monitoring2.publishers[i].direction ||
           monitoring1.publishers[i].datatype_information != monitoring2.publishers[i].datatype_information ||
-          monitoring1.publishers[i].transport_layer.size() != monitoring2.publishers[i].transport_layer.size() ||
+          !CompareTransportLayers(monitoring1.publishers[i].transport_layer, monitoring2.publishers[i].transport_layer) ||
           monitoring1.publishers[i].topic_size != monitoring2.publishers[i].topic_size ||
           monitoring1.publishers[i].connections_local != monitoring2.publishers[i].connections_local ||
           monitoring1.publishers[i].connections_external != monitoring2.publishers[i].connections_external ||
           monitoring1.publishers[i].message_drops != monitoring2.publishers[i].message_drops ||
+          monitoring1.publishers[i].receive_queue_depth != monitoring2.publishers[i].receive_queue_depth ||
+          monitoring1.publishers[i].receive_queue_size != monitoring2.publishers[i].receive_queue_size ||
+          monitoring1.publishers[i].receive_queue_high_water_mark != monitoring2.publishers[i].receive_queue_high_water_mark ||
+          monitoring1.publishers[i].receive_queue_drops != monitoring2.publishers[i].receive_queue_drops ||
+          monitoring1.publishers[i].max_frequency != monitoring2.publishers[i].max_frequency ||
           monitoring1.publishers[i].data_id != monitoring2.publishers[i].data_id ||
           monitoring1.publishers[i].data_clock != monitoring2.publishers[i].data_clock ||
           monitoring1.publishers[i].data_frequency != monitoring2.publishers[i].data_frequency)
@@ -109,11 +155,16 @@ namespace eCAL
           monitoring1.subscribers[i].topic_name != monitoring2.subscribers[i].topic_name ||
           monitoring1.subscribers[i].direction != monitoring2.subscribers[i].direction ||
           monitoring1.subscribers[i].datatype_information != monitoring2.subscribers[i].datatype_information ||
-          monitoring1.subscribers[i].transport_layer.size() != monitoring2.subscribers[i].transport_layer.size() ||
+          !CompareTransportLayers(monitoring1.subscribers[i].transport_layer, monitoring2.subscribers[i].transport_layer) ||
           monitoring1.subscribers[i].topic_size != monitoring2.subscribers[i].topic_size ||
           monitoring1.subscribers[i].connections_local != monitoring2.subscribers[i].connections_local ||
           monitoring1.subscribers[i].connections_external != monitoring2.subscribers[i].connections_external ||
           monitoring1.subscribers[i].message_drops != monitoring2.subscribers[i].message_drops ||
+          monitoring1.subscribers[i].receive_queue_depth != monitoring2.subscribers[i].receive_queue_depth ||
+          monitoring1.subscribers[i].receive_queue_size != monitoring2.subscribers[i].receive_queue_size ||
+          monitoring1.subscribers[i].receive_queue_high_water_mark != monitoring2.subscribers[i].receive_queue_high_water_mark ||
+          monitoring1.subscribers[i].receive_queue_drops != monitoring2.subscribers[i].receive_queue_drops ||
+          monitoring1.subscribers[i].max_frequency != monitoring2.subscribers[i].max_frequency ||
           monitoring1.subscribers[i].data_id != monitoring2.subscribers[i].data_id ||
           monitoring1.subscribers[i].data_clock != monitoring2.subscribers[i].data_clock ||
           monitoring1.subscribers[i].data_frequency != monitoring2.subscribers[i].data_frequency ||
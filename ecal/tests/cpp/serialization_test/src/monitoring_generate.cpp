@@ -79,6 +79,9 @@ namespace eCAL
       topic.direction            = direction;
       topic.datatype_information = eCAL::Registration::GenerateDataTypeInformation();
       topic.transport_layer.push_back({ eTransportLayerType::shm, 1, true });
+      topic.transport_layer.push_back({ eTransportLayerType::udp_mc, 1, true, rand(), rand() % 1000, rand() });
+      topic.transport_layer.push_back({ eTransportLayerType::tcp, 1, true, 0, 0, 0, rand() % 100 });
+      topic.transport_layer.back().statistics.push_back({ rand() % 16, rand(), rand() / 100.0, true });
       topic.topic_size           = rand() % 5000;
       topic.connections_local    = rand() % 10;
       topic.connections_external = rand() % 10;
@@ -87,6 +90,11 @@ namespace eCAL
       topic.data_clock           = rand() % 10000;
       topic.data_frequency       = rand() % 100;
       topic.data_latency_us = GenerateStatistics();
+      topic.receive_queue_depth           = rand() % 100;
+      topic.receive_queue_size            = rand() % 100;
+      topic.receive_queue_high_water_mark = rand() % 100;
+      topic.receive_queue_drops           = rand() % 100;
+      topic.max_frequency                 = rand() % 10000;
       return topic;
     }
 
@@ -141,5 +141,89 @@ namespace eCAL
 
       ASSERT_TRUE(ComparePayloadSamples(sample_in, sample_out));
     }
+
+    TEST(core_cpp_serialization, RawPayloadHeaderGather)
+    {
+      std::vector<char> payload;
+      InitializeVec(payload, 1024);
+
+      Sample sample_in = GeneratePayloadSample(payload.data(), payload.size());
+
+      // header + payload concatenated must decode to the full sample
+      std::vector<char> sample_buffer;
+      ASSERT_TRUE(SerializeHeaderToBuffer(sample_in, sample_buffer));
+      sample_buffer.insert(sample_buffer.end(), payload.begin(), payload.end());
+
+      Sample sample_out;
+      ASSERT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+      ASSERT_TRUE(ComparePayloadSamples(sample_in, sample_out));
+    }
+
+    TEST(core_cpp_serialization, RawPayloadHeaderGatherEmpty)
+    {
+      Sample sample_in = GeneratePayloadSample(nullptr, 0);
+
+      std::vector<char> sample_buffer;
+      ASSERT_TRUE(SerializeHeaderToBuffer(sample_in, sample_buffer));
+
+      Sample sample_out;
+      ASSERT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+      ASSERT_TRUE(ComparePayloadSamples(sample_in, sample_out));
+    }
+
+    TEST(core_cpp_serialization, RawPayload2View)
+    {
+      std::vector<char> payload;
+      InitializeVec(payload, 1024);
+
+      Sample sample_in = GeneratePayloadSample(payload.data(), payload.size());
+
+      std::vector<char> sample_buffer;
+      ASSERT_TRUE(SerializeToBuffer(sample_in, sample_buffer));
+
+      SampleView sample_out;
+      ASSERT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+      EXPECT_EQ(sample_in.cmd_type,              sample_out.cmd_type);
+      EXPECT_EQ(sample_in.topic_info.host_name,  sample_out.topic_info.host_name);
+      EXPECT_EQ(sample_in.topic_info.topic_id,   sample_out.topic_info.topic_id);
+      EXPECT_EQ(sample_in.topic_info.topic_name, sample_out.topic_info.topic_name);
+      EXPECT_EQ(sample_in.topic_info.process_id, sample_out.topic_info.process_id);
+      EXPECT_EQ(sample_in.content.id,            sample_out.content.id);
+      EXPECT_EQ(sample_in.content.clock,         sample_out.content.clock);
+      EXPECT_EQ(sample_in.content.time,          sample_out.content.time);
+      EXPECT_EQ(sample_in.content.hash,          sample_out.content.hash);
+      EXPECT_EQ(sample_in.content.size,          sample_out.content.size);
+
+      // the view must point into the serialized buffer
+      ASSERT_EQ(payload.size(), sample_out.content.payload_size);
+      EXPECT_GE(sample_out.content.payload_addr, sample_buffer.data());
+      EXPECT_LE(sample_out.content.payload_addr + sample_out.content.payload_size, sample_buffer.data() + sample_buffer.size());
+      EXPECT_EQ(std::vector<char>(sample_out.content.payload_addr, sample_out.content.payload_addr + sample_out.content.payload_size), payload);
+    }
+
+    TEST(core_cpp_serialization, RawPayloadEmpty2View)
+    {
+      Sample sample_in = GeneratePayloadSample(nullptr, 0);
+
+      std::vector<char> sample_buffer;
+      ASSERT_TRUE(SerializeToBuffer(sample_in, sample_buffer));
+
+      SampleView sample_out;
+      ASSERT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+      EXPECT_EQ(sample_in.topic_info.topic_name, sample_out.topic_info.topic_name);
+      EXPECT_EQ(0u, sample_out.content.payload_size);
+    }
+
+    TEST(core_cpp_serialization, InvalidBuffer2View)
+    {
+      const std::vector<char> sample_buffer(16, '\xff');
+
+      SampleView sample_out;
+      EXPECT_FALSE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out));
+    }
   }
 }
@@ -102,13 +102,39 @@ namespace eCAL
       case eTLayerType::tl_ecal_shm:
         layer.par_layer.layer_par_shm.memory_file_list.push_back(GenerateString(5));
         layer.par_layer.layer_par_shm.memory_file_list.push_back(GenerateString(10));
+        layer.par_layer.layer_par_shm.sample_batch = (rand() % 2) == 1;
+        break;
+      case eTLayerType::tl_ecal_udp:
+        layer.par_layer.layer_par_udpmc.pacing_rate              = rand();
+        layer.par_layer.layer_par_udpmc.pacing_delayed_datagrams = rand();
+        layer.par_layer.layer_par_udpmc.pacing_delay_us          = rand();
+        layer.par_layer.layer_par_udpmc.sample_batch             = (rand() % 2) == 1;
+        layer.par_layer.layer_par_udpmc.fec_fragments            = (rand() % 2) == 1;
+        layer.par_layer.layer_par_udpmc.nack_id                  = rand();
         break;
       case eTLayerType::tl_ecal_tcp:
-        layer.par_layer.layer_par_tcp.port = rand();
+        layer.par_layer.layer_par_tcp.port          = rand();
+        layer.par_layer.layer_par_tcp.frame_version = rand();
+        layer.par_layer.layer_par_tcp.connection_count = rand();
+        break;
+      case eTLayerType::tl_ecal_uds:
+        layer.par_layer.layer_par_uds.path = GenerateString(12);
         break;
       default:
         break;
       }
+      const int statistics_count = rand() % 3;
+      for (int i = 0; i < statistics_count; ++i)
+      {
+        LayerStatistics statistics;
+        statistics.publisher_id   = rand();
+        statistics.size_class     = rand() % 16;
+        statistics.samples        = rand();
+        statistics.latency_us_sum = rand();
+        statistics.cost_us        = rand() / 100.0;
+        statistics.selected       = (rand() % 2) == 1;
+        layer.statistics.push_back(statistics);
+      }
       return layer;
     }
 
@@ -126,10 +152,25 @@ namespace eCAL
       topic.transport_layer.push_back(GenerateTLayer(eTLayerType::tl_ecal_shm));
       topic.transport_layer.push_back(GenerateTLayer(eTLayerType::tl_ecal_udp));
       topic.transport_layer.push_back(GenerateTLayer(eTLayerType::tl_ecal_tcp));
+      topic.transport_layer.push_back(GenerateTLayer(eTLayerType::tl_ecal_uds));
       topic.topic_size           = rand() % 1000;
       topic.connections_local    = rand() % 50;
       topic.connections_external = rand() % 50;
       topic.message_drops        = rand() % 10;
+      topic.receive_queue_depth           = rand() % 100;
+      topic.receive_queue_size            = rand() % 100;
+      topic.receive_queue_high_water_mark = rand() % 100;
+      topic.receive_queue_drops           = rand() % 10;
+      const int content_id_range_count = rand() % 3;
+      for (int i = 0; i < content_id_range_count; ++i)
+      {
+        ContentIdRange content_id_range;
+        content_id_range.min_id = rand();
+        content_id_range.max_id = content_id_range.min_id + rand() % 100;
+        topic.content_id_filter.push_back(content_id_range);
+      }
+      topic.max_frequency        = rand() % 10000;
+      topic.history_replay       = rand() % 2 == 1;
       topic.data_id              = rand();
       topic.data_clock           = rand();
       topic.data_frequency       = rand() % 100;
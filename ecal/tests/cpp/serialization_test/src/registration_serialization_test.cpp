@@ -107,5 +107,23 @@ namespace eCAL
       EXPECT_TRUE(sample_list_in.size() == sample_list_out.size());
       EXPECT_EQ(sample_list_in, sample_list_out);
     }
+
+    TEST_F(core_cpp_registration_serialization, TcpConnectionCount)
+    {
+      // the connection count is not part of the layer parameter comparison, check it separately
+      const Sample sample_in = GenerateTopicSample();
+
+      std::vector<char> sample_buffer;
+      EXPECT_TRUE(SerializeToBuffer(sample_in, sample_buffer));
+
+      Sample sample_out;
+      EXPECT_TRUE(DeserializeFromBuffer(sample_buffer.data(), sample_buffer.size(), sample_out));
+
+      ASSERT_EQ(sample_in.topic.transport_layer.size(), sample_out.topic.transport_layer.size());
+      for (size_t i = 0; i < sample_in.topic.transport_layer.size(); ++i)
+      {
+        EXPECT_EQ(sample_in.topic.transport_layer[i].par_layer.layer_par_tcp.connection_count, sample_out.topic.transport_layer[i].par_layer.layer_par_tcp.connection_count);
+      }
+    }
   }
 }
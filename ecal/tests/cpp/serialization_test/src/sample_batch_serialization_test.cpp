@@ -0,0 +1,141 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <readwrite/ecal_sample_batch.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace eCAL
+{
+  namespace
+  {
+    std::vector<std::string> UnpackBatch(const std::vector<char>& batch_)
+    {
+      std::vector<std::string> samples;
+      EXPECT_TRUE(ForEachSampleInBatch(batch_.data(), batch_.size(), [&samples](const char* data_, size_t size_)
+        {
+          // the samples inside a batch are 8 byte aligned
+          EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(data_) % 8);
+          samples.emplace_back(data_, size_);
+        }));
+      return samples;
+    }
+  }
+
+  TEST(core_cpp_serialization, SampleBatchRoundtrip)
+  {
+    std::vector<std::vector<char>> batches;
+    {
+      CSampleCoalescer coalescer(1024, std::chrono::seconds(10), [&batches](const std::vector<char>& batch_) { batches.push_back(batch_); });
+
+      const std::string header  = "header";
+      const std::string payload = "payload";
+      EXPECT_TRUE(coalescer.Add(header.data(), header.size(), payload.data(), payload.size()));
+      EXPECT_TRUE(coalescer.Add(payload.data(), payload.size(), nullptr, 0));
+      EXPECT_TRUE(batches.empty());
+
+      coalescer.Flush();
+    }
+
+    ASSERT_EQ(1u, batches.size());
+    EXPECT_TRUE(IsSampleBatch(batches[0].data(), batches[0].size()));
+    const std::vector<std::string> samples = UnpackBatch(batches[0]);
+    ASSERT_EQ(2u, samples.size());
+    EXPECT_EQ("headerpayload", samples[0]);
+    EXPECT_EQ("payload",       samples[1]);
+  }
+
+  TEST(core_cpp_serialization, SampleBatchSizeThreshold)
+  {
+    std::vector<std::vector<char>> batches;
+    CSampleCoalescer coalescer(64, std::chrono::seconds(10), [&batches](const std::vector<char>& batch_) { batches.push_back(batch_); });
+
+    // batch header (8) + 3 entries (8 + 8) = 56, the 4th sample does not fit anymore
+    const std::string sample = "12345678";
+    for (int i = 0; i < 4; ++i)
+    {
+      EXPECT_TRUE(coalescer.Add(sample.data(), sample.size(), nullptr, 0));
+    }
+    ASSERT_EQ(1u, batches.size());
+    EXPECT_EQ(3u, UnpackBatch(batches[0]).size());
+
+    // samples that never fit into a batch are rejected
+    const std::string large_sample(64, 'x');
+    EXPECT_FALSE(coalescer.Add(large_sample.data(), large_sample.size(), nullptr, 0));
+  }
+
+  TEST(core_cpp_serialization, SampleBatchDeadline)
+  {
+    std::mutex                     batches_mutex;
+    std::vector<std::vector<char>> batches;
+    CSampleCoalescer coalescer(1024, std::chrono::milliseconds(5), [&](const std::vector<char>& batch_)
+      {
+        const std::lock_guard<std::mutex> lock(batches_mutex);
+        batches.push_back(batch_);
+      });
+
+    const std::string sample = "sample";
+    EXPECT_TRUE(coalescer.Add(sample.data(), sample.size(), nullptr, 0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const std::lock_guard<std::mutex> lock(batches_mutex);
+    ASSERT_EQ(1u, batches.size());
+    EXPECT_EQ(1u, UnpackBatch(batches[0]).size());
+  }
+
+  TEST(core_cpp_serialization, SampleBatchBuilder)
+  {
+    CSampleBatchBuilder builder(64);
+    EXPECT_TRUE(builder.Empty());
+
+    // batch header (8) + 3 entries (8 + 8) = 56, the 4th sample is rejected
+    const std::string sample = "12345678";
+    for (int i = 0; i < 3; ++i)
+    {
+      EXPECT_TRUE(builder.Add(sample.data(), sample.size(), nullptr, 0));
+    }
+    EXPECT_TRUE(builder.Full());
+    EXPECT_FALSE(builder.Add(sample.data(), sample.size(), nullptr, 0));
+    EXPECT_EQ(3u, builder.GetSampleCount());
+    EXPECT_EQ(3u, UnpackBatch(builder.Get()).size());
+
+    builder.Clear();
+    EXPECT_TRUE(builder.Empty());
+    EXPECT_TRUE(builder.Get().empty());
+    EXPECT_FALSE(builder.Fits(64));
+  }
+
+  TEST(core_cpp_serialization, SampleBatchMalformed)
+  {
+    const std::vector<char> no_batch = { 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    EXPECT_FALSE(IsSampleBatch(no_batch.data(), no_batch.size()));
+
+    // announces one sample of 100 bytes but ends after the entry header
+    const std::vector<char> truncated = { '\0', 'B', 'A', 'T', 1, 0, 0, 0, 100, 0, 0, 0, 0, 0, 0, 0 };
+    EXPECT_TRUE(IsSampleBatch(truncated.data(), truncated.size()));
+    EXPECT_FALSE(ForEachSampleInBatch(truncated.data(), truncated.size(), [](const char*, size_t) { FAIL(); }));
+  }
+}
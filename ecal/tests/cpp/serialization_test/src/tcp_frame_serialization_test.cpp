@@ -0,0 +1,96 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include <readwrite/tcp/ecal_tcp_frame.h>
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+namespace eCAL
+{
+  namespace TCP
+  {
+    namespace
+    {
+      SFrameHeader GenerateFrameHeader(uint64_t payload_size_)
+      {
+        SFrameHeader header;
+        header.topic_id     = 0x0123456789abcdefULL;
+        header.process_id   = 4711;
+        header.id           = -42;
+        header.clock        = 1234567;
+        header.time         = 1700000000000000LL;
+        header.hash         = -1;
+        header.payload_size = payload_size_;
+        return header;
+      }
+    }
+
+    TEST(core_cpp_serialization, TcpFrameV2)
+    {
+      const std::vector<char> payload(100, 'x');
+
+      std::vector<char> frame;
+      SerializeFrameHeaderV2(GenerateFrameHeader(payload.size()), frame);
+      ASSERT_EQ(frame_header_v2_size, frame.size());
+      EXPECT_EQ(0u, frame.size() % 8);
+      frame.insert(frame.end(), payload.begin(), payload.end());
+
+      EXPECT_EQ(frame_version_v2, GetFrameVersion(frame.data(), frame.size()));
+
+      SFrameHeader header;
+      size_t payload_offset(0);
+      ASSERT_TRUE(DeserializeFrameHeaderV2(frame.data(), frame.size(), header, payload_offset));
+
+      const SFrameHeader expected = GenerateFrameHeader(payload.size());
+      EXPECT_EQ(expected.topic_id,     header.topic_id);
+      EXPECT_EQ(expected.process_id,   header.process_id);
+      EXPECT_EQ(expected.id,           header.id);
+      EXPECT_EQ(expected.clock,        header.clock);
+      EXPECT_EQ(expected.time,         header.time);
+      EXPECT_EQ(expected.hash,         header.hash);
+      EXPECT_EQ(expected.payload_size, header.payload_size);
+      EXPECT_EQ(frame_header_v2_size,  payload_offset);
+    }
+
+    TEST(core_cpp_serialization, TcpFrameV2Truncated)
+    {
+      std::vector<char> frame;
+      SerializeFrameHeaderV2(GenerateFrameHeader(100), frame);
+      frame.resize(frame.size() + 99);
+
+      SFrameHeader header;
+      size_t payload_offset(0);
+      EXPECT_FALSE(DeserializeFrameHeaderV2(frame.data(), frame.size(), header, payload_offset));
+      EXPECT_FALSE(DeserializeFrameHeaderV2(frame.data(), frame_header_v2_size - 1, header, payload_offset));
+    }
+
+    TEST(core_cpp_serialization, TcpFrameV1Detection)
+    {
+      // 'ECAL' + 16 bit protobuf header size + protobuf header (starts with a field tag)
+      const std::vector<char> frame = { 'E', 'C', 'A', 'L', 3, 0, 0x08, 0x01, 0x00 };
+      EXPECT_EQ(frame_version_v1, GetFrameVersion(frame.data(), frame.size()));
+
+      SFrameHeader header;
+      size_t payload_offset(0);
+      EXPECT_FALSE(DeserializeFrameHeaderV2(frame.data(), frame.size(), header, payload_offset));
+    }
+  }
+}
@@ -0,0 +1,77 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/content_id_filter.h"
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+using RangeT = eCAL::CContentIdFilter::RangeT;
+
+TEST(core_cpp_util, ContentIdFilter_EmptyAcceptsAll)
+{
+  const eCAL::CContentIdFilter filter;
+
+  EXPECT_TRUE(filter.AcceptsAll());
+  EXPECT_TRUE(filter.Accepts(0));
+  EXPECT_TRUE(filter.Accepts(std::numeric_limits<int64_t>::min()));
+  EXPECT_TRUE(filter.Accepts(std::numeric_limits<int64_t>::max()));
+}
+
+TEST(core_cpp_util, ContentIdFilter_Ranges)
+{
+  const eCAL::CContentIdFilter filter({ { 20, 29 }, { 5, 5 }, { 12, 10 } });
+
+  EXPECT_FALSE(filter.AcceptsAll());
+  EXPECT_FALSE(filter.Accepts(4));
+  EXPECT_TRUE (filter.Accepts(5));
+  EXPECT_FALSE(filter.Accepts(6));
+  EXPECT_TRUE (filter.Accepts(10));
+  EXPECT_TRUE (filter.Accepts(12));
+  EXPECT_FALSE(filter.Accepts(13));
+  EXPECT_TRUE (filter.Accepts(20));
+  EXPECT_TRUE (filter.Accepts(29));
+  EXPECT_FALSE(filter.Accepts(30));
+}
+
+TEST(core_cpp_util, ContentIdFilter_NormalizesRanges)
+{
+  const int64_t max_id = std::numeric_limits<int64_t>::max();
+  const eCAL::CContentIdFilter filter({ { 8, 9 }, { 1, 3 }, { 4, 6 }, { 2, 5 }, { max_id - 1, max_id }, { max_id, max_id } });
+
+  const std::vector<RangeT> expected{ { 1, 6 }, { 8, 9 }, { max_id - 1, max_id } };
+  EXPECT_EQ(expected, filter.GetRanges());
+}
+
+TEST(core_cpp_util, ContentIdFilter_Merge)
+{
+  eCAL::CContentIdFilter filter({ { 1, 2 } });
+  filter.Merge(eCAL::CContentIdFilter({ { 3, 4 }, { 10, 10 } }));
+
+  const std::vector<RangeT> expected{ { 1, 4 }, { 10, 10 } };
+  EXPECT_EQ(expected, filter.GetRanges());
+
+  // a filter accepting every content id makes the merged filter accept every content id
+  filter.Merge(eCAL::CContentIdFilter());
+  EXPECT_TRUE(filter.AcceptsAll());
+
+  filter.Merge(eCAL::CContentIdFilter({ { 1, 2 } }));
+  EXPECT_TRUE(filter.AcceptsAll());
+}
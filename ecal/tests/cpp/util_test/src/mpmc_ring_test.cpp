@@ -0,0 +1,195 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/mpmc_ring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(core_cpp_util, MpmcRing_FullAndEmpty)
+{
+  eCAL::MpmcRing<int> ring(3);
+  EXPECT_EQ(3U, ring.Capacity());
+  EXPECT_TRUE(ring.Empty());
+
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_TRUE(ring.Push([i](int& slot_) { slot_ = i; }));
+  }
+  EXPECT_EQ(3U, ring.Size());
+
+  // full, the element is not written
+  bool filled(false);
+  EXPECT_FALSE(ring.Push([&filled](int& /*slot_*/) { filled = true; }));
+  EXPECT_FALSE(filled);
+
+  // elements are popped in order
+  for (int i = 0; i < 3; ++i)
+  {
+    int value(-1);
+    EXPECT_TRUE(ring.Pop([&value](int& slot_) { value = slot_; }));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_TRUE(ring.Empty());
+  EXPECT_FALSE(ring.Pop([](int& /*slot_*/) {}));
+}
+
+TEST(core_cpp_util, MpmcRing_PopBatch)
+{
+  eCAL::MpmcRing<int> ring(8);
+
+  // wrap around the end of the slots
+  for (int round = 0; round < 3; ++round)
+  {
+    for (int i = 0; i < 5; ++i)
+    {
+      EXPECT_TRUE(ring.Push([i](int& slot_) { slot_ = i; }));
+    }
+
+    std::vector<int> values;
+    EXPECT_EQ(3U, ring.PopBatch([&values](int& slot_) { values.push_back(slot_); }, 3));
+    EXPECT_EQ(2U, ring.PopBatch([&values](int& slot_) { values.push_back(slot_); }, 10));
+    EXPECT_EQ(std::vector<int>({ 0, 1, 2, 3, 4 }), values);
+    EXPECT_TRUE(ring.Empty());
+  }
+}
+
+TEST(core_cpp_util, MpmcRing_SwapReusesBuffers)
+{
+  eCAL::MpmcRing<std::string> ring(2);
+
+  std::string buffer;
+  buffer.reserve(1024);
+  const auto* const buffer_data = buffer.data();
+
+  // hand the consumer buffer over to the ring and get it back with the next element
+  EXPECT_TRUE(ring.Push([](std::string& slot_) { slot_.assign(100, 'a'); }));
+  EXPECT_TRUE(ring.Pop([&buffer](std::string& slot_) { buffer.swap(slot_); }));
+  EXPECT_EQ(std::string(100, 'a'), buffer);
+
+  // the first slot is filled into the reserved consumer buffer without reallocation
+  EXPECT_TRUE(ring.Push([](std::string& slot_) { slot_.assign(200, 'b'); }));
+  EXPECT_TRUE(ring.Push([&buffer_data](std::string& slot_) { slot_.assign(500, 'c'); EXPECT_EQ(buffer_data, slot_.data()); }));
+  EXPECT_TRUE(ring.Pop([&buffer](std::string& slot_) { buffer.swap(slot_); }));
+  EXPECT_EQ(std::string(200, 'b'), buffer);
+  EXPECT_TRUE(ring.Pop([&buffer](std::string& slot_) { buffer.swap(slot_); }));
+  EXPECT_EQ(std::string(500, 'c'), buffer);
+  EXPECT_EQ(buffer_data, buffer.data());
+}
+
+TEST(core_cpp_util, MpmcRing_ConcurrentProducerConsumer)
+{
+  const size_t count = 100000;
+  eCAL::MpmcRing<size_t> ring(16);
+
+  std::thread producer([&ring, count]()
+    {
+      for (size_t i = 0; i < count;)
+      {
+        if (ring.Push([i](size_t& slot_) { slot_ = i; })) i++;
+        else std::this_thread::yield();
+      }
+    });
+
+  // every element arrives once and in order
+  size_t expected(0);
+  bool   in_order(true);
+  while (expected < count)
+  {
+    const size_t taken = ring.PopBatch([&expected, &in_order](size_t& slot_) { in_order &= (slot_ == expected); expected++; }, 8);
+    if (taken == 0) std::this_thread::yield();
+  }
+  producer.join();
+
+  EXPECT_TRUE(in_order);
+  EXPECT_TRUE(ring.Empty());
+}
+
+TEST(core_cpp_util, MpmcRing_ConcurrentProducersConsumers)
+{
+  const size_t producer_count = 4;
+  const size_t consumer_count = 2;
+  const size_t count          = 20000;
+  eCAL::MpmcRing<size_t> ring(16);
+
+  // every producer pushes its id in the upper bits and a running number in the lower bits
+  std::vector<std::thread> producers;
+  for (size_t producer = 0; producer < producer_count; ++producer)
+  {
+    producers.emplace_back([&ring, producer, count]()
+      {
+        for (size_t i = 0; i < count;)
+        {
+          if (ring.Push([producer, i](size_t& slot_) { slot_ = (producer << 32U) | i; })) i++;
+          else std::this_thread::yield();
+        }
+      });
+  }
+
+  std::atomic<size_t> taken(0);
+  std::vector<std::vector<size_t>> received(consumer_count);
+  std::vector<std::thread> consumers;
+  for (size_t consumer = 0; consumer < consumer_count; ++consumer)
+  {
+    consumers.emplace_back([&ring, &taken, &received, consumer, producer_count, count]()
+      {
+        while (taken < producer_count * count)
+        {
+          if (ring.Pop([&received, consumer](size_t& slot_) { received[consumer].push_back(slot_); })) taken++;
+          else std::this_thread::yield();
+        }
+      });
+  }
+  for (auto& producer : producers) producer.join();
+  for (auto& consumer : consumers) consumer.join();
+
+  // every element arrives exactly once, the elements of a producer in order per consumer
+  std::vector<size_t> all;
+  bool in_order(true);
+  for (const auto& values : received)
+  {
+    std::vector<size_t> last(producer_count, 0);
+    std::vector<bool>   first(producer_count, true);
+    for (const auto value : values)
+    {
+      const size_t producer = value >> 32U;
+      const size_t number   = value & 0xFFFFFFFFU;
+      in_order &= first[producer] || (number > last[producer]);
+      first[producer] = false;
+      last[producer]  = number;
+    }
+    all.insert(all.end(), values.begin(), values.end());
+  }
+  std::sort(all.begin(), all.end());
+
+  std::vector<size_t> expected;
+  for (size_t producer = 0; producer < producer_count; ++producer)
+  {
+    for (size_t i = 0; i < count; ++i) expected.push_back((producer << 32U) | i);
+  }
+  EXPECT_EQ(expected, all);
+  EXPECT_TRUE(in_order);
+  EXPECT_TRUE(ring.Empty());
+}
@@ -0,0 +1,83 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/rate_limiter.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+
+namespace
+{
+  using Limiter = eCAL::RateLimiter<std::chrono::steady_clock>;
+
+  Limiter::time_point AtMs(long long ms_)
+  {
+    return Limiter::time_point(std::chrono::milliseconds(ms_));
+  }
+
+  // number of samples passing when offered every interval_ms_ for duration_ms_
+  int CountPassed(Limiter& limiter_, long long interval_ms_, long long duration_ms_)
+  {
+    int passed(0);
+    for (long long t = 0; t < duration_ms_; t += interval_ms_)
+    {
+      if (limiter_.Pass(AtMs(t))) passed++;
+    }
+    return passed;
+  }
+}
+
+TEST(core_cpp_util, RateLimiter_Unlimited)
+{
+  Limiter limiter;
+  EXPECT_FALSE(limiter.IsLimited());
+  EXPECT_EQ(100, CountPassed(limiter, 1, 100));
+}
+
+TEST(core_cpp_util, RateLimiter_LimitsFrequency)
+{
+  // 1 kHz offered, 10 Hz passing
+  Limiter limiter(10.0);
+  EXPECT_TRUE(limiter.IsLimited());
+  EXPECT_EQ(10, CountPassed(limiter, 1, 1000));
+}
+
+TEST(core_cpp_util, RateLimiter_FixedSchedule)
+{
+  Limiter limiter(10.0);
+  EXPECT_TRUE (limiter.Pass(AtMs(0)));
+  // a late sample does not shift the schedule
+  EXPECT_TRUE (limiter.Pass(AtMs(130)));
+  EXPECT_FALSE(limiter.Pass(AtMs(190)));
+  EXPECT_TRUE (limiter.Pass(AtMs(200)));
+  // no burst after a pause
+  EXPECT_TRUE (limiter.Pass(AtMs(1000)));
+  EXPECT_FALSE(limiter.Pass(AtMs(1050)));
+  EXPECT_TRUE (limiter.Pass(AtMs(1100)));
+}
+
+TEST(core_cpp_util, RateLimiter_Tolerance)
+{
+  // samples limited by the sender arrive with jitter
+  Limiter limiter(10.0, 0.5);
+  EXPECT_TRUE (limiter.Pass(AtMs(10)));
+  EXPECT_TRUE (limiter.Pass(AtMs(100)));
+  EXPECT_FALSE(limiter.Pass(AtMs(140)));
+  EXPECT_TRUE (limiter.Pass(AtMs(160)));
+}
@@ -0,0 +1,67 @@
+/* ========================= eCAL LICENSE =================================
+ *
+ * Copyright 2025 AUMOVIO and subsidiaries. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ========================= eCAL LICENSE =================================
+*/
+
+#include "util/statistics_calculator.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+  eCAL::Registration::Statistics Calculate(const std::vector<double>& values_)
+  {
+    eCAL::StatisticsCalculator calculator;
+    for (const auto value : values_) calculator.Update(value);
+    return calculator.GetStatistics();
+  }
+}
+
+TEST(core_cpp_util, Statistics_MergeEqualsSequentialUpdate)
+{
+  const std::vector<double> first { 12.0, 7.0, 30.0, 9.5 };
+  const std::vector<double> second{ 3.0, 18.0, 21.0 };
+
+  std::vector<double> all(first);
+  all.insert(all.end(), second.begin(), second.end());
+  const auto expected = Calculate(all);
+
+  eCAL::StatisticsCalculator merged;
+  merged.Merge(Calculate(first));
+  merged.Merge(Calculate(second));
+  const auto statistics = merged.GetStatistics();
+
+  EXPECT_EQ(expected.count, statistics.count);
+  EXPECT_DOUBLE_EQ(expected.latest, statistics.latest);
+  EXPECT_DOUBLE_EQ(expected.min, statistics.min);
+  EXPECT_DOUBLE_EQ(expected.max, statistics.max);
+  EXPECT_DOUBLE_EQ(expected.mean, statistics.mean);
+  EXPECT_NEAR(expected.variance, statistics.variance, 1e-9);
+}
+
+TEST(core_cpp_util, Statistics_MergeEmpty)
+{
+  const auto statistics = Calculate({ 4.0, 8.0 });
+
+  eCAL::StatisticsCalculator merged;
+  merged.Merge(eCAL::Registration::Statistics());
+  merged.Merge(statistics);
+  merged.Merge(eCAL::Registration::Statistics());
+
+  EXPECT_EQ(statistics, merged.GetStatistics());
+}
@@ -47,7 +47,8 @@ enum eCAL_TransportLayer_eType Convert_TransportLayer_eType(eCAL::TransportLayer
     {eCAL::TransportLayer::eType::none, eCAL_TransportLayer_eType_none},
     {eCAL::TransportLayer::eType::shm, eCAL_TransportLayer_eType_shm},
     {eCAL::TransportLayer::eType::udp_mc, eCAL_TransportLayer_eType_udp_mc},
-    {eCAL::TransportLayer::eType::tcp, eCAL_TransportLayer_eType_tcp}
+    {eCAL::TransportLayer::eType::tcp, eCAL_TransportLayer_eType_tcp},
+    {eCAL::TransportLayer::eType::uds, eCAL_TransportLayer_eType_uds}
   };
   return transport_layer_type_map.at(type_);
 }
@@ -275,7 +276,8 @@ eCAL::TransportLayer::eType Convert_TransportLayer_eType(enum eCAL_TransportLaye
     {eCAL_TransportLayer_eType_none, eCAL::TransportLayer::eType::none},
     {eCAL_TransportLayer_eType_shm, eCAL::TransportLayer::eType::shm},
     {eCAL_TransportLayer_eType_udp_mc, eCAL::TransportLayer::eType::udp_mc},
-    {eCAL_TransportLayer_eType_tcp, eCAL::TransportLayer::eType::tcp}
+    {eCAL_TransportLayer_eType_tcp, eCAL::TransportLayer::eType::tcp},
+    {eCAL_TransportLayer_eType_uds, eCAL::TransportLayer::eType::uds}
   };
   return transport_layer_type_map.at(type_);
 }
@@ -31,7 +31,8 @@ void AddConfigTransportLayer(nanobind::module_& module)
     .value("NONE", eType::none)
     .value("UDP_MC", eType::udp_mc)
     .value("SHM", eType::shm)
-    .value("TCP", eType::tcp);
+    .value("TCP", eType::tcp)
+    .value("UDS", eType::uds);
 
   // Bind TransportLayer::UDP::MulticastConfiguration struct
   nb::class_<UDP::MulticastConfiguration>(module, "MulticastConfiguration")
@@ -33,6 +33,9 @@
 #include <functional>
 #include <cassert>
 #include <cstring>
+#include <memory>
+#include <typeinfo>
+#include <utility>
 
 namespace eCAL
 {
@@ -70,6 +73,15 @@ namespace eCAL
         return serializer.MessageSize(message);
       };
 
+      const void* GetObject() override {
+        return &message;
+      };
+
+      // message type and serializer together identify the object (must match the subscriber side)
+      const char* GetObjectType() override {
+        return typeid(std::pair<T, Serializer>*).name();
+      };
+
     private:
       const T& message;
       Serializer& serializer;
@@ -141,6 +153,22 @@ namespace eCAL
       return m_publisher.Send(payload, time_);
     }
 
+    /**
+     * @brief Send a shared message to all subscribers.
+     *
+     *        Subscribers of the same process using the intra process layer receive the message object itself.
+     *
+     * @param msg_                     The shared message object.
+     * @param time_                    Time stamp.
+     *
+     * @return True if succeeded, otherwise false.
+    **/
+    bool Send(const std::shared_ptr<const T>& msg_, long long time_ = CPublisher::DEFAULT_TIME_ARGUMENT)
+    {
+      if (!msg_) return false;
+      return Send(*msg_, time_);
+    }
+
     /**
      * @brief Query the number of subscribers.
      *
@@ -34,6 +34,8 @@
 #include <functional>
 #include <mutex>
 #include <string>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 namespace eCAL
@@ -136,6 +138,16 @@ namespace eCAL
           return;
         }
 
+        // message object of a publisher in the same process, no deserialization needed
+        if (data_.object != nullptr)
+        {
+          if (data_callback_)
+          {
+            data_callback_(publisher_id_, *static_cast<const T*>(data_.object), data_.send_timestamp, data_.send_clock);
+          }
+          return;
+        }
+
         try
         {
           auto msg = serializer->Deserialize(data_.buffer, data_.buffer_size, data_type_info_);
@@ -153,7 +165,8 @@ namespace eCAL
         }
       };
 
-      m_subscriber.SetReceiveCallback(std::move(internal_receive_callback));
+      // message type and deserializer together identify the message objects we can take from publishers of this process
+      m_subscriber.SetReceiveCallback(std::move(internal_receive_callback), typeid(std::pair<T, Deserializer>*).name());
     }
 
     /**
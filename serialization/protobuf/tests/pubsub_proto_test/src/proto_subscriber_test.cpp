@@ -22,6 +22,8 @@
 #include <chrono>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <string>
 #include <thread>
 // used libraries
 #include <gtest/gtest.h>
@@ -137,3 +139,43 @@ TEST_F(core_cpp_pubsub_proto_sub, ProtoSubscriberTest_MoveConstruction)
 
   ASSERT_EQ(numbers_of_sends, received_callbacks.load());
 }
+
+TEST_F(core_cpp_pubsub_proto_sub, ProtoSubscriberTest_InprocObject)
+{
+  // subscriber and publisher of the same process, intra process layer only
+  eCAL::Subscriber::Configuration sub_config;
+  sub_config.layer.inproc.enable = true;
+
+  eCAL::protobuf::CSubscriber<pb::People::Person> person_rec("ProtoSubscriberTest_InprocObject", sub_config);
+
+  const pb::People::Person* received_object(nullptr);
+  std::string               received_name;
+  std::thread::id           received_thread;
+  person_rec.SetReceiveCallback([&](const eCAL::STopicId& /*publisher_id_*/, const pb::People::Person& person_, long long /*time_*/, long long /*clock_*/)
+    {
+      received_object = &person_;
+      received_name   = person_.name();
+      received_thread = std::this_thread::get_id();
+      received_callbacks++;
+    });
+
+  eCAL::Publisher::Configuration pub_config;
+  pub_config.layer.shm.enable    = false;
+  pub_config.layer.udp.enable    = false;
+  pub_config.layer.tcp.enable    = false;
+  pub_config.layer.inproc.enable = true;
+  eCAL::protobuf::CPublisher<pb::People::Person> person_pub("ProtoSubscriberTest_InprocObject", pub_config);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+
+  auto person = std::make_shared<pb::People::Person>();
+  person->set_id(1);
+  person->set_name("Max");
+  ASSERT_TRUE(person_pub.Send(std::shared_ptr<const pb::People::Person>(person)));
+
+  // the message object itself is handed over synchronously, without serialization
+  ASSERT_EQ(1, received_callbacks);
+  EXPECT_EQ(person.get(), received_object);
+  EXPECT_EQ("Max", received_name);
+  EXPECT_EQ(std::this_thread::get_id(), received_thread);
+}